@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 15th of April 2025, Tuesday.
- * @date updated 4th of March 2026, Wednesday.
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -41,6 +41,9 @@
 #include <memory>
 #include <cassert>
 #include "utils/utils.h"
+#include "utils/metrics.h"
+#include "utils/probes.h"
+#include "bolt/bolt_slab.h"
 
 
 
@@ -80,6 +83,13 @@ struct BufferStats
 
     int grow_hits = 0;
     int shrink_hits = 0;
+
+    // what the buffer went through; written by its owner, read by Metrics()
+    MetricCounter grows;
+    MetricCounter shrinks;
+    MetricCounter compactions;
+    MetricCounter bytes_moved;      // copied growing, shrinking and compacting
+    MetricCounter capacity_high;    // the most storage it ever held
     
     /**
      * @brief computes the next Exponential Moving Average with pre-kooked constant
@@ -165,22 +175,48 @@ struct BufferStats
 };
 
 
+//===============================================================================|
+/**
+ * @brief releases buffer storage to where it came from; either back to the
+ *  shared slab it was borrowed from or to the system.
+ */
+struct BoltBufDeleter
+{
+    BufferSlab* slab = nullptr;
+    size_t size = 0;                // as mapped, what goes back to the system
+    PageKind kind = PageKind::Heap;
+    size_t asked = 0;               // the slab class it was borrowed as
+
+    void operator()(u8* ptr) const
+    {
+        if (slab) slab->Return({ ptr, size, kind, asked });
+        else PageAlloc::Release(ptr, size, kind);
+    } // end operator()
+};
+
+
 //===============================================================================|
 /**
  * @brief defines a recv buffer structure for bolt PackStream with growing and/or
  *  shrinking capacity optimized for hardware viz cache alignmened storage and 
  *  prefetch hints.
+ *
+ * When given a BufferSlab the storage is borrowed from it in the slab's size
+ *  classes, and the buffer starts out parked; i.e. without storage until it is
+ *  first written to. An empty buffer may be parked again to hand its block back.
  */
 class alignas(CACHE_LINE_SIZE) BoltBuf
 {
 public:
 
-    BoltBuf(const size_t _capacity = 8192)
-        : capacity{Align_Capacity(_capacity)},
-          raw_ptr{Allocate_Aligned(capacity)},
+    BoltBuf(const size_t _capacity = 8192, BufferSlab* _slab = nullptr)
+        : slab{_slab},
+          capacity{Fit_Capacity(_capacity, _slab)},
+          raw_ptr{_slab ? Storage{nullptr, BoltBufDeleter{_slab, 0}} : Allocate_Aligned(capacity)},
           data{raw_ptr.get()},
           write_offset{0}, read_offset{0} {
-            assert(data);
+            assert(data || slab);
+            if (data) stat.capacity_high.Max(capacity);
     } // end Bolt Buf
 
     BoltBuf(const BoltBuf&) = delete;
@@ -268,6 +304,16 @@ public:
         return capacity;
     } // end Capacity
 
+
+    /**
+     * @brief the adaptive stats, along with how often it grew, shrank and got
+     *  compacted
+     */
+    inline const BufferStats& Stats() const
+    {
+        return stat;
+    } // end Stats
+
     
     /**
      * @brief return's true if buffer is empty
@@ -292,12 +338,16 @@ public:
      * 
      * @param data to write
      * @param len length of data to write
+     *
+     * @return false if there's no room to be had, i.e. the slab won't lend the
+     *  storage back or it can't grow; nothing is written then
      */
-    inline void Write(const u8 *dat, const size_t len)
+    [[nodiscard]] inline bool Write(const u8 *dat, const size_t len)
     {
-        Ensure_Space(len);
+        if (!Ensure_Space(len)) return false;
         iCpy(data + write_offset, dat, len);
         write_offset += len;
+        return true;
     } // end Write
 
     
@@ -324,7 +374,7 @@ public:
 	 */
     inline void Write_At(const u32 pos, const u8 *ptr, const size_t len)
     {
-        if (pos + len <= capacity)
+        if (data && pos + len <= capacity)
             iCpy(&data[pos], ptr, len);
     } // end Write_At
 
@@ -338,6 +388,7 @@ public:
      */
     inline int Grow()
     {
+        if (!data) return Unpark() ? 0 : -1;
         size_t new_capacity = capacity << 1;
 
         auto new_raw_ptr = Allocate_Aligned(new_capacity);
@@ -346,6 +397,7 @@ public:
 
         u8* new_data = new_raw_ptr.get();
         size_t used = write_offset - read_offset;
+        LB_PROBE2(buf_grow, capacity, new_capacity);
 
 #ifdef _DEBUG
         std::cout << "Buffer grow: " << capacity <<
@@ -357,7 +409,10 @@ public:
 
         raw_ptr = std::move(new_raw_ptr);
         data = new_data;
+        stat.bytes_moved.Add(capacity);
         capacity = new_capacity;
+        stat.grows.Add();
+        stat.capacity_high.Max(capacity);
 
         /*write_offset = used;
         read_offset = 0;*/
@@ -374,11 +429,11 @@ public:
 	 */
     inline int Shrink()
     {
-        if (capacity == MIN_CAPACITY)
+        if (capacity <= Fit_Capacity(MIN_CAPACITY, slab) || !data)
             return 0;
 
         size_t used = write_offset - read_offset;
-        size_t target_capacity = Align_Capacity(std::max(used << 1, MIN_CAPACITY));
+        size_t target_capacity = Fit_Capacity(std::max(used << 1, MIN_CAPACITY), slab);
 
         auto new_raw_ptr = Allocate_Aligned(target_capacity);
         if (!new_raw_ptr)
@@ -396,6 +451,8 @@ public:
         raw_ptr = std::move(new_raw_ptr);
         data = new_data;
         capacity = target_capacity;
+        stat.shrinks.Add();
+        stat.bytes_moved.Add(used);
 
         write_offset = used;
         read_offset = 0;
@@ -419,6 +476,7 @@ public:
 	 */
     inline void Append(BoltBuf& encoded)
     {
+        if (!Unpark()) return;
         if (write_offset + encoded.Size() > capacity)
             if (!Try_Grow())
                 return;
@@ -479,20 +537,104 @@ public:
         if (write_offset > read_offset)
         {
             size_t whats_left = write_offset - read_offset;
+            LB_PROBE2(buf_compact, whats_left, capacity);
             iCpy(Data(), Read_Ptr(), whats_left);
+            stat.bytes_moved.Add(whats_left);
 
             read_offset = 0;
             write_offset = whats_left;
         } // end if saftey net
 
+        stat.compactions.Add();
         return true;
     } // end Compact
 
 
+    /**
+     * @brief like Compact() but towards offset rather than the start; whatever
+     *  is left unread is moved down to offset, dropping what was consumed since.
+     *  Lets a stream reuse the same stretch of buffer over and over while keeping
+     *  everything before offset (i.e. earlier results) in place.
+     *
+     * @param offset where the unread bytes should start; at most the read offset
+     */
+    inline void Rewind(const size_t offset)
+    {
+        if (offset >= read_offset) return;      // nothing consumed past offset
+
+        size_t whats_left = write_offset - read_offset;
+        if (whats_left > 0)
+            memmove(data + offset, data + read_offset, whats_left);
+
+        read_offset = offset;
+        write_offset = offset + whats_left;
+    } // end Rewind
+
+
+    /**
+     * @brief hands the storage back to the slab while the buffer is empty so that
+     *  idle connections don't pin memory. The capacity is kept as the size to
+     *  borrow again on Unpark(), unless the slab is over its limit when it drops
+     *  back to MIN_CAPACITY (counted as a shrink). Anything decoded lazily out of
+     *  this buffer (i.e. BoltResult) must be done with before parking.
+     *
+     * @return true if parked alas false if not slab backed or not empty
+     */
+    inline bool Park()
+    {
+        if (!slab || !data || !Empty())
+            return false;
+
+        const size_t floor = Fit_Capacity(MIN_CAPACITY, slab);
+        if (capacity > floor && slab->Over_Limit())
+        {
+            capacity = floor;
+            stat.shrinks.Add();
+        } // end if over limit
+
+        raw_ptr.reset();
+        data = nullptr;
+        read_offset = write_offset = 0;
+        return true;
+    } // end Park
+
+
+    /**
+     * @brief borrows storage back from the slab if parked
+     *
+     * @return true if buffer has storage, false if the slab refused (memory cap)
+     */
+    inline bool Unpark()
+    {
+        if (data) return true;
+
+        auto new_raw_ptr = Allocate_Aligned(capacity);
+        if (!new_raw_ptr)
+            return false;
+
+        raw_ptr = std::move(new_raw_ptr);
+        data = raw_ptr.get();
+        stat.capacity_high.Max(capacity);
+        return true;
+    } // end Unpark
+
+
+    /**
+     * @brief return's true if the buffer currently holds no storage
+     */
+    inline bool Is_Parked() const
+    {
+        return data == nullptr;
+    } // end Is_Parked
+
+
 private:
 
+    using Storage = std::unique_ptr<uint8_t[], BoltBufDeleter>;
+
+    BufferSlab* slab;       // optional shared slab storage is borrowed from
     size_t capacity;
-    std::unique_ptr<uint8_t[], decltype(&std::free)> raw_ptr;
+    Storage raw_ptr;
     u8 *data;
     size_t write_offset;
     size_t read_offset;
@@ -505,15 +647,20 @@ private:
 	 */
     inline bool Try_Grow()
     {
+        if (!data) return Unpark();
         size_t new_capacity = capacity << 1;
         auto new_ptr = Allocate_Aligned(new_capacity);
         if (!new_ptr)
             return false;
 
+        LB_PROBE2(buf_grow, capacity, new_capacity);
         iCpy(new_ptr.get(), data, write_offset);  // preserve written data
         raw_ptr = std::move(new_ptr);
         data = raw_ptr.get();
         capacity = new_capacity;
+        stat.grows.Add();
+        stat.bytes_moved.Add(write_offset);
+        stat.capacity_high.Max(capacity);
         return true;
     } // end Try_Grow
 
@@ -525,7 +672,8 @@ private:
      */
     inline bool Ensure_Space(const size_t required)
     {
-        if (Writable_Size() < required)
+        if (!Unpark()) return false;
+        while (Writable_Size() < required)      // doubled as often as it takes
             if (!Try_Grow()) return false;
 
         return true;
@@ -545,16 +693,29 @@ private:
 
 
     /**
-     * @brief Allocates an aligned buffer size
+     * @brief rounds the capacity up to what the storage would actually hold; the
+     *  slab size class if slab backed or the next cache line otherwise.
+     *
+     * @param n size of storage
+     * @param pslab the slab if any
+     */
+    static size_t Fit_Capacity(size_t n, BufferSlab* pslab)
+    {
+        return pslab ? BufferSlab::Block_Size(n) : Align_Capacity(n);
+    } // end Fit_Capacity
+
+
+    /**
+     * @brief Allocates an aligned buffer size, from the slab if there is one alas
+     *  under the process wide page policy (see PageAlloc).
      * 
      * @param size of the buffer 
      */
-    static std::unique_ptr<uint8_t[], decltype(&std::free)> Allocate_Aligned(size_t size)
+    Storage Allocate_Aligned(size_t size) const
     {
-        void *ptr = nullptr;
-        if (posix_memalign(&ptr, CACHE_LINE_SIZE, size) != 0)
-            return {nullptr, std::free};
-        return {reinterpret_cast<u8*>(ptr), std::free};
+        PageBlock blk = slab ? slab->Borrow(BufferSlab::Block_Size(size)) :
+            PageAlloc::Allocate(size);
+        return { blk.ptr, BoltBufDeleter{slab, blk.size, blk.kind, blk.asked} };
     } // end Allocate_Aligned
 
 
@@ -3,7 +3,7 @@
  * 
  * @version 1.0
  * @date created 13th of April 2025, Sunday.
- * @date updated 9th of Feburary 2026, Monday.
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -27,6 +27,22 @@
 
 
 
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief where a message sits on the wire. Bolt splits messages into chunks of
+ *  upto 64K each, [size][payload] repeated, and ends them with an empty chunk.
+ */
+struct BoltFrame
+{
+    u32 wire_size{ 0 };     // bytes on the wire; chunk headers and 00 00 end marker included
+    u32 payload_size{ 0 };  // message bytes once the chunk headers are stripped
+    u32 chunks{ 0 };        // number of non empty chunks
+};
+
+
+
 
 //===============================================================================|
 //          CLASS
@@ -61,8 +77,7 @@ public:
         
         while (size > pos - start_pos) 
         {
-            u8 tag = *pos;
-            if (!jump_table[tag](pos, out))    
+            if (!Decode_Value(pos, out))    
                 return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT, 
                     LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
         } // end while
@@ -92,8 +107,7 @@ public:
         u8* pos = view_start + 2;
         while (chunk_size > (pos - view_start))
         {
-            u8 tag = *pos;
-            if (!jump_table[tag](pos, v))
+            if (!Decode_Value(pos, v))
                 return -1;
         } // end while
 
@@ -125,8 +139,7 @@ public:
         u8* pos = start;
         while (msg.chunk_size > (pos - start))
         {
-            u8 tag = *pos;
-            if (!jump_table[tag](pos, msg.msg))
+            if (!Decode_Value(pos, msg.msg))
                 return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
                     LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
         } // end while
@@ -145,6 +158,11 @@ public:
      *  the recv buffer. The function does not partial decode and expects the
      *  caller to make sure buffer is pointing at a full bolt message.
      *
+     *  Single chunk messages, by far the common case, are decoded in place. A
+     *  message split over several chunks is gathered into the decoder's scratch
+     *  buffer first and decoded from there; values decoded out of it stay valid
+     *  until the next multi-chunk message is decoded.
+     *
      * @param view_start pointer to the start of the view
      * @param msg reference to output decoded message
      *
@@ -153,15 +171,18 @@ public:
      */
     LBStatus Decode(u8* view_start, BoltMessage &msg)
     {
-		msg.msg.buf = &buf;
         u16 chunk = *((u16*)view_start);
-        msg.chunk_size = ntohs(chunk);
+        u16 first = ntohs(chunk);
+        if (*(u16*)(view_start + 2 + first) != 0x00)
+            return Decode_Gathered(view_start, msg);
+
+		msg.msg.buf = &buf;
+        msg.chunk_size = first;
 
         u8* pos = view_start + 2;
         while (msg.chunk_size > (pos - view_start))
         {
-            u8 tag = *pos;
-            if (!jump_table[tag](pos, msg.msg))
+            if (!Decode_Value(pos, msg.msg))
                 return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT, 
                     LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
         } // end while
@@ -192,7 +213,112 @@ public:
 	} // end Decode with offset
 
 
+    /**
+     * @brief the buffer this decoder reads from; messages are decoded in place
+     *  so offsets handed out by the connection are relative to its Data().
+     */
+    BoltBuf& Get_Buf() { return buf; }
+
+
+    /**
+     * @brief walks the chunks of the message at view without decoding it.
+     *
+     * @param view start of the message, i.e. its first chunk header
+     * @param avail bytes available from view
+     * @param frame receives the message's wire and payload sizes
+     *
+     * @returns LB_OK_INFO with the wire size, or LB_HASMORE if the message isn't
+     *  all in yet.
+     */
+    static LBStatus Frame(const u8* view, const size_t avail, BoltFrame& frame)
+    {
+        size_t pos = 0;
+        frame = {};
+
+        for (;;)
+        {
+            if (avail - pos < 2)
+                return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT);
+
+            u16 n = ntohs(*(const u16*)(view + pos));
+            pos += 2;
+            if (n == 0) break;      // end of message
+
+            if (avail - pos < n)
+                return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT);
+
+            pos += n;
+            frame.payload_size += n;
+            frame.chunks++;
+        } // end for
+
+        frame.wire_size = static_cast<u32>(pos);
+        return LBOK_INFO(frame.wire_size);
+    } // end Frame
+
+
+    /**
+     * @brief copies the chunk payloads of a framed message back to back into the
+     *  scratch buffer; the previous gathered message is overwritten.
+     *
+     * @param view start of the message
+     * @param frame the message's frame as given by Frame()
+     *
+     * @returns pointer to the contiguous payload or nullptr if out of memory
+     */
+    u8* Gather(const u8* view, const BoltFrame& frame)
+    {
+        scratch.Reset();
+        if (!scratch.Unpark())
+            return nullptr;
+        while (scratch.Capacity() < frame.payload_size)
+            if (scratch.Grow() < 0) return nullptr;
+
+        const u8* pos = view;
+        for (u32 i = 0; i < frame.chunks; i++)
+        {
+            u16 n = ntohs(*(const u16*)pos);
+            if (!scratch.Write(pos + 2, n)) return nullptr;
+            pos += 2 + n;
+        } // end for chunks
+
+        return scratch.Data();
+    } // end Gather
+
+
 private:
 
     BoltBuf& buf;
+    BoltBuf scratch{ 64 };      // multi-chunk messages are gathered here
+
+
+    /**
+     * @brief the slow path of Decode for messages spanning several chunks;
+     *  gathers the payload and decodes it from the scratch buffer.
+     */
+    LBStatus Decode_Gathered(u8* view_start, BoltMessage& msg)
+    {
+        BoltFrame frame;
+        LBStatus rc = Frame(view_start, SIZE_MAX, frame);
+        if (!LB_OK(rc))
+            return rc;
+
+        u8* pos = Gather(view_start, frame);
+        if (!pos)
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+                LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM);
+
+        msg.msg.buf = &scratch;
+        msg.chunk_size = static_cast<u16>(std::min<u32>(frame.payload_size, 0xFFFF));
+
+        u8* end = pos + frame.payload_size;
+        while (pos < end)
+        {
+            if (!Decode_Value(pos, msg.msg))
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
+        } // end while
+
+        return LBOK_INFO(frame.wire_size);
+    } // end Decode_Gathered
 }; 
\ No newline at end of file
@@ -3,7 +3,7 @@
  * 
  * @version 1.0
  * @date created 13th of April 2025, Sunday.
- * @date updated 4th of March 2026, Wednesday.
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -15,6 +15,7 @@
 #include "neoerr.h"
 #include "bolt/bolt_buf.h"
 #include "bolt/bolt_message.h"
+#include "bolt/bolt_params.h"
 #include "utils/utils.h"
 
 
@@ -58,6 +59,8 @@ public:
         if (!Has_Free(val, len))
             return LB_Make(LBAction::LB_FLUSH, LBDomain::LB_DOM_MEMORY);
 
+        bool written = true;    // false if the buffer couldn't make room part way
+
         if constexpr (std::is_same_v<T, std::nullptr_t>) 
         {
             Encode_Null();
@@ -68,20 +71,20 @@ public:
         } // end else bool
         else if constexpr (std::is_same_v<T, std::string>) 
         {
-            Encode_String(val);
+            written = Encode_String(val);
         } // end else string
         else if constexpr (std::is_same_v<T, const char*>) 
         {
-            Encode_String(val, len);
+            written = Encode_String(val, len);
         } // end else string
         else if constexpr (std::is_same_v<T, std::vector<u8>>) 
         {
-            Encode_Bytes(val);
+            written = Encode_Bytes(val);
         } // end else vector
         else if constexpr (std::is_same_v<T, BoltMessage>)
         {
             //std::cout << "Encode message" << std::endl;
-            Encode_Message(val);
+            written = Encode_Message(val);
         } // end else encode message
         else if constexpr (std::is_same_v<T, BoltValue>)
         {
@@ -106,24 +109,24 @@ public:
                     break;
 
                 case BoltType::String:
-                    Encode_String(val.str_val.str, val.str_val.length);
+                    written = Encode_String(val.str_val.str, val.str_val.length);
                     break;
 
                 case BoltType::Bytes:
-                    Encode_Bytes(val);
+                    written = Encode_Bytes(val);
                     break;
 
                 /** compound primitives */
                 case BoltType::List:
-                    Encode_List(val);
+                    written = Encode_List(val);
                     break;
 
                 case BoltType::Map:
-                    Encode_Map(val);
+                    written = Encode_Map(val);
                     break;
 
                 case BoltType::Struct:
-                    Encode_Struct(val);
+                    written = Encode_Struct(val);
                     break;
             } // end switch
         } // end else if
@@ -140,9 +143,78 @@ public:
             std::cout << "Type: " << typeid(val).name() << "\n";
         } // end else
 
+        if (!written)
+            return LB_Make(LBAction::LB_FLUSH, LBDomain::LB_DOM_MEMORY);
         return LB_Make();
     } // end Encode
 
+
+    /**
+     * @brief encodes a RUN message with typed parameters straight into the buffer;
+     *  no BoltValue tree is built for the parameters. The exact message size is
+     *  summed up front so space is made at most once, keys are copied in their
+     *  pre-packed form and values are written in place.
+     *
+     * @param cypher the query string
+     * @param len length of the query string
+     * @param extras optional extra map (db, bookmarks, mode ...); empty if null
+     * @param params parameters made via P()
+     *
+     * @return LB_OK on success, alas LB_FLUSH when out of buffer space; nothing
+     *  of the message is left in the buffer then. Bodies larger than a chunk are
+     *  split as Encode_Message() does.
+     */
+    template<Bolt_Param_Type... Ps>
+    LBStatus Encode_Run(const char* cypher, const size_t len, const BoltValue* extras,
+        const Ps&... params)
+    {
+        const size_t extras_size = extras ? std::max<size_t>(extras->size, 1) : 1;
+        const size_t body = 2 + Pack::Header_Size(len) + len +
+            Pack::Header_Size(sizeof...(Ps)) + (params.Size() + ... + size_t(0)) +
+            extras_size;
+
+        // header + body + end marker, and a header for every chunk past the first
+        const size_t need = body + 4 + (body - 1) / BOLT_MAX_CHUNK_SIZE * sizeof(u16);
+        if (!buf.Unpark()) return LB_Make(LBAction::LB_FLUSH, LBDomain::LB_DOM_MEMORY);
+        while (buf.Writable_Size() <= need)
+            if (buf.Grow() < 0) return LB_Make(LBAction::LB_FLUSH, LBDomain::LB_DOM_MEMORY);
+
+        const size_t start = buf.Get_Write_Offset();
+        u8* p = buf.Write_Ptr() + 2;
+        *p++ = BOLT_STRUCT | 3;
+        *p++ = BOLT_RUN;
+        p = Pack_Traits<std::string_view>::Write(p, std::string_view(cypher, len));
+        p = Pack::Put_Header(p, BOLT_MAPTINY, BOLT_MAP8, sizeof...(Ps));
+        ((p = params.Write(p)), ...);
+        buf.Advance(p - buf.Write_Ptr());
+
+        auto drop = [&] { buf.Skip(-static_cast<ptrdiff_t>(buf.Get_Write_Offset() - start)); };
+        if (!extras) Write_Bits<u8>(BOLT_MAPTINY);
+        else if (!LB_OK(Encode(*extras)))
+        {
+            drop();
+            return LB_Make(LBAction::LB_FLUSH, LBDomain::LB_DOM_MEMORY);
+        } // end if no room for the extras
+
+        const size_t size = buf.Get_Write_Offset() - start - 2;
+        if (size > BOLT_MAX_CHUNK_SIZE)
+        {
+            if (!Split_Chunks(start + 2, size))
+            {
+                drop();
+                return LB_Make(LBAction::LB_FLUSH, LBDomain::LB_DOM_MEMORY);
+            } // end if no room
+        } // end if too large for a chunk
+        else
+        {
+            const u16 header = htons(static_cast<u16>(size));
+            buf.Write_At(start, reinterpret_cast<const u8*>(&header), sizeof(u16));
+        } // end else single chunk
+
+        Write_Bits<u16>(0);     // end of message
+        return LB_Make();
+    } // end Encode_Run
+
 private:
 
     BoltBuf &buf;
@@ -197,6 +269,9 @@ private:
         else if constexpr (std::is_same_v<T, double>) size = 9;
         else return false;
 
+        // borrow storage back if the buffer was parked while idle
+        if (!buf.Unpark()) return false;
+
         // attempt to grow if 2x, if size is not enough
         if (size >= buf.Writable_Size())
             if (buf.Grow() < 0) return false;
@@ -244,17 +319,17 @@ private:
         else if (value >= INT16_MIN && value <= INT16_MAX) 
         {
             Write_Bits<u8>(BOLT_INT16);
-            Write_Bits<s16>(static_cast<s16>(htons(value)));
+            Write_Bits<s16>(static_cast<s16>(value));
         } // end else if words
         else if (value >= INT32_MIN && value <= INT32_MAX) 
         {
             Write_Bits<u8>(BOLT_INT32);
-            Write_Bits<s32>(static_cast<s32>(htonl(value)));
+            Write_Bits<s32>(static_cast<s32>(value));
         } // end else if value 32-bits
         else 
         {
             Write_Bits<u8>(BOLT_INT64);
-            Write_Bits<s64>(static_cast<s64>(htonll(value)));
+            Write_Bits<s64>(static_cast<s64>(value));
         } // end else quad
     } // end Encode_Int
 
@@ -278,8 +353,10 @@ private:
      * 
      * @param bytes the bytes to write
      * @param len length of the bytes
+     *
+     * @return false if the buffer couldn't make room for them
      */
-    inline void Encode_Bytes(const std::vector<u8> &bytes) 
+    inline bool Encode_Bytes(const std::vector<u8> &bytes) 
     {
         size_t len = bytes.size();
         if (len <= 255) 
@@ -289,15 +366,15 @@ private:
         else if (len <= 0xFFFF) 
         {
             Write_Bits<u8>(BOLT_BYTES16);
-            Write_Bits<u16>(static_cast<u16>(htons(len)));
+            Write_Bits<u16>(static_cast<u16>(len));
         } // end else if 16-bits
         else 
         {
             Write_Bits<u8>(BOLT_BYTES32);
-            Write_Bits<u32>(static_cast<u32>(htonl(len)));
+            Write_Bits<u32>(static_cast<u32>(len));
         } // end else
 
-        buf.Write(bytes.data(), len);
+        return buf.Write(bytes.data(), len);
     } // end Encode bytes
     
 
@@ -305,8 +382,10 @@ private:
      * @brief encode's an array of bytes.
      * 
      * @param val point to the start of the array
+     *
+     * @return false if the buffer couldn't make room for them
      */
-    inline void Encode_Bytes(const BoltValue &val) 
+    inline bool Encode_Bytes(const BoltValue &val) 
     {
         size_t len = val.byte_val.size;
         if (len <= 255) {
@@ -314,15 +393,15 @@ private:
         } // end if <= 255
         else if (len <= 0xFFFF) {
             Write_Bits<u8>(BOLT_BYTES16);
-            Write_Bits<u16>(static_cast<u16>(htons(len)));
+            Write_Bits<u16>(static_cast<u16>(len));
         } // end else if 16-bits
         else 
         {
             Write_Bits<u8>(BOLT_BYTES32);
-            Write_Bits<u32>(static_cast<u32>(htonl(len)));
+            Write_Bits<u32>(static_cast<u32>(len));
         } // end else
 
-        buf.Write(val.byte_val.ptr, len);
+        return buf.Write(val.byte_val.ptr, len);
     } // end Encode bytes
 
     
@@ -331,8 +410,10 @@ private:
      * 
      * @param str the string to encode
      * @param len length of the characters/string
+     *
+     * @return false if the buffer couldn't make room for it
      */
-    inline void Encode_String(const char *str, const size_t len)
+    inline bool Encode_String(const char *str, const size_t len)
     {
         if (len <= 0x0F) 
         {
@@ -345,15 +426,15 @@ private:
         else if (len <= 0xFFFF)
         {
             Write_Bits<u8>(BOLT_STRING16);
-            Write_Bits<u16>(htons(len));
+            Write_Bits<u16>(static_cast<u16>(len));
         } // end else if 16-bit
         else 
         {
             Write_Bits<u8>(BOLT_STRING32);
-            Write_Bits<u32>(htonl(len));
+            Write_Bits<u32>(static_cast<u32>(len));
         } // end else upto 32-bits
 
-        buf.Write(reinterpret_cast<const u8*>(str), len);
+        return buf.Write(reinterpret_cast<const u8*>(str), len);
     } // end Encode_String
 
 
@@ -362,9 +443,9 @@ private:
      * 
      * @param str the string to encode
      */
-    inline void Encode_String(const std::string &str) 
+    inline bool Encode_String(const std::string &str) 
     {
-        Encode_String(&str[0], str.length());
+        return Encode_String(&str[0], str.length());
     } // end Encode_String
 
 
@@ -372,8 +453,10 @@ private:
      * @brief encode's a list 
      * 
      * @param list to encode
+     *
+     * @return false if the buffer couldn't make room for an item
      */
-    inline void Encode_List(const BoltValue& list) 
+    inline bool Encode_List(const BoltValue& list) 
     {
         size_t len = list.list_val.size;
         
@@ -389,26 +472,30 @@ private:
         else if (len <= 0xFFFF) 
         {
             Write_Bits<u8>(BOLT_LIST16);
-            Write_Bits<u16>(static_cast<u16>(htons(len)));
+            Write_Bits<u16>(static_cast<u16>(len));
         } // end else if 16-bit
         else 
         {
             Write_Bits<u8>(BOLT_LIST32);
-            Write_Bits<u32>(static_cast<u32>(htonl(len)));
+            Write_Bits<u32>(static_cast<u32>(len));
         } // end else
 
         for (int i{0}; i < len; i++) 
         {
             auto* p = list.pool->Get(list.list_val.offset + i);
-            Encode(*p);
+            if (!LB_OK(Encode(*p))) return false;
         } // end for
+
+        return true;
     } // end for
 
 
     /**
      * @brief encode's map/dicitionary objects
+     *
+     * @return false if the buffer couldn't make room for an entry
      */
-    inline void Encode_Map(const BoltValue &map)
+    inline bool Encode_Map(const BoltValue &map)
     {
         size_t count = map.map_val.size;
         if (count <= 15) 
@@ -435,17 +522,21 @@ private:
         {
             auto* key = map.pool->Get(map.map_val.key_offset + i);
             auto* value = map.pool->Get(map.map_val.value_offset + i);
-            Encode(*key);    // key
-            Encode(*value);  // value
+            if (!LB_OK(Encode(*key)) || !LB_OK(Encode(*value)))
+                return false;
         } // end 
+
+        return true;
     } // end Encode_Map
     
 
 
     /**
      * @brief encode's struct elements
+     *
+     * @return false if the buffer couldn't make room for a field
      */
-    inline void Encode_Struct(const BoltValue &val) 
+    inline bool Encode_Struct(const BoltValue &val) 
     {
         size_t len = val.struct_val.size;
         Write_Bits<u8>((BOLT_STRUCT | static_cast<u8>(len)));
@@ -454,32 +545,92 @@ private:
         for (int i = 0; i < len; i++)
         {
             auto* field = val.pool->Get(val.struct_val.offset + i);
-            Encode(*field);
+            if (!LB_OK(Encode(*field))) return false;
         } // end for 
+
+        return true;
     } // end Encode_Struct
 
 
     /**
 	 * @brief encodes a message which is really a struct type with a header
-	 *  and a tail padding.
+	 *  and a tail padding. Whatever part of it made it into the buffer is taken
+     *  back should the buffer run out of room, rather than send it misframed.
+     *
+     * @return false if the buffer couldn't make room for it
      */
-    inline void Encode_Message(const BoltMessage &msg)
+    inline bool Encode_Message(const BoltMessage &msg)
     {
         buf.Skip(2);        // jump the first two bytes
 
-        u8* start_addr = buf.Write_Ptr();
-        Encode(msg.msg);
-        u8* end_addr = buf.Write_Ptr();
+        size_t start = buf.Get_Write_Offset();
+        auto drop = [&] { buf.Skip(-static_cast<ptrdiff_t>(buf.Get_Write_Offset() - start + 2)); };
+        if (!LB_OK(Encode(msg.msg)))
+        {
+            drop();
+            return false;
+        } // end if no room
+        size_t size = buf.Get_Write_Offset() - start;
+
+        if (size > BOLT_MAX_CHUNK_SIZE)
+        {
+            if (!Split_Chunks(start, size))
+            {
+                drop();
+                return false;
+            } // end if no room
+        } // end if too large for a chunk
+        else
+        {
+            u16 header = htons(static_cast<u16>(size));
+            iCpy(buf.Data() + start - 2, (const u8*)&header, sizeof(u16));
+        } // end else single chunk
 
-        u16 size = static_cast<u16>((end_addr - start_addr)); 
-        size = htons(size);
+        if (!buf.Write((const u8*)&msg.padding, sizeof(u16)))
+        {
+            drop();
+            return false;
+        } // end if no room for the end marker
 
-        iCpy(start_addr - 2, (const u8*)&size, sizeof(u16));
-        buf.Write((const u8*)&msg.padding, sizeof(u16));
         //Dump_Hex((const char*)buf.Data(), buf.Size());
+        return true;
     } // end Encode_Message
 
 
+    /**
+     * @brief cuts a message body larger than a chunk into full chunks plus a
+     *  remainder, opening a gap for each extra header by shifting the body from
+     *  the back; the header of the first chunk is the one Encode_Message skipped.
+     *
+     * @param start offset of the message body in buf
+     * @param size bytes in the body
+     *
+     * @return false if the buffer can't grow to fit the extra headers
+     */
+    inline bool Split_Chunks(const size_t start, const size_t size)
+    {
+        const size_t extra = (size - 1) / BOLT_MAX_CHUNK_SIZE;
+        while (buf.Writable_Size() < (extra + 1) * sizeof(u16))    // + the end marker
+            if (buf.Grow() < 0) return false;
+
+        u8* body = buf.Data() + start;
+        for (size_t i = extra; i > 0; i--)
+        {
+            size_t from = i * BOLT_MAX_CHUNK_SIZE;
+            size_t len = std::min(BOLT_MAX_CHUNK_SIZE, size - from);
+            memmove(body + from + i * 2, body + from, len);
+
+            u16 header = htons(static_cast<u16>(len));
+            iCpy(body + from + i * 2 - 2, (const u8*)&header, sizeof(u16));
+        } // end for chunks
+
+        u16 header = htons(static_cast<u16>(BOLT_MAX_CHUNK_SIZE));
+        iCpy(body - 2, (const u8*)&header, sizeof(u16));
+        buf.Advance(extra * sizeof(u16));
+        return true;
+    } // end Split_Chunks
+
+
     /**
      * @brief write's a btyes into buffer
      * 
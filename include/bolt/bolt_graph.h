@@ -0,0 +1,514 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <string_view>
+#include "bolt/bolt_row.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr u8 BOLT_NODE = 0x4E;              // Node struct tag
+constexpr u8 BOLT_RELATIONSHIP = 0x52;      // Relationship struct tag
+constexpr u8 BOLT_UNBOUND_REL = 0x72;       // UnboundRelationship struct tag
+constexpr u8 BOLT_PATH = 0x50;              // Path struct tag
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+namespace Unpack
+{
+    /**
+     * @brief steps over k complete values
+     *
+     * @return pointer to the value after them or nullptr when malformed
+     */
+    inline const u8* Skip_N(const u8* p, const u8* end, u32 k)
+    {
+        while (k-- && p)
+            p = Skip(p, end);
+        return p;
+    } // end Skip_N
+
+
+    /**
+     * @brief reads an optional string field; a null reads as empty
+     */
+    inline bool Read_Id_String(const u8*& p, const u8* end, std::string_view& s)
+    {
+        if (Read_Null(p, end)) { s = {}; return true; }
+        return Read_String(p, end, s);
+    } // end Read_Id_String
+} // end Unpack
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief the labels of a node, left in place; iterate for string_views or ask
+ *  Has(). Nothing is read until then.
+ */
+struct BoltLabels
+{
+    const u8* p = nullptr;      // first label
+    const u8* stop = nullptr;   // end of the message
+    u32 count = 0;              // number of labels
+
+    struct iterator
+    {
+        const u8* p;
+        const u8* end;
+        u32 left;
+        std::string_view label;
+        bool done = false;
+
+        iterator(const u8* p, const u8* end, u32 left) : p(p), end(end), left(left) { Next(); }
+
+        std::string_view operator*() const { return label; }
+        iterator& operator++() { Next(); return *this; }
+        bool operator!=(const iterator& other) const { return done != other.done; }
+
+        void Next()
+        {
+            if (left == 0 || !Unpack::Read_String(p, end, label)) { done = true; return; }
+            left--;
+        } // end Next
+    };
+
+    iterator begin() const { return iterator(p, stop, count); }
+    iterator end() const { return iterator(p, stop, 0); }
+
+    size_t size() const { return count; }
+
+
+    /**
+     * @brief true when label is one of them
+     */
+    bool Has(std::string_view label) const
+    {
+        for (std::string_view l : *this)
+            if (l == label) return true;
+        return false;
+    } // end Has
+};
+
+
+/**
+ * @brief the property map of a node or relationship, left in place; keys are
+ *  compared as they are met and only the value asked for is decoded.
+ */
+struct BoltProps
+{
+    const u8* p = nullptr;      // first key
+    const u8* stop = nullptr;   // end of the message
+    u32 count = 0;              // number of key/value pairs
+
+    size_t size() const { return count; }
+
+
+    /**
+     * @brief finds key
+     *
+     * @return pointer to its value, nullptr when absent or malformed
+     */
+    const u8* Find(std::string_view key) const
+    {
+        const u8* q = p;
+        for (u32 i = 0; i < count && q; i++)
+        {
+            std::string_view k;
+            if (!Unpack::Read_String(q, stop, k)) return nullptr;
+            if (k == key) return q;
+            q = Unpack::Skip(q, stop);
+        } // end for
+
+        return nullptr;
+    } // end Find
+
+
+    /**
+     * @brief reads the property key into v, as Fetch_As would a column
+     *
+     * @return false when absent or of another type; v is left alone
+     */
+    template<Bolt_Readable T>
+    bool Get(std::string_view key, T& v) const
+    {
+        const u8* q = Find(key);
+        return q && Row_Traits<T>::Read(q, stop, v);
+    } // end Get
+
+
+    /**
+     * @brief calls fn(key, value, stop) for every property, value pointing at
+     *  the packed value; stops early when fn returns false.
+     *
+     * @return false when the map is malformed or fn stopped it
+     */
+    template<typename Fn>
+    bool For_Each(Fn&& fn) const
+    {
+        const u8* q = p;
+        for (u32 i = 0; i < count; i++)
+        {
+            std::string_view k;
+            if (!Unpack::Read_String(q, stop, k) || !fn(k, q, stop)) return false;
+            if (!(q = Unpack::Skip(q, stop))) return false;
+        } // end for
+
+        return true;
+    } // end For_Each
+};
+
+
+/**
+ * @brief a Node read straight from the wire: Node{id, labels, properties,
+ *  element_id}. element_id is empty before Bolt 5.
+ */
+struct NodeView
+{
+    s64 id = -1;
+    std::string_view element_id;
+    BoltLabels labels;
+    BoltProps props;
+
+
+    /**
+     * @brief reads the fields of a Node struct whose header was already read
+     */
+    static bool Read_Fields(const u8*& p, const u8* end, const u8 tag, const u32 fields, NodeView& n)
+    {
+        if (tag != BOLT_NODE || fields < 3) return false;
+
+        const u8* q = p;
+        if (!Unpack::Read_Int(q, end, n.id)) return false;
+
+        if (!Unpack::Read_List(q, end, n.labels.count)) return false;
+        n.labels.p = q;
+        n.labels.stop = end;
+        if (!(q = Unpack::Skip_N(q, end, n.labels.count))) return false;
+
+        if (!Unpack::Read_Map(q, end, n.props.count)) return false;
+        n.props.p = q;
+        n.props.stop = end;
+        if (!(q = Unpack::Skip_N(q, end, 2 * n.props.count))) return false;
+
+        n.element_id = {};
+        if (fields > 3 && !Unpack::Read_Id_String(q, end, n.element_id)) return false;
+        if (!(q = Unpack::Skip_N(q, end, fields > 4 ? fields - 4 : 0))) return false;
+
+        p = q;
+        return true;
+    } // end Read_Fields
+
+
+    /**
+     * @brief reads a Node at p, moving p past it
+     */
+    static bool Read(const u8*& p, const u8* end, NodeView& n)
+    {
+        const u8* q = p;
+        u8 tag;
+        u32 fields;
+        if (!Unpack::Read_Struct(q, end, tag, fields) || !Read_Fields(q, end, tag, fields, n))
+            return false;
+
+        p = q;
+        return true;
+    } // end Read
+
+
+    /**
+     * @brief views a Node held by a BoltValue decoded off a buffer
+     */
+    static bool From(const BoltValue& v, NodeView& n);
+};
+
+
+/**
+ * @brief a Relationship or an UnboundRelationship read straight from the wire.
+ *  Unbound ones, as found in paths, have no ends of their own (start_id and
+ *  end_id -1) until PathView::Rel() fills them in.
+ */
+struct RelView
+{
+    s64 id = -1;
+    s64 start_id = -1;
+    s64 end_id = -1;
+    std::string_view type;
+    std::string_view element_id;
+    std::string_view start_element_id;
+    std::string_view end_element_id;
+    BoltProps props;
+    bool bound = true;      // false for an UnboundRelationship
+
+
+    /**
+     * @brief reads the fields of a Relationship{id, start, end, type, properties,
+     *  element_id, start_element_id, end_element_id} or UnboundRelationship{id,
+     *  type, properties, element_id} whose header was already read
+     */
+    static bool Read_Fields(const u8*& p, const u8* end, const u8 tag, const u32 fields, RelView& r)
+    {
+        const u8* q = p;
+        u32 known;
+        r = RelView();
+
+        if (tag == BOLT_RELATIONSHIP && fields >= 5)
+        {
+            if (!Unpack::Read_Int(q, end, r.id) || !Unpack::Read_Int(q, end, r.start_id) ||
+                !Unpack::Read_Int(q, end, r.end_id))
+                return false;
+            known = 5;
+        } // end if bound
+        else if (tag == BOLT_UNBOUND_REL && fields >= 3)
+        {
+            if (!Unpack::Read_Int(q, end, r.id)) return false;
+            r.bound = false;
+            known = 3;
+        } // end else if unbound
+        else return false;
+
+        if (!Unpack::Read_String(q, end, r.type)) return false;
+        if (!Unpack::Read_Map(q, end, r.props.count)) return false;
+        r.props.p = q;
+        r.props.stop = end;
+        if (!(q = Unpack::Skip_N(q, end, 2 * r.props.count))) return false;
+
+        if (fields > known)
+        {
+            if (!Unpack::Read_Id_String(q, end, r.element_id)) return false;
+            known++;
+            if (r.bound && fields >= known + 2)
+            {
+                if (!Unpack::Read_Id_String(q, end, r.start_element_id) ||
+                    !Unpack::Read_Id_String(q, end, r.end_element_id))
+                    return false;
+                known += 2;
+            } // end if ends
+        } // end if element ids
+
+        if (!(q = Unpack::Skip_N(q, end, fields - known))) return false;
+
+        p = q;
+        return true;
+    } // end Read_Fields
+
+
+    /**
+     * @brief reads either kind of relationship at p, moving p past it
+     */
+    static bool Read(const u8*& p, const u8* end, RelView& r)
+    {
+        const u8* q = p;
+        u8 tag;
+        u32 fields;
+        if (!Unpack::Read_Struct(q, end, tag, fields) || !Read_Fields(q, end, tag, fields, r))
+            return false;
+
+        p = q;
+        return true;
+    } // end Read
+
+
+    /**
+     * @brief views a relationship held by a BoltValue decoded off a buffer
+     */
+    static bool From(const BoltValue& v, RelView& r);
+};
+
+
+/**
+ * @brief a Path{nodes, rels, indices} read straight from the wire. Nothing but
+ *  where its three lists start is kept; walking the path reads the indices and
+ *  steps to the node or relationship they point at, in place.
+ *
+ *  For a path of Length() hops, Node(0) .. Node(Length()) are the nodes in path
+ *  order and Rel(0) .. Rel(Length() - 1) the relationships between them, each
+ *  given its start and end the way it points in the graph (which for a hop
+ *  traversed backwards is from Node(i + 1) to Node(i)).
+ */
+struct PathView
+{
+    const u8* nodes = nullptr;      // first of the distinct nodes
+    const u8* rels = nullptr;       // first of the distinct unbound relationships
+    const u8* indices = nullptr;    // first of the alternating rel/node indices
+    const u8* stop = nullptr;       // end of the message
+    u32 node_count = 0;
+    u32 rel_count = 0;
+    u32 index_count = 0;
+
+    size_t Length() const { return index_count / 2; }
+
+
+    /**
+     * @brief reads the fields of a Path struct whose header was already read
+     */
+    static bool Read_Fields(const u8*& p, const u8* end, const u8 tag, const u32 fields, PathView& path)
+    {
+        if (tag != BOLT_PATH || fields < 3) return false;
+
+        const u8* q = p;
+        path.stop = end;
+        if (!Unpack::Read_List(q, end, path.node_count) || path.node_count == 0) return false;
+        path.nodes = q;
+        if (!(q = Unpack::Skip_N(q, end, path.node_count))) return false;
+
+        if (!Unpack::Read_List(q, end, path.rel_count)) return false;
+        path.rels = q;
+        if (!(q = Unpack::Skip_N(q, end, path.rel_count))) return false;
+
+        if (!Unpack::Read_List(q, end, path.index_count) || (path.index_count & 1)) return false;
+        path.indices = q;
+        if (!(q = Unpack::Skip_N(q, end, path.index_count + fields - 3))) return false;
+
+        p = q;
+        return true;
+    } // end Read_Fields
+
+
+    /**
+     * @brief reads a Path at p, moving p past it
+     */
+    static bool Read(const u8*& p, const u8* end, PathView& path)
+    {
+        const u8* q = p;
+        u8 tag;
+        u32 fields;
+        if (!Unpack::Read_Struct(q, end, tag, fields) || !Read_Fields(q, end, tag, fields, path))
+            return false;
+
+        p = q;
+        return true;
+    } // end Read
+
+
+    /**
+     * @brief views a Path held by a BoltValue decoded off a buffer
+     */
+    static bool From(const BoltValue& v, PathView& path);
+
+
+    /**
+     * @brief the i'th node along the path, 0 being where it starts
+     *
+     * @return false when i is past the end or the path is malformed
+     */
+    bool Node(const size_t i, NodeView& n) const
+    {
+        if (i > Length()) return false;
+
+        s64 at = 0;
+        if (i > 0 && !Index(2 * i - 1, at)) return false;
+        if (at < 0 || at >= node_count) return false;
+
+        const u8* q = Unpack::Skip_N(nodes, stop, static_cast<u32>(at));
+        return q && NodeView::Read(q, stop, n);
+    } // end Node
+
+
+    /**
+     * @brief the i'th relationship along the path, with its start and end set
+     *  from the nodes on either side
+     *
+     * @return false when i is past the end or the path is malformed
+     */
+    bool Rel(const size_t i, RelView& r) const
+    {
+        s64 at;
+        if (i >= Length() || !Index(2 * i, at) || at == 0) return false;
+
+        const s64 which = (at < 0 ? -at : at) - 1;
+        if (which >= rel_count) return false;
+
+        const u8* q = Unpack::Skip_N(rels, stop, static_cast<u32>(which));
+        NodeView a, b;
+        if (!q || !RelView::Read(q, stop, r) || !Node(i, a) || !Node(i + 1, b)) return false;
+
+        // positive indices follow the path, negative ones were traversed backwards
+        if (at < 0) std::swap(a, b);
+        r.start_id = a.id;
+        r.end_id = b.id;
+        r.start_element_id = a.element_id;
+        r.end_element_id = b.element_id;
+        return true;
+    } // end Rel
+
+private:
+
+    /**
+     * @brief reads indices[k]
+     */
+    bool Index(const size_t k, s64& v) const
+    {
+        const u8* q = Unpack::Skip_N(indices, stop, static_cast<u32>(k));
+        return q && Unpack::Read_Int(q, stop, v);
+    } // end Index
+};
+
+
+/**
+ * @brief lets Fetch_As take graph values as columns, e.g.
+ *  std::tuple<NodeView, RelView, NodeView> or std::vector<NodeView> for a
+ *  collect(n), std::optional<NodeView> for an OPTIONAL MATCH.
+ */
+template<>
+struct Row_Traits<NodeView>
+{
+    static bool Read(const u8*& p, const u8* end, NodeView& v) { return NodeView::Read(p, end, v); }
+};
+
+template<>
+struct Row_Traits<RelView>
+{
+    static bool Read(const u8*& p, const u8* end, RelView& v) { return RelView::Read(p, end, v); }
+};
+
+template<>
+struct Row_Traits<PathView>
+{
+    static bool Read(const u8*& p, const u8* end, PathView& v) { return PathView::Read(p, end, v); }
+};
+
+
+
+
+//===============================================================================|
+//          TEMPLATES
+//===============================================================================|
+/**
+ * @brief shared by the From() functions; a struct BoltValue that was decoded
+ *  off a buffer still points at its fields there, so the view reads from those.
+ */
+template<typename View>
+inline bool Graph_View_From(const BoltValue& v, View& out)
+{
+    if (v.type != BoltType::Struct || !v.is_decoded || !v.buf) return false;
+
+    const u8* end = v.buf->Data() + v.buf->Get_Write_Offset();
+    const u8* p = v.buf->Data() + v.struct_val.offset;
+    return View::Read_Fields(p, end, v.struct_val.tag, static_cast<u32>(v.struct_val.size), out);
+} // end Graph_View_From
+
+
+inline bool NodeView::From(const BoltValue& v, NodeView& n) { return Graph_View_From(v, n); }
+inline bool RelView::From(const BoltValue& v, RelView& r) { return Graph_View_From(v, r); }
+inline bool PathView::From(const BoltValue& v, PathView& path) { return Graph_View_From(v, path); }
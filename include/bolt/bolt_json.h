@@ -0,0 +1,109 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <string>
+#include <string_view>
+#include <vector>
+#include "neoerr.h"
+#include "bolt/bolt_buf.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr int JSON_MAX_DEPTH = 64;      // deepest nesting transcoded before giving up
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief how a result's records are laid out
+ */
+enum class JsonLayout : u8
+{
+    JSON_ARRAY,         // [rec,rec,...]
+    NDJSON,             // rec\nrec\n...
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief PackStream straight to JSON, one pass over the bytes and nothing
+ *  decoded into BoltValues. Output is appended to a BoltBuf, grown as needed.
+ *
+ *  Scalars map the obvious way; bytes become base64 strings and non finite
+ *  floats the strings "NaN", "Infinity" and "-Infinity". Integers are written
+ *  in full even past 2^53. Structs take these shapes:
+ *
+ *  Node                 {"id":1,"labels":["A"],"properties":{...},"elementId":"4:.."}
+ *  Relationship         {"id":2,"startNodeId":1,"endNodeId":3,"type":"R","properties":{...},
+ *                        "elementId":"5:..","startNodeElementId":"4:..","endNodeElementId":"4:.."}
+ *  UnboundRelationship  {"id":2,"type":"R","properties":{...},"elementId":"5:.."}
+ *  Path                 {"nodes":[n0,n1,..],"relationships":[r0,..]}; in path order,
+ *                        relationships as above with their ends filled in
+ *  Date                 "2026-10-16"
+ *  Time / LocalTime     "13:45:30.5+03:00" / "13:45:30.5"
+ *  LocalDateTime        "2026-10-16T13:45:30.5"
+ *  DateTime             "2026-10-16T13:45:30.5+03:00", local time with its offset
+ *  DateTimeZoneId       "2026-10-16T10:45:30.5Z[Africa/Addis_Ababa]", the instant in
+ *                        UTC with its zone (legacy, pre Bolt 5, ones without the Z)
+ *  Duration             "P14M3DT7.25S"
+ *  Point2D / Point3D    {"srid":4326,"x":..,"y":..} / {"srid":4979,"x":..,"y":..,"z":..}
+ *  anything else        {"tag":N,"fields":[...]}
+ *
+ *  Fractions of a second are left out when zero and trimmed of trailing zeros.
+ *  Element ids are left out before Bolt 5.
+ */
+
+
+/**
+ * @brief writes s as a quoted JSON string; quotes, backslashes and control
+ *  characters escaped, 16 bytes at a time under SSE2.
+ *
+ * @return LB_OK, alas LB_FAIL with LB_CODE_STATE_MEM when out can't grow
+ */
+LBStatus Json_String(std::string_view s, BoltBuf& out);
+
+
+/**
+ * @brief transcodes the PackStream value at p, moving p past it
+ *
+ * @return LB_OK or LB_FAIL with LB_CODE_PROTO when malformed, truncated or
+ *  nested past JSON_MAX_DEPTH, LB_CODE_STATE_MEM when out can't grow
+ */
+LBStatus Json_Value(const u8*& p, const u8* end, BoltBuf& out);
+
+
+/**
+ * @brief transcodes a record's field list at p (the list header after the
+ *  RECORD struct marker and tag); an object when keys has an entry per field,
+ *  an array otherwise.
+ *
+ * @param keys the field names as rendered by Json_Keys(), or nullptr
+ */
+LBStatus Json_Record(const u8*& p, const u8* end, const std::vector<std::string>* keys, BoltBuf& out);
+
+
+/**
+ * @brief renders field names once as the `"name":` that precedes each value
+ */
+void Json_Keys(const std::vector<std::string_view>& names, std::vector<std::string>& keys);
@@ -3,8 +3,9 @@
  * 
  * @version 1.0
  * @date created 14th of April 2025, Monday.
- * @date updated 2nd of Feburary 2026, Monday.
+ * @date updated 16th of October 2026, Friday.
  */
+#pragma once
 
 
 //===============================================================================|
@@ -15,8 +16,52 @@ struct BoltValue;
 
 
 
+//===============================================================================|
+//          MACROS
+//===============================================================================|
+/**
+ * @brief the threaded decoder core dispatches through label addresses where the
+ *  compiler supports them (GCC, Clang) and through a switch elsewhere; define as
+ *  0 to force the switch.
+ */
+#ifndef LB_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define LB_COMPUTED_GOTO 1
+#else
+#define LB_COMPUTED_GOTO 0
+#endif
+#endif
+
+
+
+
 //===============================================================================|
 //          EXTERNS
 //===============================================================================|
 using DecodeFn = bool (*)(u8*&, BoltValue&);
-extern const DecodeFn jump_table[256];
\ No newline at end of file
+extern const DecodeFn jump_table[256];
+
+bool Decode_Threaded(u8*& pos, BoltValue& out);
+bool Decode_Switched(u8*& pos, BoltValue& out);
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief decodes the value at pos into out and moves pos past it; the one entry
+ *  point the decoder and BoltValue use. Goes through the threaded core unless
+ *  built with LB_JUMP_TABLE_DECODE, which keeps the function pointer per value.
+ *
+ * @return false on a reserved marker
+ */
+inline bool Decode_Value(u8*& pos, BoltValue& out)
+{
+#ifdef LB_JUMP_TABLE_DECODE
+    return jump_table[*pos](pos, out);
+#else
+    return Decode_Threaded(pos, out);
+#endif
+} // end Decode_Value
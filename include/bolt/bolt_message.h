@@ -5,7 +5,7 @@
  * 
  * @version 1.0
  * @date created 13th of April 2025, Sunday.
- * @date update 27th of Feburary 2026, Friday.
+ * @date update 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -20,6 +20,14 @@
 
 
 
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr size_t BOLT_MAX_CHUNK_SIZE = 0xFFFF;     // payload bytes a single chunk holds
+
+
+
+
 //===============================================================================|
 //          CLASS
 //===============================================================================|
@@ -0,0 +1,330 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <span>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bolt/boltvalue.h"
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief raw PackStream writers over a plain cursor. Callers make sure there is
+ *  room for what's written by summing up the Size() functions first; i.e. no
+ *  bounds checks in here.
+ */
+namespace Pack
+{
+    /**
+     * @brief writes v in network byte order and moves the cursor past it
+     */
+    template<typename T>
+    inline u8* Put_BE(u8* p, const T v)
+    {
+        if constexpr (sizeof(T) == 1) *p = static_cast<u8>(v);
+        else if constexpr (sizeof(T) == 2) { u16 x = htons(static_cast<u16>(v)); iCpy(p, &x, 2); }
+        else if constexpr (sizeof(T) == 4) { u32 x = htonl(static_cast<u32>(v)); iCpy(p, &x, 4); }
+        else { u64 x = htonll(static_cast<u64>(v)); iCpy(p, &x, 8); }
+        return p + sizeof(T);
+    } // end Put_BE
+
+
+    /**
+     * @brief number of bytes a string/list/map header takes for n items (or
+     *  bytes for strings); the tiny form holds upto 15.
+     */
+    constexpr size_t Header_Size(const size_t n)
+    {
+        return n < 16 ? 1 : n < 256 ? 2 : n < 65536 ? 3 : 5;
+    } // end Header_Size
+
+
+    /**
+     * @brief writes a sized header; tiny is the 0x80/0x90/0xA0 marker and base
+     *  the 8-bit marker (0xD0/0xD4/0xD8) followed by its 16 and 32-bit siblings.
+     */
+    inline u8* Put_Header(u8* p, const u8 tiny, const u8 base, const size_t n)
+    {
+        if (n < 16) return Put_BE<u8>(p, tiny | static_cast<u8>(n));
+        if (n < 256) { *p++ = base; return Put_BE<u8>(p, static_cast<u8>(n)); }
+        if (n < 65536) { *p++ = base + 1; return Put_BE<u16>(p, static_cast<u16>(n)); }
+
+        *p++ = base + 2;
+        return Put_BE<u32>(p, static_cast<u32>(n));
+    } // end Put_Header
+
+
+    /**
+     * @brief encoded size of an integer
+     */
+    constexpr size_t Int_Size(const s64 v)
+    {
+        if (v >= -16 && v <= 127) return 1;
+        if (v >= INT8_MIN && v <= INT8_MAX) return 2;
+        if (v >= INT16_MIN && v <= INT16_MAX) return 3;
+        if (v >= INT32_MIN && v <= INT32_MAX) return 5;
+        return 9;
+    } // end Int_Size
+
+
+    /**
+     * @brief writes an integer in the smallest form that holds it
+     */
+    inline u8* Put_Int(u8* p, const s64 v)
+    {
+        if (v >= -16 && v <= 127) return Put_BE<u8>(p, static_cast<u8>(v));
+        if (v >= INT8_MIN && v <= INT8_MAX) { *p++ = BOLT_INT8; return Put_BE<u8>(p, static_cast<u8>(v)); }
+        if (v >= INT16_MIN && v <= INT16_MAX) { *p++ = BOLT_INT16; return Put_BE<u16>(p, static_cast<u16>(v)); }
+        if (v >= INT32_MIN && v <= INT32_MAX) { *p++ = BOLT_INT32; return Put_BE<u32>(p, static_cast<u32>(v)); }
+
+        *p++ = BOLT_INT64;
+        return Put_BE<u64>(p, static_cast<u64>(v));
+    } // end Put_Int
+} // end Pack
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief maps what callers hand to P() to what a parameter keeps; strings of any
+ *  kind are viewed, containers become spans and scalars are copied. Nothing is
+ *  copied into the BoltValue pool.
+ */
+template<typename T, typename = void>
+struct Param_Store { using type = void; };
+
+template<typename T>
+struct Param_Store<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_same_v<T, std::nullptr_t>>>
+{ using type = T; };
+
+template<>
+struct Param_Store<std::string> { using type = std::string_view; };
+
+template<>
+struct Param_Store<std::string_view> { using type = std::string_view; };
+
+template<>
+struct Param_Store<const char*> { using type = std::string_view; };
+
+template<>
+struct Param_Store<char*> { using type = std::string_view; };
+
+template<typename E>
+struct Param_Store<std::span<E>> { using type = std::span<const std::remove_cv_t<E>>; };
+
+template<typename E, typename A>
+struct Param_Store<std::vector<E, A>> { using type = std::span<const E>; };
+
+template<typename E, size_t N>
+struct Param_Store<std::array<E, N>> { using type = std::span<const E>; };
+
+template<typename T>
+using Param_Store_t = typename Param_Store<std::decay_t<T>>::type;
+
+
+/**
+ * @brief sizes and writes a stored parameter value as PackStream
+ */
+template<typename T>
+struct Pack_Traits;
+
+template<>
+struct Pack_Traits<std::nullptr_t>
+{
+    static constexpr size_t Size(std::nullptr_t) { return 1; }
+    static u8* Write(u8* p, std::nullptr_t) { *p = BOLT_NULL; return p + 1; }
+};
+
+template<>
+struct Pack_Traits<bool>
+{
+    static constexpr size_t Size(bool) { return 1; }
+    static u8* Write(u8* p, const bool b) { *p = b ? BOLT_BOOL_TRUE : BOLT_BOOL_FALSE; return p + 1; }
+};
+
+template<typename T>
+    requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+struct Pack_Traits<T>
+{
+    static constexpr size_t Size(const T v) { return Pack::Int_Size(static_cast<s64>(v)); }
+    static u8* Write(u8* p, const T v) { return Pack::Put_Int(p, static_cast<s64>(v)); }
+};
+
+template<typename T>
+    requires std::is_floating_point_v<T>
+struct Pack_Traits<T>
+{
+    static constexpr size_t Size(const T) { return 9; }
+    static u8* Write(u8* p, const T v)
+    {
+        double d = static_cast<double>(v);
+        u64 bits;
+        iCpy(&bits, &d, sizeof(bits));
+        *p++ = BOLT_FLOAT64;
+        return Pack::Put_BE<u64>(p, bits);
+    } // end Write
+};
+
+template<>
+struct Pack_Traits<std::string_view>
+{
+    static constexpr size_t Size(const std::string_view s) { return Pack::Header_Size(s.size()) + s.size(); }
+    static u8* Write(u8* p, const std::string_view s)
+    {
+        p = Pack::Put_Header(p, BOLT_STRINGTINY, BOLT_STRING8, s.size());
+        iCpy(p, s.data(), s.size());
+        return p + s.size();
+    } // end Write
+};
+
+template<typename E>
+struct Pack_Traits<std::span<const E>>
+{
+    using Elem = Param_Store_t<E>;
+
+    static size_t Size(const std::span<const E> list)
+    {
+        size_t n = Pack::Header_Size(list.size());
+        for (const auto& e : list) n += Pack_Traits<Elem>::Size(Elem(e));
+        return n;
+    } // end Size
+
+    static u8* Write(u8* p, const std::span<const E> list)
+    {
+        p = Pack::Put_Header(p, BOLT_LISTTINY, BOLT_LIST8, list.size());
+        for (const auto& e : list) p = Pack_Traits<Elem>::Write(p, Elem(e));
+        return p;
+    } // end Write
+};
+
+
+/**
+ * @brief true for types P() accepts as a value
+ */
+template<typename T>
+concept Bolt_Packable = !std::is_void_v<Param_Store_t<T>> &&
+    requires(const Param_Store_t<T>& v, u8* p) {
+        { Pack_Traits<Param_Store_t<T>>::Size(v) } -> std::convertible_to<size_t>;
+        { Pack_Traits<Param_Store_t<T>>::Write(p, v) } -> std::same_as<u8*>;
+    };
+
+
+/**
+ * @brief a map key packed once into its wire form (marker + bytes). N is the size
+ *  of the string literal, NUL included, so both the header and the length are
+ *  known at compile time. Declare it static constexpr to share it across calls:
+ *
+ *      static constexpr ParamKey id_key("id");
+ *      driver.Execute("MATCH (n {id: $id}) RETURN n", P(id_key, 42));
+ */
+template<size_t N>
+struct ParamKey
+{
+    static_assert(N >= 1 && N - 1 < 256, "parameter keys are limited to 255 bytes");
+    static constexpr size_t length = N - 1;
+    static constexpr size_t size = Pack::Header_Size(length) + length;
+
+    std::array<u8, size> bytes{};
+
+    constexpr ParamKey(const char (&key)[N])
+    {
+        size_t i = 0;
+        if constexpr (length < 16)
+            bytes[i++] = BOLT_STRINGTINY | static_cast<u8>(length);
+        else
+        {
+            bytes[i++] = BOLT_STRING8;
+            bytes[i++] = static_cast<u8>(length);
+        } // end else 8-bit
+
+        for (size_t c = 0; c < length; c++)
+            bytes[i++] = static_cast<u8>(key[c]);
+    } // end ParamKey
+};
+
+
+/**
+ * @brief a named query parameter; a pre-packed key and a value viewed or copied
+ *  from the caller. Values that are views (strings, spans) must outlive the
+ *  query call, which they do when P() is used inline.
+ */
+template<size_t N, typename V>
+struct BoltParam
+{
+    ParamKey<N> key;
+    V value;
+
+    size_t Size() const
+    {
+        return ParamKey<N>::size + Pack_Traits<V>::Size(value);
+    } // end Size
+
+    u8* Write(u8* p) const
+    {
+        iCpy(p, key.bytes.data(), ParamKey<N>::size);
+        return Pack_Traits<V>::Write(p + ParamKey<N>::size, value);
+    } // end Write
+};
+
+
+template<typename T>
+struct Is_Bolt_Param : std::false_type {};
+
+template<size_t N, typename V>
+struct Is_Bolt_Param<BoltParam<N, V>> : std::true_type {};
+
+
+/**
+ * @brief true for BoltParam<> instances, i.e. what P() returns
+ */
+template<typename T>
+concept Bolt_Param_Type = Is_Bolt_Param<std::remove_cvref_t<T>>::value;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief makes a typed query parameter; P("id", 42), P("name", str),
+ *  P("tags", std::span<const std::string>{ tags }). Supported values are null,
+ *  bools, integers, floats, strings and lists (vectors, arrays, spans) of those.
+ *
+ * @param key the parameter name, a string literal
+ * @param value the parameter value
+ */
+template<size_t N, Bolt_Packable T>
+constexpr auto P(const char (&key)[N], T&& value)
+{
+    return BoltParam<N, Param_Store_t<T>>{ ParamKey<N>(key), Param_Store_t<T>(value) };
+} // end P
+
+
+/**
+ * @brief overload for keys packed ahead of time
+ */
+template<size_t N, Bolt_Packable T>
+constexpr auto P(const ParamKey<N>& key, T&& value)
+{
+    return BoltParam<N, Param_Store_t<T>>{ key, Param_Store_t<T>(value) };
+} // end P
@@ -3,7 +3,7 @@
  * 
  * @version 1.0
  * @date created 19th of Feburary 2026, Wednesday
- * @date created 19th of Feburary 2026, Wednesday
+ * @date updated 17th of October 2026, Saturday
  */
 #pragma once
 
@@ -12,8 +12,13 @@
 //===============================================================================|
 //          INCLUDES
 //===============================================================================|
+#include "bolt/bolt_decoder.h"
 #include "bolt/bolt_message.h"
 #include "bolt/boltvalue_pool.h"
+#include "bolt/bolt_row.h"
+#include "bolt/bolt_summary.h"
+#include "bolt/bolt_graph.h"
+#include "bolt/bolt_json.h"
 
 
 
@@ -22,6 +27,21 @@
 //===============================================================================|
 //          CLASS
 //===============================================================================|
+/**
+ * @brief a result's bytes copied out of the connection's receive buffer and read
+ *  through a decoder of their own; carried by results handed off the decoding
+ *  thread, so the connection is free to compact, grow or park its buffer while
+ *  they're in use. The storage is borrowed from the driver's slab, if any.
+ */
+struct HeldBytes
+{
+    BoltBuf buf;
+    BoltDecoder decoder{ buf };
+
+    HeldBytes(const size_t size, BufferSlab* pslab) : buf(size, pslab) {}
+};
+
+
 /**
  * @brief the result of a bolt query. It consists of three fields, the fields
  *  names for the query result, a list of records, and a summary detail, as per
@@ -32,6 +52,7 @@ struct BoltResult
     BoltDecoder* pdec;     // pointer to the decoder for the result
     BoltMessage fields;    // the field names for the record
     BoltMessage summary;   // the summary message at end of records
+    BoltSummary meta;      // has_more, t_first, t_last... scanned off every summary
 
     size_t message_count{ 0 };  // count of messages contained within records
 	size_t total_bytes{ 0 };    // total bytes consumed by the records
@@ -39,6 +60,7 @@ struct BoltResult
     bool error{ false };        // determines if this stream is a failed one
     bool done{ false };         // when true, streaming is done and summary is ready.
     int client_id = 0;          // debugging purposes, to id threads.
+    std::unique_ptr<HeldBytes> held;    // its bytes when copied out of the receive buffer
 
     struct iterator
     {
@@ -46,9 +68,11 @@ struct BoltResult
         BoltDecoder* pdecoder;
         size_t cursor{ 0 };     // current streaming position in pool
 
-        iterator(BoltDecoder* pd, size_t offset)
+        iterator(BoltDecoder* pd, size_t offset, bool empty = false)
             : pdecoder(pd), cursor(offset) 
         { 
+            if (empty) return;      // nothing kept, i.e. streamed to a visitor
+
 			LBStatus rc = pdecoder->Decode(cursor, bv);
             if (LB_OK(rc)) cursor += LB_Aux(rc);
             else
@@ -77,17 +101,194 @@ struct BoltResult
         pdec = other.pdec;
         fields = other.fields;
         summary = other.summary;
+        meta = other.meta;
         error = other.error;
         done = other.done;
         client_id = other.client_id;
         message_count = other.message_count;
 		total_bytes = other.total_bytes;
         start_offset = other.start_offset;
+        held = std::move(other.held);
 
         other.pdec = nullptr;
         return *this;
     } // end move assign
 
-    iterator begin() { return iterator(pdec, start_offset); }
-    iterator end() { return iterator(pdec, start_offset + total_bytes); }
+    iterator begin() { return iterator(pdec, start_offset, total_bytes == 0); }
+    iterator end() { return iterator(pdec, start_offset + total_bytes, total_bytes == 0); }
+
+
+    /**
+     * @brief decodes the records straight from the receive buffer into rows of
+     *  T, a std::tuple<> or a struct bound via BoltRow<T>; no BoltValue is made
+     *  and the pool is never touched. A record that doesn't fit T is left out of
+     *  rows and reported in errors instead, the rest carry on.
+     *
+     * @note std::string_view members point into the connection's receive buffer
+     *  and stay valid until the connection is reset; use std::string to keep them.
+     *  Records over a chunk (64K) are gathered into the decoder's scratch buffer,
+     *  which the next such record reuses, so take their strings as std::string.
+     *
+     * @param rows decoded rows are appended here
+     * @param errors optional; receives the index and reason of rejected records
+     *
+     * @return LB_OK_INFO with the number of rows decoded, LB_FAIL with LB_CODE_TYPE
+     *  and the number of rejected records as aux, or LB_CODE_PROTO on a malformed
+     *  stream (rows decoded so far are kept).
+     */
+    template<Bolt_Row_Type T>
+    LBStatus Fetch_As(std::vector<T>& rows, std::vector<RowError>* errors = nullptr)
+    {
+        if (error)
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_NEO4J,
+                LBStage::LB_STAGE_QUERY, LBCode::LB_CODE_NEO4J_QUERY);
+
+        const u8* cursor = pdec->Get_Buf().Data() + start_offset;
+        const u8* stop = cursor + total_bytes;
+        u32 decoded = 0, rejected = 0;
+
+        rows.reserve(rows.size() + message_count);
+        for (size_t i = 0; cursor < stop; i++)
+        {
+            // [size][B1 71][fields...][00 00]; records split over several chunks
+            //  are gathered first, the rest are read in place
+            BoltFrame frame;
+            if (!LB_OK(BoltDecoder::Frame(cursor, stop - cursor, frame)) || frame.payload_size < 2)
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO, decoded);
+
+            const u8* body = frame.chunks > 1 ? pdec->Gather(cursor, frame) : cursor + 2;
+            if (!body)
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM, decoded);
+
+            const u8* body_end = body + frame.payload_size;
+            if (body[0] != (BOLT_STRUCT | 1) || body[1] != BOLT_RECORD)
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO, decoded);
+
+            T& row = rows.emplace_back();
+            LBStatus rc = Decode_Row(body + 2, body_end, row);
+            if (LB_OK(rc)) decoded++;
+            else
+            {
+                rows.pop_back();
+                rejected++;
+                if (errors) errors->push_back({ i, rc });
+            } // end else rejected
+
+            cursor += frame.wire_size;
+        } // end for
+
+        if (rejected)
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_TYPE, rejected);
+
+        return LBOK_INFO(decoded);
+    } // end Fetch_As
+
+
+    /**
+     * @brief the field names from the RUN summary, viewed in place
+     *
+     * @return LB_OK_INFO with the number of names, alas LB_FAIL with LB_CODE_PROTO
+     *  when there is no decoded summary to read them from
+     */
+    LBStatus Keys(std::vector<std::string_view>& keys) const
+    {
+        const LBStatus bad = LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
+        const BoltValue& run = fields.msg;
+
+        keys.clear();
+        if (run.type != BoltType::Struct || !run.is_decoded || !run.buf || run.struct_val.size < 1)
+            return bad;
+
+        const u8* p = run.buf->Data() + run.struct_val.offset;
+        const u8* end = run.buf->Data() + run.buf->Get_Write_Offset();
+        u32 n;
+        if (!Unpack::Read_Map(p, end, n)) return bad;
+
+        while (n--)
+        {
+            std::string_view key;
+            u32 count;
+            if (!Unpack::Read_String(p, end, key)) return bad;
+            if (key != "fields" || !Unpack::Read_List(p, end, count))
+            {
+                if (!(p = Unpack::Skip(p, end))) return bad;
+                continue;
+            } // end if not fields
+
+            keys.resize(count);
+            for (u32 i = 0; i < count; i++)
+                if (!Unpack::Read_String(p, end, keys[i])) return bad;
+            return LBOK_INFO(count);
+        } // end while
+
+        return bad;
+    } // end Keys
+
+
+    /**
+     * @brief transcodes the records straight from the receive buffer to JSON,
+     *  appended to out; each record an object keyed by the field names (or an
+     *  array when they aren't known), laid out as a JSON array or as NDJSON.
+     *  See bolt_json.h for how values and graph/temporal structs come out.
+     *
+     * @return LB_OK_INFO with the number of records written, LB_FAIL with
+     *  LB_CODE_PROTO on a malformed stream or LB_CODE_STATE_MEM when out can't
+     *  grow; out then holds what was written so far.
+     */
+    LBStatus To_Json(BoltBuf& out, const JsonLayout layout = JsonLayout::JSON_ARRAY)
+    {
+        if (error)
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_NEO4J,
+                LBStage::LB_STAGE_QUERY, LBCode::LB_CODE_NEO4J_QUERY);
+
+        std::vector<std::string_view> names;
+        std::vector<std::string> keys;
+        if (LB_OK(Keys(names))) Json_Keys(names, keys);
+
+        const u8 open = '[', comma = ',', close = ']', newline = '\n';
+        auto no_room = [](const u32 n) {
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+                LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM, n);
+        };
+        const bool array = layout == JsonLayout::JSON_ARRAY;
+        if (array && !out.Write(&open, 1)) return no_room(0);
+
+        const u8* cursor = pdec->Get_Buf().Data() + start_offset;
+        const u8* stop = cursor + total_bytes;
+        u32 written = 0;
+
+        while (cursor < stop)
+        {
+            BoltFrame frame;
+            if (!LB_OK(BoltDecoder::Frame(cursor, stop - cursor, frame)) || frame.payload_size < 2)
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO, written);
+
+            const u8* body = frame.chunks > 1 ? pdec->Gather(cursor, frame) : cursor + 2;
+            if (!body)
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM, written);
+            if (body[0] != (BOLT_STRUCT | 1) || body[1] != BOLT_RECORD)
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO, written);
+
+            if (array && written && !out.Write(&comma, 1)) return no_room(written);
+
+            const u8* p = body + 2;
+            LBStatus rc = Json_Record(p, body + frame.payload_size, keys.empty() ? nullptr : &keys, out);
+            if (!LB_OK(rc)) return rc;
+
+            if (!array && !out.Write(&newline, 1)) return no_room(written);
+            written++;
+            cursor += frame.wire_size;
+        } // end while
+
+        if (array && !out.Write(&close, 1)) return no_room(written);
+        return LBOK_INFO(written);
+    } // end To_Json
 };
\ No newline at end of file
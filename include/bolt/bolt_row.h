@@ -0,0 +1,437 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "neoerr.h"
+#include "bolt/boltvalue.h"
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief raw PackStream readers over a [p, end) range; the mirror of Pack. Every
+ *  Read_ function checks the marker and the bounds, moves p past the value on
+ *  success and leaves it untouched on a mismatch so the caller can report the
+ *  column that failed.
+ */
+namespace Unpack
+{
+    /**
+     * @brief reads a T stored in network byte order at p
+     */
+    template<typename T>
+    inline T Get_BE(const u8* p)
+    {
+        T v;
+        iCpy(&v, p, sizeof(T));
+        if constexpr (sizeof(T) == 2) return static_cast<T>(ntohs(static_cast<u16>(v)));
+        else if constexpr (sizeof(T) == 4) return static_cast<T>(ntohl(static_cast<u32>(v)));
+        else if constexpr (sizeof(T) == 8) return static_cast<T>(ntohll(static_cast<u64>(v)));
+        else return v;
+    } // end Get_BE
+
+
+    /**
+     * @brief reads a sized header; tiny is the 0x80/0x90/0xA0 family and base the
+     *  8-bit marker followed by its 16 and 32-bit siblings.
+     *
+     * @return the number of header bytes, 0 when the marker is of another family
+     *  or the header runs past end
+     */
+    inline size_t Get_Header(const u8* p, const u8* end, const u8 tiny, const u8 base, u32& n)
+    {
+        if (p >= end) return 0;
+
+        const u8 m = *p;
+        if ((m & 0xF0) == tiny) { n = m & 0x0F; return 1; }
+        if (m == base && end - p >= 2) { n = p[1]; return 2; }
+        if (m == base + 1 && end - p >= 3) { n = Get_BE<u16>(p + 1); return 3; }
+        if (m == base + 2 && end - p >= 5) { n = Get_BE<u32>(p + 1); return 5; }
+        return 0;
+    } // end Get_Header
+
+
+    /**
+     * @brief reads a null marker
+     */
+    inline bool Read_Null(const u8*& p, const u8* end)
+    {
+        if (p >= end || *p != BOLT_NULL) return false;
+        p++;
+        return true;
+    } // end Read_Null
+
+
+    /**
+     * @brief reads a boolean
+     */
+    inline bool Read_Bool(const u8*& p, const u8* end, bool& v)
+    {
+        if (p >= end || (*p != BOLT_BOOL_TRUE && *p != BOLT_BOOL_FALSE)) return false;
+        v = *p++ == BOLT_BOOL_TRUE;
+        return true;
+    } // end Read_Bool
+
+
+    /**
+     * @brief reads an integer of any width
+     */
+    inline bool Read_Int(const u8*& p, const u8* end, s64& v)
+    {
+        if (p >= end) return false;
+
+        const u8 m = *p;
+        if (m < 0x80 || m >= 0xF0) { v = static_cast<s8>(m); p++; return true; }
+
+        const ptrdiff_t left = end - p;
+        switch (m)
+        {
+        case BOLT_INT8:
+            if (left < 2) return false;
+            v = static_cast<s8>(p[1]); p += 2;
+            return true;
+        case BOLT_INT16:
+            if (left < 3) return false;
+            v = static_cast<s16>(Get_BE<u16>(p + 1)); p += 3;
+            return true;
+        case BOLT_INT32:
+            if (left < 5) return false;
+            v = static_cast<s32>(Get_BE<u32>(p + 1)); p += 5;
+            return true;
+        case BOLT_INT64:
+            if (left < 9) return false;
+            v = static_cast<s64>(Get_BE<u64>(p + 1)); p += 9;
+            return true;
+        default:
+            return false;
+        } // end switch
+    } // end Read_Int
+
+
+    /**
+     * @brief reads a float
+     */
+    inline bool Read_Float(const u8*& p, const u8* end, double& v)
+    {
+        if (end - p < 9 || *p != BOLT_FLOAT64) return false;
+
+        u64 bits = Get_BE<u64>(p + 1);
+        iCpy(&v, &bits, sizeof(v));
+        p += 9;
+        return true;
+    } // end Read_Float
+
+
+    /**
+     * @brief views a string in place; nothing is copied
+     */
+    inline bool Read_String(const u8*& p, const u8* end, std::string_view& s)
+    {
+        u32 n;
+        size_t h = Get_Header(p, end, BOLT_STRINGTINY, BOLT_STRING8, n);
+        if (!h || static_cast<size_t>(end - p) < h + n) return false;
+
+        s = std::string_view(reinterpret_cast<const char*>(p + h), n);
+        p += h + n;
+        return true;
+    } // end Read_String
+
+
+    /**
+     * @brief reads a list header; the n items follow
+     */
+    inline bool Read_List(const u8*& p, const u8* end, u32& n)
+    {
+        size_t h = Get_Header(p, end, BOLT_LISTTINY, BOLT_LIST8, n);
+        p += h;
+        return h != 0;
+    } // end Read_List
+
+
+    /**
+     * @brief reads a map header; n key/value pairs follow
+     */
+    inline bool Read_Map(const u8*& p, const u8* end, u32& n)
+    {
+        size_t h = Get_Header(p, end, BOLT_MAPTINY, BOLT_MAP8, n);
+        p += h;
+        return h != 0;
+    } // end Read_Map
+
+
+    /**
+     * @brief reads a struct header and its tag; n fields follow
+     */
+    inline bool Read_Struct(const u8*& p, const u8* end, u8& tag, u32& n)
+    {
+        if (end - p < 2 || (*p & 0xF0) != BOLT_STRUCT) return false;
+
+        n = *p & 0x0F;
+        tag = p[1];
+        p += 2;
+        return true;
+    } // end Read_Struct
+
+
+    /**
+     * @brief steps over one complete value, containers included. Nested values are
+     *  counted down instead of recursed into so a deeply nested reply can't blow
+     *  the stack.
+     *
+     * @return pointer just past the value or nullptr when malformed or truncated
+     */
+    inline const u8* Skip(const u8* p, const u8* end)
+    {
+        size_t pending = 1;
+        while (pending--)
+        {
+            if (p >= end) return nullptr;
+
+            const u8 m = *p;
+            const u8 hi = m & 0xF0;
+            u32 n;
+            size_t h;
+
+            if (m < 0x80 || m >= 0xF0 || m == BOLT_NULL ||
+                m == BOLT_BOOL_TRUE || m == BOLT_BOOL_FALSE) { p++; continue; }
+            if (m == BOLT_FLOAT64 || m == BOLT_INT64) { p += 9; continue; }
+            if (m == BOLT_INT8) { p += 2; continue; }
+            if (m == BOLT_INT16) { p += 3; continue; }
+            if (m == BOLT_INT32) { p += 5; continue; }
+
+            if ((h = Get_Header(p, end, BOLT_STRINGTINY, BOLT_STRING8, n))) { p += h + n; continue; }
+            if ((h = Get_Header(p, end, BOLT_LISTTINY, BOLT_LIST8, n))) { p += h; pending += n; continue; }
+            if ((h = Get_Header(p, end, BOLT_MAPTINY, BOLT_MAP8, n))) { p += h; pending += 2 * size_t(n); continue; }
+            if (hi == BOLT_STRUCT) { pending += m & 0x0F; p += 2; continue; }
+
+            if (m >= BOLT_BYTES8 && m <= BOLT_BYTES32)
+            {
+                const size_t w = size_t(1) << (m - BOLT_BYTES8);
+                if (static_cast<size_t>(end - p) < 1 + w) return nullptr;
+                n = w == 1 ? p[1] : w == 2 ? Get_BE<u16>(p + 1) : Get_BE<u32>(p + 1);
+                p += 1 + w + n;
+                continue;
+            } // end if bytes
+
+            return nullptr;     // reserved marker
+        } // end while
+
+        return p <= end ? p : nullptr;
+    } // end Skip
+} // end Unpack
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief reads a PackStream value straight into a C++ type; the mirror of
+ *  Pack_Traits. Integers are range checked, floats also accept integers and
+ *  strings can be viewed (std::string_view) or copied (std::string). A
+ *  std::optional<> column takes nulls, everything else rejects them.
+ */
+template<typename T>
+struct Row_Traits;
+
+template<>
+struct Row_Traits<bool>
+{
+    static bool Read(const u8*& p, const u8* end, bool& v) { return Unpack::Read_Bool(p, end, v); }
+};
+
+template<typename T>
+    requires (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+struct Row_Traits<T>
+{
+    static bool Read(const u8*& p, const u8* end, T& v)
+    {
+        const u8* q = p;
+        s64 x;
+        if (!Unpack::Read_Int(q, end, x) || !std::in_range<T>(x)) return false;
+
+        v = static_cast<T>(x);
+        p = q;
+        return true;
+    } // end Read
+};
+
+template<typename T>
+    requires std::is_floating_point_v<T>
+struct Row_Traits<T>
+{
+    static bool Read(const u8*& p, const u8* end, T& v)
+    {
+        double d;
+        s64 x;
+        if (Unpack::Read_Float(p, end, d)) { v = static_cast<T>(d); return true; }
+        if (Unpack::Read_Int(p, end, x)) { v = static_cast<T>(x); return true; }
+        return false;
+    } // end Read
+};
+
+template<>
+struct Row_Traits<std::string_view>
+{
+    static bool Read(const u8*& p, const u8* end, std::string_view& v) { return Unpack::Read_String(p, end, v); }
+};
+
+template<>
+struct Row_Traits<std::string>
+{
+    static bool Read(const u8*& p, const u8* end, std::string& v)
+    {
+        std::string_view s;
+        if (!Unpack::Read_String(p, end, s)) return false;
+
+        v.assign(s.data(), s.size());
+        return true;
+    } // end Read
+};
+
+template<typename T>
+struct Row_Traits<std::optional<T>>
+{
+    static bool Read(const u8*& p, const u8* end, std::optional<T>& v)
+    {
+        if (Unpack::Read_Null(p, end)) { v.reset(); return true; }
+        if (!v) v.emplace();
+        return Row_Traits<T>::Read(p, end, *v);
+    } // end Read
+};
+
+template<typename T, typename A>
+struct Row_Traits<std::vector<T, A>>
+{
+    static bool Read(const u8*& p, const u8* end, std::vector<T, A>& v)
+    {
+        const u8* q = p;
+        u32 n;
+        if (!Unpack::Read_List(q, end, n)) return false;
+
+        v.resize(n);
+        for (u32 i = 0; i < n; i++)
+            if (!Row_Traits<T>::Read(q, end, v[i])) return false;
+
+        p = q;
+        return true;
+    } // end Read
+};
+
+
+/**
+ * @brief true for column types Fetch_As can decode into
+ */
+template<typename T>
+concept Bolt_Readable = requires(const u8*& p, const u8* end, T& v) {
+    { Row_Traits<T>::Read(p, end, v) } -> std::same_as<bool>;
+};
+
+
+/**
+ * @brief binds the columns of a record to the members of a user struct, by index;
+ *  column 0 goes to the first member listed, column 1 to the second and so on.
+ *  Specialize it next to the struct:
+ *
+ *      struct Person { s64 id; std::string name; double score; };
+ *
+ *      template<> struct BoltRow<Person> {
+ *          static constexpr auto fields = std::make_tuple(&Person::id, &Person::name, &Person::score);
+ *      };
+ *
+ *  std::tuple<> and std::pair<> rows need no specialization.
+ */
+template<typename T>
+struct BoltRow;
+
+
+template<typename T>
+struct Is_Tuple_Row : std::false_type {};
+
+template<typename... Ts>
+struct Is_Tuple_Row<std::tuple<Ts...>> : std::true_type {};
+
+template<typename A, typename B>
+struct Is_Tuple_Row<std::pair<A, B>> : std::true_type {};
+
+
+/**
+ * @brief true for types Fetch_As can decode a record into
+ */
+template<typename T>
+concept Bolt_Row_Type = Is_Tuple_Row<T>::value ||
+    requires { std::tuple_size<std::remove_cvref_t<decltype(BoltRow<T>::fields)>>::value; };
+
+
+/**
+ * @brief a record that didn't fit the row type; status carries LB_CODE_TYPE
+ *  with the failing column in its aux (or LB_CODE_PROTO if malformed).
+ */
+struct RowError
+{
+    size_t row;         // index of the record within the result
+    LBStatus status;    // why it was rejected
+};
+
+
+
+
+//===============================================================================|
+//          TEMPLATES
+//===============================================================================|
+/**
+ * @brief decodes one record's field list into row; p points at the list header
+ *  right after the RECORD struct marker and tag. Columns past what the row binds
+ *  are left alone.
+ *
+ * @return LB_OK or LB_FAIL with LB_CODE_TYPE and the column index as aux.
+ */
+template<Bolt_Row_Type T>
+LBStatus Decode_Row(const u8* p, const u8* end, T& row)
+{
+    u32 columns;
+    if (!Unpack::Read_List(p, end, columns))
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
+
+    // reads each bound member in turn, stopping at the first that doesn't fit
+    auto bind = [&](auto&... refs) -> LBStatus {
+        if (columns < sizeof...(refs))
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+                LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_TYPE, columns);
+
+        u32 column = 0;
+        bool ok = ((Row_Traits<std::remove_cvref_t<decltype(refs)>>::Read(p, end, refs)
+            && ++column) && ...);
+        if (ok) return LBOK_INFO(0);
+
+        LBCode code = Unpack::Skip(p, end) ? LBCode::LB_CODE_TYPE : LBCode::LB_CODE_PROTO;
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+            LBStage::LB_STAGE_DECODE, code, column);
+    };
+
+    if constexpr (Is_Tuple_Row<T>::value)
+        return std::apply(bind, row);
+    else
+        return std::apply([&](auto... member) { return bind(row.*member...); },
+            BoltRow<T>::fields);
+} // end Decode_Row
@@ -0,0 +1,399 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "basics.h"
+#include "utils/page_alloc.h"
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+static constexpr size_t SLAB_MIN_BLOCK = 8192;                  // smallest size class; default BoltBuf capacity
+static constexpr size_t SLAB_CLASSES = 16;                      // 8KiB ... 256MiB
+static constexpr size_t SLAB_DEFAULT_CAP = 256 * 1024 * 1024;   // driver wide cap on reserved bytes
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief a snapshot of the slab counters. Reserved bytes are everything the slab
+ *  got from the system (in use + idle), in use bytes are blocks currently lent
+ *  out to buffers and idle bytes are blocks sitting on the free lists.
+ */
+struct SlabStats
+{
+    size_t cap_bytes = 0;           // the configured upper bound on reserved bytes
+    size_t limit_bytes = 0;         // in use past which idle buffers give memory back
+    size_t reserved_bytes = 0;      // in use + idle
+    size_t in_use_bytes = 0;        // currently borrowed by buffers
+    size_t idle_bytes = 0;          // parked on the free lists
+    size_t high_water_bytes = 0;    // peak reserved bytes so far
+
+    u64 borrows = 0;                // number of successful borrows
+    u64 returns = 0;                // number of blocks handed back
+    u64 reuses = 0;                 // borrows satisfied from a free list
+    u64 cap_rejects = 0;            // borrows refused because of the cap
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief a driver wide slab of cache aligned buffer blocks in power of two size
+ *  classes starting from 8KiB. Connections borrow blocks for their read/write
+ *  buffers and hand them back when they grow, shrink or go idle so that memory
+ *  is recycled across connections instead of being pinned per connection.
+ *
+ * Blocks are obtained through PageAlloc under the slab's MemPolicy; i.e. plain
+ *  heap, first-touch mappings or huge pages, and remember where they came from.
+ *
+ * Free blocks are kept on intrusive singly linked lists (the head of an idle
+ *  block points to the next one), one per size class and each guarded by its own
+ *  mutex; borrow/return happen at most a few times per query so the locks are
+ *  rarely contended. The total number of reserved bytes never exceeds the cap,
+ *  should a borrow not fit, idle blocks from other classes are released first and
+ *  only then is the request refused with a nullptr.
+ */
+class BufferSlab
+{
+public:
+
+    explicit BufferSlab(const size_t cap = SLAB_DEFAULT_CAP,
+        const MemPolicy& policy = PageAlloc::Default_Policy())
+        : cap_bytes{cap}, policy_bits{PageAlloc::Pack(policy)} {}
+
+    BufferSlab(const BufferSlab&) = delete;
+    BufferSlab& operator=(const BufferSlab&) = delete;
+
+    ~BufferSlab()
+    {
+        Trim();
+    } // end ~BufferSlab
+
+
+    /**
+     * @brief rounds the requested size up to the size class that would serve it.
+     *  Sizes beyond the largest class are rounded to whole huge pages and are
+     *  served straight from the system, still accounted against the cap.
+     *
+     * @param n the number of bytes requested
+     *
+     * @return the block size a borrow of n bytes gets
+     */
+    static size_t Block_Size(const size_t n)
+    {
+        if (n <= SLAB_MIN_BLOCK) return SLAB_MIN_BLOCK;
+        if (n > (SLAB_MIN_BLOCK << (SLAB_CLASSES - 1)))
+            return ((n + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+
+        return std::bit_ceil(n);
+    } // end Block_Size
+
+
+    /**
+     * @brief lends a block of at least size bytes. Idle blocks of the same class
+     *  are reused first; alas a fresh cache aligned block is reserved should the
+     *  cap allow it.
+     *
+     * @param size the block size, expected to be a value from Block_Size()
+     *
+     * @return the block; its ptr is nullptr when out of memory or over the cap.
+     *  Its asked is the class size it's accounted and pooled by, its size what
+     *  was actually mapped which larger pages may round up past that.
+     */
+    PageBlock Borrow(const size_t size)
+    {
+        int c = Class_Of(size);
+        if (c >= 0)
+        {
+            LOCK_GUARD(classes[c].lock);
+            if (classes[c].head)
+            {
+                FreeBlock* blk = classes[c].head;
+                classes[c].head = blk->next;
+                idle_bytes.fetch_sub(size, std::memory_order_relaxed);
+                Account_Borrow(size);
+                reuses.fetch_add(1, std::memory_order_relaxed);
+                return { reinterpret_cast<u8*>(blk), blk->length, blk->kind, size };
+            } // end if recycled
+        } // end if pooled class
+
+        if (!Reserve(size))
+        {
+            // make room by giving idle blocks back to the system and try once more
+            Trim();
+            if (!Reserve(size))
+            {
+                cap_rejects.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            } // end if still over
+        } // end if over cap
+
+        PageBlock blk = PageAlloc::Allocate(size, Get_Policy());
+        if (!blk.ptr)
+        {
+            reserved_bytes.fetch_sub(size, std::memory_order_relaxed);
+            return {};
+        } // end if system says no
+
+        Account_Borrow(size);
+        return blk;         // size as mapped, more than asked with pages past 8KiB
+    } // end Borrow
+
+
+    /**
+     * @brief takes back a block lent out by Borrow(). The block is parked on its
+     *  class free list for reuse unless the slab is over its cap (i.e. the cap was
+     *  lowered while the block was out) in which case it goes back to the system.
+     *
+     * @param blk the block as Borrow() lent it
+     */
+    void Return(const PageBlock& blk)
+    {
+        if (!blk.ptr) return;
+
+        const size_t size = blk.asked;
+
+        in_use_bytes.fetch_sub(size, std::memory_order_relaxed);
+        returns.fetch_add(1, std::memory_order_relaxed);
+
+        int c = Class_Of(size);
+        if (c < 0 || reserved_bytes.load(std::memory_order_relaxed) >
+            cap_bytes.load(std::memory_order_relaxed))
+        {
+            PageAlloc::Release(blk);
+            reserved_bytes.fetch_sub(size, std::memory_order_relaxed);
+            return;
+        } // end if not keeping it
+
+        FreeBlock* idle = reinterpret_cast<FreeBlock*>(blk.ptr);
+        LOCK_GUARD(classes[c].lock);
+        idle->kind = blk.kind;
+        idle->length = blk.size;
+        idle->next = classes[c].head;
+        classes[c].head = idle;
+        idle_bytes.fetch_add(size, std::memory_order_relaxed);
+    } // end Return
+
+
+    /**
+     * @brief releases idle blocks back to the system; blocks that are in use
+     *  are not touched.
+     *
+     * @return the number of bytes released
+     */
+    size_t Trim()
+    {
+        size_t released = 0;
+        for (size_t c = 0; c < SLAB_CLASSES; c++)
+        {
+            FreeBlock* blk;
+            {
+                LOCK_GUARD(classes[c].lock);
+                blk = classes[c].head;
+                classes[c].head = nullptr;
+            } // end lock scope
+
+            const size_t size = SLAB_MIN_BLOCK << c;
+            while (blk)
+            {
+                FreeBlock* next = blk->next;
+                PageAlloc::Release(blk, blk->length, blk->kind);
+                released += size;
+                blk = next;
+            } // end while
+        } // end for classes
+
+        idle_bytes.fetch_sub(released, std::memory_order_relaxed);
+        reserved_bytes.fetch_sub(released, std::memory_order_relaxed);
+        return released;
+    } // end Trim
+
+
+    /**
+     * @brief sets the upper bound on bytes the slab may reserve. Lowering it below
+     *  what's currently reserved releases idle blocks right away, borrowed ones go
+     *  back to the system as they are returned.
+     *
+     * @param cap the new cap in bytes
+     */
+    void Set_Cap(const size_t cap)
+    {
+        cap_bytes.store(cap, std::memory_order_relaxed);
+        if (reserved_bytes.load(std::memory_order_relaxed) > cap)
+            Trim();
+    } // end Set_Cap
+
+
+    /**
+     * @brief sets a soft limit on the bytes lent out; unlike the cap nothing is
+     *  refused past it, rather buffers parked while over it drop back to their
+     *  smallest size (see BoltBuf::Park()) and the driver parks idle ones sooner.
+     *  0 for none.
+     *
+     * @param limit the limit in bytes
+     */
+    void Set_Limit(const size_t limit)
+    {
+        limit_bytes.store(limit, std::memory_order_relaxed);
+    } // end Set_Limit
+
+
+    /**
+     * @brief true if there's a soft limit and more than it is lent out
+     */
+    bool Over_Limit() const
+    {
+        const size_t limit = limit_bytes.load(std::memory_order_relaxed);
+        return limit && in_use_bytes.load(std::memory_order_relaxed) > limit;
+    } // end Over_Limit
+
+
+    /**
+     * @brief sets how new blocks get their pages; idle blocks obtained under the
+     *  previous policy are kept and reused as is until trimmed.
+     *
+     * @param policy the new allocation policy
+     */
+    void Set_Policy(const MemPolicy& policy)
+    {
+        policy_bits.store(PageAlloc::Pack(policy), std::memory_order_relaxed);
+    } // end Set_Policy
+
+
+    /**
+     * @brief return's the allocation policy for new blocks
+     */
+    MemPolicy Get_Policy() const
+    {
+        return PageAlloc::Unpack(policy_bits.load(std::memory_order_relaxed));
+    } // end Get_Policy
+
+
+    /**
+     * @brief return's the configured cap in bytes
+     */
+    size_t Get_Cap() const
+    {
+        return cap_bytes.load(std::memory_order_relaxed);
+    } // end Get_Cap
+
+
+    /**
+     * @brief return's a snapshot of the slab counters. Individual counters are
+     *  read relaxed and may be momentarily off by a block with respect to each
+     *  other while connections are busy.
+     */
+    SlabStats Stats() const
+    {
+        SlabStats s;
+        s.cap_bytes = cap_bytes.load(std::memory_order_relaxed);
+        s.limit_bytes = limit_bytes.load(std::memory_order_relaxed);
+        s.reserved_bytes = reserved_bytes.load(std::memory_order_relaxed);
+        s.in_use_bytes = in_use_bytes.load(std::memory_order_relaxed);
+        s.idle_bytes = idle_bytes.load(std::memory_order_relaxed);
+        s.high_water_bytes = high_water.load(std::memory_order_relaxed);
+        s.borrows = borrows.load(std::memory_order_relaxed);
+        s.returns = returns.load(std::memory_order_relaxed);
+        s.reuses = reuses.load(std::memory_order_relaxed);
+        s.cap_rejects = cap_rejects.load(std::memory_order_relaxed);
+        return s;
+    } // end Stats
+
+
+private:
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+        PageKind kind;
+        size_t length;      // as mapped; page sizes past the class round it up
+    };
+
+    struct alignas(CACHE_LINE_SIZE) FreeList
+    {
+        std::mutex lock;
+        FreeBlock* head = nullptr;
+    };
+
+    FreeList classes[SLAB_CLASSES];
+
+    std::atomic<size_t> cap_bytes;
+    std::atomic<size_t> limit_bytes{ 0 };
+    std::atomic<u16> policy_bits;
+    std::atomic<size_t> reserved_bytes{ 0 };
+    std::atomic<size_t> in_use_bytes{ 0 };
+    std::atomic<size_t> idle_bytes{ 0 };
+    std::atomic<size_t> high_water{ 0 };
+
+    std::atomic<u64> borrows{ 0 };
+    std::atomic<u64> returns{ 0 };
+    std::atomic<u64> reuses{ 0 };
+    std::atomic<u64> cap_rejects{ 0 };
+
+
+    /**
+     * @brief maps a block size to its class index
+     *
+     * @return the class index or -1 if size is not one of the pooled classes
+     */
+    static int Class_Of(const size_t size)
+    {
+        if (size < SLAB_MIN_BLOCK || !std::has_single_bit(size))
+            return -1;
+
+        int c = std::countr_zero(size) - std::countr_zero(SLAB_MIN_BLOCK);
+        return c < static_cast<int>(SLAB_CLASSES) ? c : -1;
+    } // end Class_Of
+
+
+    /**
+     * @brief reserves size bytes against the cap
+     *
+     * @return true if it fits alas false
+     */
+    bool Reserve(const size_t size)
+    {
+        size_t cur = reserved_bytes.load(std::memory_order_relaxed);
+        do
+        {
+            if (cur + size > cap_bytes.load(std::memory_order_relaxed))
+                return false;
+        } while (!reserved_bytes.compare_exchange_weak(cur, cur + size,
+            std::memory_order_relaxed));
+
+        size_t peak = high_water.load(std::memory_order_relaxed);
+        while (cur + size > peak &&
+            !high_water.compare_exchange_weak(peak, cur + size, std::memory_order_relaxed));
+
+        return true;
+    } // end Reserve
+
+
+    /**
+     * @brief book keeping for a successful borrow
+     */
+    void Account_Borrow(const size_t size)
+    {
+        in_use_bytes.fetch_add(size, std::memory_order_relaxed);
+        borrows.fetch_add(1, std::memory_order_relaxed);
+    } // end Account_Borrow
+};
@@ -0,0 +1,425 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <string_view>
+#include "neoerr.h"
+#include "bolt/boltvalue.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr int STREAM_MAX_DEPTH = 32;    // deepest nesting of lists/maps/structs in a record
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief receives a record as a sequence of events while it's being decoded;
+ *  override what's of interest, the rest are no-ops. Containers announce their
+ *  size on begin, map entries arrive as key then value. Strings and byte arrays
+ *  may come in several parts when they span recv calls or chunks; last is set
+ *  on the final one (which may be empty).
+ */
+class BoltVisitor
+{
+public:
+
+    virtual ~BoltVisitor() = default;
+
+    virtual void On_Record_Begin() {}
+    virtual void On_Record_End() {}
+
+    virtual void On_Null() {}
+    virtual void On_Bool(bool) {}
+    virtual void On_Int(s64) {}
+    virtual void On_Float(double) {}
+    virtual void On_String(std::string_view /*part*/, bool /*last*/) {}
+    virtual void On_Bytes(std::string_view /*part*/, bool /*last*/) {}
+
+    virtual void On_List_Begin(u32 /*n*/) {}
+    virtual void On_List_End() {}
+    virtual void On_Map_Begin(u32 /*n*/) {}
+    virtual void On_Map_End() {}
+    virtual void On_Struct_Begin(u8 /*tag*/, u32 /*n*/) {}
+    virtual void On_Struct_End() {}
+};
+
+
+/**
+ * @brief a RECORD decoder that can stop at any byte and pick up where it left
+ *  off on the next Feed(); chunk headers, value markers and the bytes of a
+ *  scalar may all be split across calls. Containers being decoded are kept on an
+ *  explicit stack of (kind, items left) so nothing of the message needs to stay
+ *  in the receive buffer once fed, i.e. the buffer only ever has to hold what
+ *  one recv brought in, whatever the size of the record.
+ *
+ * Only RECORD messages are decoded; Feed() stops in front of any other message
+ *  and leaves it for the framed path (summaries, failures) to deal with.
+ */
+class BoltStreamDecoder
+{
+public:
+
+    BoltStreamDecoder() = default;
+
+
+    /**
+     * @brief starts over with a new visitor; any partial message is dropped
+     */
+    void Reset(BoltVisitor* v)
+    {
+        *this = BoltStreamDecoder();
+        visitor = v;
+    } // end Reset
+
+
+    /**
+     * @brief decodes as much of data as there is, emitting events to the visitor.
+     *
+     * @param data bytes as they arrived
+     * @param len number of bytes in data
+     *
+     * @return LB_HASMORE with the bytes consumed when more are needed; LB_OK_INFO
+     *  with the bytes consumed when stopped at the start of a message that isn't
+     *  a RECORD; LB_FAIL with LB_CODE_PROTO on a malformed stream.
+     */
+    LBStatus Feed(const u8* data, const size_t len)
+    {
+        size_t pos = 0;
+        while (pos < len)
+        {
+            if (chunk_left > 0)
+            {
+                size_t n = std::min<size_t>(len - pos, chunk_left);
+                if (!Step(data + pos, n)) return Fail();
+
+                pos += n;
+                chunk_left -= static_cast<u32>(n);
+                continue;
+            } // end if in a chunk
+
+            if (!in_message)
+            {
+                // message boundary; look at the tag before taking it on
+                if (len - pos < 4) break;
+
+                u16 n = ntohs(*(const u16*)(data + pos));
+                if (n == 0) { pos += 2; continue; }     // keep alive
+                if (n < 2 || (data[pos + 2] & 0xF0) != BOLT_STRUCT) return Fail();
+                if (data[pos + 3] != BOLT_RECORD)
+                    return LBOK_INFO(static_cast<u32>(pos));
+
+                in_message = true;
+                value_done = false;
+                chunk_left = n;
+                pos += 2;
+                visitor->On_Record_Begin();
+                continue;
+            } // end if between messages
+
+            // chunk header inside a message, maybe split
+            header[header_have++] = data[pos++];
+            if (header_have < 2) continue;
+
+            header_have = 0;
+            chunk_left = ntohs(*(const u16*)header);
+            if (chunk_left == 0)
+            {
+                if (!value_done || depth != 0) return Fail();
+
+                in_message = false;
+                records++;
+                visitor->On_Record_End();
+            } // end if end of message
+        } // end while
+
+        return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_NONE, static_cast<u32>(pos));
+    } // end Feed
+
+
+    /**
+     * @brief number of complete records decoded since Reset()
+     */
+    u64 Records() const { return records; }
+
+
+    /**
+     * @brief true if stopped in the middle of a record
+     */
+    bool In_Message() const { return in_message; }
+
+private:
+
+    enum class Kind : u8 { Message, List, Map, Struct };
+
+    struct Level
+    {
+        Kind kind;
+        u32 left;       // items (or keys + values) still to come
+    };
+
+    BoltVisitor* visitor = nullptr;
+    u64 records = 0;
+
+    // framing
+    u32 chunk_left = 0;         // payload bytes left in the current chunk
+    u8 header[2]{};             // a chunk header split across feeds
+    u8 header_have = 0;
+    bool in_message = false;
+    bool value_done = false;    // the message struct is complete
+
+    // value in progress
+    u8 marker = 0;              // marker whose trailing bytes are being collected
+    u8 pending[8]{};
+    u8 pending_need = 0;
+    u8 pending_have = 0;
+    u32 blob_left = 0;          // string/bytes payload still to come
+    bool blob_is_string = true;
+
+    Level stack[STREAM_MAX_DEPTH]{};
+    int depth = 0;
+    bool failed = false;
+
+
+    /**
+     * @brief status for a broken stream; the decoder must be Reset() after
+     */
+    LBStatus Fail()
+    {
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
+    } // end Fail
+
+
+    /**
+     * @brief consumes n payload bytes of the current chunk
+     *
+     * @return false on protocol violation
+     */
+    bool Step(const u8* p, size_t n)
+    {
+        while (n > 0 && !failed)
+        {
+            if (value_done) return false;       // bytes past the end of the message
+
+            if (blob_left > 0)
+            {
+                u32 k = static_cast<u32>(std::min<size_t>(n, blob_left));
+                blob_left -= k;
+                Emit_Blob(std::string_view(reinterpret_cast<const char*>(p), k), blob_left == 0);
+                p += k; n -= k;
+                if (blob_left == 0) Value_Done();
+                continue;
+            } // end if inside string/bytes
+
+            if (pending_need > 0)
+            {
+                u8 k = static_cast<u8>(std::min<size_t>(n, pending_need - pending_have));
+                iCpy(pending + pending_have, p, k);
+                pending_have += k;
+                p += k; n -= k;
+                if (pending_have == pending_need) Finish_Pending();
+                continue;
+            } // end if collecting
+
+            Begin_Value(*p++);
+            n--;
+        } // end while
+
+        return !failed;
+    } // end Step
+
+
+    /**
+     * @brief acts on a marker; values that fit the marker are done right away,
+     *  the rest wait for their trailing bytes.
+     */
+    void Begin_Value(const u8 m)
+    {
+        const u8 hi = m & 0xF0;
+        const u8 lo = m & 0x0F;
+
+        if (m < 0x80 || m >= 0xF0) { visitor->On_Int(static_cast<s8>(m)); Value_Done(); return; }
+        if (hi == BOLT_STRINGTINY) { Start_Blob(lo, true); return; }
+        if (hi == BOLT_LISTTINY) { Push(Kind::List, lo); return; }
+        if (hi == BOLT_MAPTINY) { Push(Kind::Map, lo); return; }
+
+        switch (m)
+        {
+        case BOLT_NULL: visitor->On_Null(); Value_Done(); return;
+        case BOLT_BOOL_FALSE: visitor->On_Bool(false); Value_Done(); return;
+        case BOLT_BOOL_TRUE: visitor->On_Bool(true); Value_Done(); return;
+        case BOLT_FLOAT64: case BOLT_INT64: Collect(m, 8); return;
+        case BOLT_INT8: case BOLT_STRING8: case BOLT_LIST8: case BOLT_MAP8: case BOLT_BYTES8: Collect(m, 1); return;
+        case BOLT_INT16: case BOLT_STRING16: case BOLT_LIST16: case BOLT_MAP16: case BOLT_BYTES16: Collect(m, 2); return;
+        case BOLT_INT32: case BOLT_STRING32: case BOLT_LIST32: case BOLT_MAP32: case BOLT_BYTES32: Collect(m, 4); return;
+        default: break;
+        } // end switch
+
+        if (hi == BOLT_STRUCT) { Collect(m, 1); return; }   // the tag follows
+        failed = true;
+    } // end Begin_Value
+
+
+    /**
+     * @brief waits for n bytes following marker m
+     */
+    void Collect(const u8 m, const u8 n)
+    {
+        marker = m;
+        pending_need = n;
+        pending_have = 0;
+    } // end Collect
+
+
+    /**
+     * @brief the bytes after a marker are in; finish the value or open it
+     */
+    void Finish_Pending()
+    {
+        const u8 m = marker;
+        const u8 n = pending_need;
+        pending_need = pending_have = 0;
+
+        u64 v = 0;
+        for (u8 i = 0; i < n; i++) v = (v << 8) | pending[i];
+
+        if ((m & 0xF0) == BOLT_STRUCT)
+        {
+            // the outer most struct is the message itself; [B1 71] + fields
+            if (depth == 0) Push_Level(Kind::Message, m & 0x0F);
+            else
+            {
+                visitor->On_Struct_Begin(static_cast<u8>(v), m & 0x0F);
+                Push_Level(Kind::Struct, m & 0x0F);
+            } // end else nested struct
+            return;
+        } // end if struct
+
+        switch (m)
+        {
+        case BOLT_INT8: visitor->On_Int(static_cast<s8>(v)); break;
+        case BOLT_INT16: visitor->On_Int(static_cast<s16>(v)); break;
+        case BOLT_INT32: visitor->On_Int(static_cast<s32>(v)); break;
+        case BOLT_INT64: visitor->On_Int(static_cast<s64>(v)); break;
+        case BOLT_FLOAT64:
+        {
+            double d;
+            iCpy(&d, &v, sizeof(d));
+            visitor->On_Float(d);
+            break;
+        } // end float
+
+        case BOLT_STRING8: case BOLT_STRING16: case BOLT_STRING32:
+            Start_Blob(static_cast<u32>(v), true);
+            return;
+        case BOLT_BYTES8: case BOLT_BYTES16: case BOLT_BYTES32:
+            Start_Blob(static_cast<u32>(v), false);
+            return;
+        case BOLT_LIST8: case BOLT_LIST16: case BOLT_LIST32:
+            Push(Kind::List, static_cast<u32>(v));
+            return;
+        default:    // maps
+            Push(Kind::Map, static_cast<u32>(v));
+            return;
+        } // end switch
+
+        Value_Done();
+    } // end Finish_Pending
+
+
+    /**
+     * @brief starts a string or byte array of n bytes
+     */
+    void Start_Blob(const u32 n, const bool is_string)
+    {
+        blob_is_string = is_string;
+        blob_left = n;
+        if (n == 0)
+        {
+            Emit_Blob({}, true);
+            Value_Done();
+        } // end if empty
+    } // end Start_Blob
+
+
+    void Emit_Blob(std::string_view part, const bool last)
+    {
+        if (blob_is_string) visitor->On_String(part, last);
+        else visitor->On_Bytes(part, last);
+    } // end Emit_Blob
+
+
+    /**
+     * @brief opens a list or map, closing it right away when empty
+     */
+    void Push(const Kind kind, const u32 n)
+    {
+        if (kind == Kind::List) visitor->On_List_Begin(n);
+        else visitor->On_Map_Begin(n);
+
+        Push_Level(kind, kind == Kind::Map ? 2 * n : n);
+    } // end Push
+
+
+    void Push_Level(const Kind kind, const u32 left)
+    {
+        if (left == 0)
+        {
+            Close(kind);
+            Value_Done();
+            return;
+        } // end if empty
+
+        if (depth == STREAM_MAX_DEPTH) { failed = true; return; }
+        stack[depth++] = { kind, left };
+    } // end Push_Level
+
+
+    void Close(const Kind kind)
+    {
+        switch (kind)
+        {
+        case Kind::List: visitor->On_List_End(); break;
+        case Kind::Map: visitor->On_Map_End(); break;
+        case Kind::Struct: visitor->On_Struct_End(); break;
+        default: break;     // message end is reported with the end marker
+        } // end switch
+    } // end Close
+
+
+    /**
+     * @brief a value completed; count it against its container and close every
+     *  container that it completed in turn.
+     */
+    void Value_Done()
+    {
+        while (depth > 0)
+        {
+            Level& top = stack[depth - 1];
+            if (--top.left > 0) return;
+
+            Close(top.kind);
+            depth--;
+        } // end while
+
+        value_done = true;
+    } // end Value_Done
+};
@@ -0,0 +1,105 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <string_view>
+#include "neoerr.h"
+#include "bolt/bolt_row.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief the summary keys the driver acts on, read off a SUCCESS message without
+ *  decoding it. Integers left at -1 and empty views were not in the message.
+ *  Views point into the message bytes; same lifetime as Fetch_As string_views.
+ */
+struct BoltSummary
+{
+    bool has_more = false;      // PULL stopped at n, more records waiting
+    s64 t_first = -1;           // ms until the first record was available
+    s64 t_last = -1;            // ms until the last record was consumed
+    s64 qid = -1;               // statement id within an explicit transaction
+    std::string_view bookmark;  // causal consistency bookmark
+    std::string_view db;        // database the query ran against
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief scans the metadata map of a SUCCESS message for the keys in BoltSummary;
+ *  anything else (stats, plans, notifications, ...) is stepped over in place.
+ *  Nothing is allocated and the pool is not touched. A known key holding an
+ *  unexpected type is skipped like an unknown one.
+ *
+ * @param p start of the message payload, i.e. the B1 70 struct header
+ * @param end end of the payload
+ * @param s receives what was found; reset first
+ *
+ * @return LB_OK_INFO with the number of keys read into s, alas LB_FAIL with
+ *  LB_CODE_PROTO when it isn't a SUCCESS message or the map is malformed.
+ */
+inline LBStatus Scan_Summary(const u8* p, const u8* end, BoltSummary& s)
+{
+    const LBStatus bad = LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+        LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
+
+    s = BoltSummary();
+
+    u8 tag;
+    u32 fields, n;
+    if (!Unpack::Read_Struct(p, end, tag, fields) || tag != BOLT_SUCCESS || fields < 1)
+        return bad;
+    if (!Unpack::Read_Map(p, end, n)) return bad;
+
+    u32 found = 0;
+    while (n--)
+    {
+        std::string_view key;
+        if (!Unpack::Read_String(p, end, key)) return bad;
+
+        bool ok = false;
+        switch (key.size())
+        {
+        case 2:
+            if (key == "db") ok = Unpack::Read_String(p, end, s.db);
+            break;
+        case 3:
+            if (key == "qid") ok = Unpack::Read_Int(p, end, s.qid);
+            break;
+        case 6:
+            if (key == "t_last") ok = Unpack::Read_Int(p, end, s.t_last);
+            break;
+        case 7:
+            if (key == "t_first") ok = Unpack::Read_Int(p, end, s.t_first);
+            break;
+        case 8:
+            if (key == "has_more") ok = Unpack::Read_Bool(p, end, s.has_more);
+            else if (key == "bookmark") ok = Unpack::Read_String(p, end, s.bookmark);
+            break;
+        default:
+            break;
+        } // end switch
+
+        if (ok) { found++; continue; }
+        if (!(p = Unpack::Skip(p, end))) return bad;
+    } // end while
+
+    return LBOK_INFO(found);
+} // end Scan_Summary
@@ -537,7 +537,7 @@ struct BoltValue
             for (i = 0; i < size; i++)
             {
 				v.buf = buf;
-                jump_table[*ptr](ptr, v);
+                Decode_Value(ptr, v);
                 if (i == index)
                     return v;
             } // end while
@@ -582,8 +582,8 @@ struct BoltValue
 
 					out_key.buf = buf;
 					out_val.buf = buf;
-                    jump_table[*ptr](ptr, out_key);
-                    jump_table[*ptr](ptr, out_val);
+                    Decode_Value(ptr, out_key);
+                    Decode_Value(ptr, out_val);
                     
                     if (out_key.ToString().length() == length && 
                         !strncmp(out_key.ToString().c_str(), key, length))
@@ -1126,7 +1126,7 @@ struct BoltValue
             for (size_t i = 0; i < pval->list_val.size; i++) 
             {
 				v.buf = pval->buf;
-                jump_table[*ptr](ptr, v);
+                Decode_Value(ptr, v);
                 s += v.ToString();
                 if (i != pval->list_val.size - 1)
                     s += ",";
@@ -1162,8 +1162,8 @@ struct BoltValue
 
 				k.buf = pval->buf;
 				v.buf = pval->buf;
-                jump_table[*ptr](ptr, k);
-                jump_table[*ptr](ptr, v);
+                Decode_Value(ptr, k);
+                Decode_Value(ptr, v);
                 s += k.ToString() + ":" + v.ToString();
                 if (i != pval->map_val.size - 1)
                     s += ",";
@@ -1263,7 +1263,7 @@ struct BoltValue
                 {
                     BoltValue v; 
 					v.buf = pval->buf;
-                    jump_table[*ptr](ptr, v);
+                    Decode_Value(ptr, v);
                     s += v.ToString();
                         
                     if (i != pval->struct_val.size - 1)
@@ -1305,10 +1305,10 @@ struct BoltValue
 
         std::string s = "Node:{id:";
 
-        jump_table[*ptr](ptr, temp_id);         // the  node id
-        jump_table[*ptr](ptr, temp_lables);     // node list of labels
-        jump_table[*ptr](ptr, temp_props);      // node poperties
-        jump_table[*ptr](ptr, temp_elemid);     // node element id
+        Decode_Value(ptr, temp_id);         // the  node id
+        Decode_Value(ptr, temp_lables);     // node list of labels
+        Decode_Value(ptr, temp_props);      // node poperties
+        Decode_Value(ptr, temp_elemid);     // node element id
 
         s += std::to_string(temp_id.int_val) + ",lables:" +
             temp_lables.ToString() + ",Properties:" + temp_props.ToString() + 
@@ -1338,14 +1338,14 @@ struct BoltValue
 
         std::string s = "Relationship:{id:";
 
-        jump_table[*ptr](ptr, temp_id);         // the relationship id
-        jump_table[*ptr](ptr, temp_start);      // start node id
-        jump_table[*ptr](ptr, temp_end);        // end node id
-        jump_table[*ptr](ptr, temp_type);       // relationship type
-        jump_table[*ptr](ptr, temp_props);      // relationship properties
-        jump_table[*ptr](ptr, temp_elemid);     // relationship element id
-        jump_table[*ptr](ptr, temp_start_elemid); // start node element id
-        jump_table[*ptr](ptr, temp_end_elemid);   // end node element id
+        Decode_Value(ptr, temp_id);         // the relationship id
+        Decode_Value(ptr, temp_start);      // start node id
+        Decode_Value(ptr, temp_end);        // end node id
+        Decode_Value(ptr, temp_type);       // relationship type
+        Decode_Value(ptr, temp_props);      // relationship properties
+        Decode_Value(ptr, temp_elemid);     // relationship element id
+        Decode_Value(ptr, temp_start_elemid); // start node element id
+        Decode_Value(ptr, temp_end_elemid);   // end node element id
 
         s += std::to_string(temp_id.int_val) + ",startNode:" +
             std::to_string(temp_start.int_val) + ",endNode:" +
@@ -1379,10 +1379,10 @@ struct BoltValue
 
         std::string s = "UnboundRelationship:{id:";
 
-        jump_table[*ptr](ptr, temp_id);         // the relationship id
-        jump_table[*ptr](ptr, temp_type);       // relationship type
-        jump_table[*ptr](ptr, temp_props);      // relationship properties
-        jump_table[*ptr](ptr, temp_elemid);     // relationship element id
+        Decode_Value(ptr, temp_id);         // the relationship id
+        Decode_Value(ptr, temp_type);       // relationship type
+        Decode_Value(ptr, temp_props);      // relationship properties
+        Decode_Value(ptr, temp_elemid);     // relationship element id
 
         s += std::to_string(temp_id.int_val) + ",type:" +
             temp_type.ToString() + ",Properties:" + 
@@ -1410,9 +1410,9 @@ struct BoltValue
 
         std::string s = "Path:{nodes:";
 
-        jump_table[*ptr](ptr, temp_nodes);      // nodes
-        jump_table[*ptr](ptr, temp_rels);       // relationships
-        jump_table[*ptr](ptr, temp_index);      // idices
+        Decode_Value(ptr, temp_nodes);      // nodes
+        Decode_Value(ptr, temp_rels);       // relationships
+        Decode_Value(ptr, temp_index);      // idices
         
 
         s += temp_nodes.ToString() + ",relationships:" +
@@ -1440,7 +1440,7 @@ struct BoltValue
 
         std::string s = "Date:{days:";
 
-        jump_table[*ptr](ptr, temp_day);        // day
+        Decode_Value(ptr, temp_day);        // day
 
         s += std::to_string(temp_day.int_val) + "}";
         return s;
@@ -1465,8 +1465,8 @@ struct BoltValue
 
         std::string s = "Time:{nanoseconds:";
 
-        jump_table[*ptr](ptr, temp_nanosecond);       // hour
-        jump_table[*ptr](ptr, temp_offset_second);     // minute
+        Decode_Value(ptr, temp_nanosecond);       // hour
+        Decode_Value(ptr, temp_offset_second);     // minute
 
         s += std::to_string(temp_nanosecond.int_val) + ",tz_offset_second:" +
             std::to_string(temp_offset_second.int_val)  + "}";
@@ -1492,7 +1492,7 @@ struct BoltValue
 
         std::string s = "LocalTime:{nanoseconds:";
 
-        jump_table[*ptr](ptr, temp_nanosecond);       // hour
+        Decode_Value(ptr, temp_nanosecond);       // hour
 
         s += std::to_string(temp_nanosecond.int_val) + "}";
         return s;
@@ -1518,9 +1518,9 @@ struct BoltValue
 
         std::string s = "DateTime:{seconds:";
 
-        jump_table[*ptr](ptr, temp_seconds);            // date
-        jump_table[*ptr](ptr, temp_nanoseconds);        // time
-        jump_table[*ptr](ptr, temp_offset_seconds);     // time
+        Decode_Value(ptr, temp_seconds);            // date
+        Decode_Value(ptr, temp_nanoseconds);        // time
+        Decode_Value(ptr, temp_offset_seconds);     // time
 
         s += temp_seconds.ToString() + ",nanoseconds:" + 
             temp_nanoseconds.ToString() + ",tz_offset_seconds:" + 
@@ -1548,9 +1548,9 @@ struct BoltValue
 
         std::string s = "DateTime:{seconds:";
 
-        jump_table[*ptr](ptr, temp_seconds);            // date
-        jump_table[*ptr](ptr, temp_nanoseconds);        // time
-        jump_table[*ptr](ptr, temp_id);                 // id
+        Decode_Value(ptr, temp_seconds);            // date
+        Decode_Value(ptr, temp_nanoseconds);        // time
+        Decode_Value(ptr, temp_id);                 // id
 
         s += temp_seconds.ToString() + ",nanoseconds:" + 
             temp_nanoseconds.ToString() + ",tz_id:" + 
@@ -1577,8 +1577,8 @@ struct BoltValue
 
         std::string s = "LocalDateTime:{seconds:";
 
-        jump_table[*ptr](ptr, temp_seconds);            // date
-        jump_table[*ptr](ptr, temp_nanoseconds);        // time
+        Decode_Value(ptr, temp_seconds);            // date
+        Decode_Value(ptr, temp_nanoseconds);        // time
 
         s += temp_seconds.ToString() + ",seconds:" + 
             temp_nanoseconds.ToString() + "}";
@@ -1604,10 +1604,10 @@ struct BoltValue
 
         std::string s = "Duration:{months:";
 
-        jump_table[*ptr](ptr, temp_months);            // months
-        jump_table[*ptr](ptr, temp_days);              // days
-        jump_table[*ptr](ptr, temp_seconds);           // seconds
-        jump_table[*ptr](ptr, temp_nanoseconds);       // nanoseconds
+        Decode_Value(ptr, temp_months);            // months
+        Decode_Value(ptr, temp_days);              // days
+        Decode_Value(ptr, temp_seconds);           // seconds
+        Decode_Value(ptr, temp_nanoseconds);       // nanoseconds
 
         s += std::to_string(temp_months.int_val) + ",days:" +
             std::to_string(temp_days.int_val) + ",seconds:" +
@@ -1635,9 +1635,9 @@ struct BoltValue
 
         std::string s = "Point2D:{srid:";
 
-        jump_table[*ptr](ptr, tempi);    // integer value
-        jump_table[*ptr](ptr, tempx);    // float x value
-        jump_table[*ptr](ptr, tempy);    // float y value
+        Decode_Value(ptr, tempi);    // integer value
+        Decode_Value(ptr, tempx);    // float x value
+        Decode_Value(ptr, tempy);    // float y value
 
         s += std::to_string(static_cast<u32>(tempi.int_val)) + ",x:" +
             tempx.ToString() + ",y:" + tempy.ToString() + "}";
@@ -1663,10 +1663,10 @@ struct BoltValue
 
         std::string s = "Point3D:{srid:";
 
-        jump_table[*ptr](ptr, tempi);    // integer value
-        jump_table[*ptr](ptr, tempx);    // float x value
-        jump_table[*ptr](ptr, tempy);    // float y value
-        jump_table[*ptr](ptr, tempz);    // float z value
+        Decode_Value(ptr, tempi);    // integer value
+        Decode_Value(ptr, tempx);    // float x value
+        Decode_Value(ptr, tempy);    // float y value
+        Decode_Value(ptr, tempz);    // float z value
 
         s += std::to_string(static_cast<u32>(tempi.int_val)) + ",x:" +
             tempx.ToString() + ",y:" + tempy.ToString() + ",z:" + tempz.ToString() + "}";
@@ -17,7 +17,8 @@
 //===============================================================================|
 //          INCLUDES
 //===============================================================================|
-
+#include <atomic>
+#include "utils/page_alloc.h"
 
 
 //===============================================================================|
@@ -25,6 +26,7 @@
 //===============================================================================|
 constexpr u32 SCRATCH_SIZE = 1024;      // static array size for scratch buffers
 constexpr u32 ARENA_SIZE = 4096;        // size of the fast growing buffer
+constexpr u32 LOG_KEEP = 64;            // allocation log entries a trim leaves room for
 
 
 
@@ -38,6 +40,31 @@ constexpr u32 ARENA_SIZE = 4096;        // size of the fast growing buffer
 
 //===============================================================================|
 //          TYPES
+//===============================================================================|
+/**
+ * @brief a snapshot of one thread's BoltPool; see BoltPool::Stats(). Sizes are
+ *  in elements but for bytes, the high-water marks being the most each held
+ *  since the pool was made.
+ */
+struct PoolStats
+{
+    size_t scratch_used = 0;
+    size_t scratch_high = 0;
+    size_t arena_used = 0;
+    size_t arena_capacity = 0;
+    size_t arena_high = 0;
+    size_t log_length = 0;          // allocations outstanding
+    size_t log_high = 0;
+    size_t bytes = 0;               // reserved for scratch, arena and the log
+    size_t limit = 0;               // bytes past which the pool trims, 0 for none
+
+    u64 grows = 0;                  // of the arena
+    u64 shrinks = 0;
+    u64 resets = 0;                 // Reset_All()s
+    u64 bytes_moved = 0;            // copied growing and shrinking the arena
+};
+
+
 //===============================================================================|
 /**
  * @brief A scratch buffer that is used to store BoltValues temporarily
@@ -132,15 +159,23 @@ struct ArenaAllocator
     T *data = nullptr;
     size_t used = 0;
     size_t capacity = 0;
+    PageBlock block;        // where data's pages came from
+
+    size_t high = 0;        // the most ever used
+    u64 grows = 0;
+    u64 shrinks = 0;
+    u64 bytes_moved = 0;    // copied to new blocks growing and shrinking
 
 
     /**
      * @brief constructor allocate's the arena buffer safe. Large enough for 
-     *  most cases; even scratch was delibertaly made large to maximize gain
+     *  most cases; even scratch was delibertaly made large to maximize gain.
+     *  Pages follow the process wide policy, see PageAlloc::Set_Default_Policy.
      */
     ArenaAllocator(const size_t initial_size = ARENA_SIZE)
     {
-        data = (T*)malloc(sizeof(T) * initial_size);
+        block = PageAlloc::Allocate(sizeof(T) * initial_size);
+        data = reinterpret_cast<T*>(block.ptr);
         if (!data) 
         {
             throw std::runtime_error("Failed to allocate memory for ArenaAllocator");
@@ -156,7 +191,7 @@ struct ArenaAllocator
     ~ArenaAllocator()
     {
         if (data)
-            free(data);
+            PageAlloc::Release(block);
         data = nullptr;     // double-tap
         used = 0;
         capacity = 0;
@@ -179,30 +214,70 @@ struct ArenaAllocator
 
         size_t offset = used;
         used += count;
+        if (used > high) high = used;
         return offset;
     } // end Alloc
 
     
     /**
      * @brief Grows the Arena by the number of bytes specified by parameter
-     *  which is usually double of what it was before.
+     *  which is usually double of what it was before. Memory is moved to a
+     *  fresh block, realloc style, so the new pages honour the current policy.
      * 
      * @param cap the new capacity to set (resize)
      */
     void Grow(const size_t new_cap)
     {
-        T* new_data = static_cast<T*>(realloc(data, sizeof(T) * new_cap));
-        if (!new_data) 
+        PageBlock new_block = PageAlloc::Allocate(sizeof(T) * new_cap);
+        if (!new_block.ptr) 
         {
             std::runtime_error("Failed to grow ArenaAllocator");
             return;
         } // end if failed
 
-        data = new_data;
+        iCpy(new_block.ptr, data, sizeof(T) * capacity);
+        PageAlloc::Release(block);
+
+        bytes_moved += sizeof(T) * capacity;
+        block = new_block;
+        data = reinterpret_cast<T*>(new_block.ptr);
         capacity = new_cap;
+        grows++;
     } // end Grow
 
 
+    /**
+     * @brief the opposite of Grow(); moves what's in use to a smaller block of
+     *  new_cap, never less than used. Offsets stay as they were, pointers got
+     *  through Get() don't, same as after growing.
+     *
+     * @param new_cap the capacity to shrink to
+     *
+     * @return true if it shrank
+     */
+    bool Shrink(size_t new_cap)
+    {
+        new_cap = std::max(new_cap, used);
+        if (new_cap == 0 || new_cap >= capacity)
+            return false;
+
+        PageBlock new_block = PageAlloc::Allocate(sizeof(T) * new_cap);
+        if (!new_block.ptr)
+            return false;   // keep the bigger one then
+
+        if (used > 0)
+            iCpy(new_block.ptr, data, sizeof(T) * used);
+        PageAlloc::Release(block);
+
+        bytes_moved += sizeof(T) * used;
+        block = new_block;
+        data = reinterpret_cast<T*>(new_block.ptr);
+        capacity = new_cap;
+        shrinks++;
+        return true;
+    } // end Shrink
+
+
     /**
      * @brief Resets the arena allocator to its initial state.
      */
@@ -271,6 +346,12 @@ struct BoltPool
     ArenaAllocator<T> arena;
     ScratchBuffer<T, SCRATCH_SIZE> scratch;
 
+    size_t scratch_high = 0;    // the most scratch ever held
+    size_t log_high = 0;        // the most allocations ever outstanding
+    u64 resets = 0;
+
+    inline static std::atomic<size_t> limit{ 0 };  // for every thread's pool, see Set_Limit()
+
 
     /**
      * @brief Resets the pool, clearing all allocations and buffers.
@@ -280,9 +361,94 @@ struct BoltPool
         scratch.Reset();
         arena.Reset();
         allocation_log.clear();
+        resets++;
     } // end Reset_All
 
 
+    /**
+     * @brief the bytes this pool holds on to; scratch, the arena and the
+     *  allocation log, used or not
+     */
+    size_t Bytes() const
+    {
+        return sizeof(T) * (SCRATCH_SIZE + arena.capacity) +
+            sizeof(Allocation) * allocation_log.capacity();
+    } // end Bytes
+
+
+    /**
+     * @brief where this pool stands and the most it ever held; the owning
+     *  thread only, as the pool is thread-local.
+     */
+    PoolStats Stats() const
+    {
+        PoolStats s;
+        s.scratch_used = scratch.size;
+        s.scratch_high = scratch_high;
+        s.arena_used = arena.used;
+        s.arena_capacity = arena.capacity;
+        s.arena_high = arena.high;
+        s.log_length = allocation_log.size();
+        s.log_high = log_high;
+        s.bytes = Bytes();
+        s.limit = limit.load(std::memory_order_relaxed);
+        s.grows = arena.grows;
+        s.shrinks = arena.shrinks;
+        s.resets = resets;
+        s.bytes_moved = arena.bytes_moved;
+        return s;
+    } // end Stats
+
+
+    /**
+     * @brief sets how many bytes any thread's pool may hold before it trims at
+     *  its next safe point, see Trim(); 0 (the default) for no limit. Below the
+     *  pool's floor, scratch plus an ARENA_SIZE arena, it trims at every one.
+     *
+     * @param bytes the limit
+     */
+    static void Set_Limit(const size_t bytes)
+    {
+        limit.store(bytes, std::memory_order_relaxed);
+    } // end Set_Limit
+
+
+    /**
+     * @brief true if there's a limit and this pool holds more than it
+     */
+    bool Over_Limit() const
+    {
+        const size_t l = limit.load(std::memory_order_relaxed);
+        return l && Bytes() > l;
+    } // end Over_Limit
+
+
+    /**
+     * @brief hands memory back to the system; with nothing allocated the pool
+     *  is reset and its log cut back to LOG_KEEP entries, otherwise the arena
+     *  shrinks to twice what's in use (ARENA_SIZE at least). The arena moves, so
+     *  only at a safe point where no pointers into it are held; Release_Pool()
+     *  does it for a pool over its limit. A log in use is left be, as is one
+     *  already cut back, lest a pool over its limit reallocate it per release.
+     *
+     * @return true if the arena shrank
+     */
+    bool Trim()
+    {
+        if (allocation_log.empty())
+        {
+            Reset_All();
+            if (allocation_log.capacity() > LOG_KEEP)
+            {
+                std::vector<Allocation>().swap(allocation_log);
+                allocation_log.reserve(LOG_KEEP);
+            } // end if grown past the floor
+        } // end if nothing allocated
+
+        return arena.Shrink(std::max<size_t>(ARENA_SIZE, arena.used << 1));
+    } // end Trim
+
+
     /**
      * @brief Allocates count elements. Returns global offset.
      */
@@ -298,6 +464,7 @@ struct BoltPool
             // Fully in scratch
             scratch.Alloc(count);
             allocation_log.push_back({ offset, count });
+            Mark_High();
             return offset;
         } // end if scratch available
 
@@ -315,10 +482,21 @@ struct BoltPool
 
         if (used_from_scratch == 0) offset = arena_local_offset + scratch.size;
         allocation_log.push_back({ offset, count });
+        Mark_High();
         return offset;
     } // end Alloc
 
 
+    /**
+     * @brief keeps the scratch and log high-water marks after an Alloc()
+     */
+    void Mark_High()
+    {
+        if (scratch.size > scratch_high) scratch_high = scratch.size;
+        if (allocation_log.size() > log_high) log_high = allocation_log.size();
+    } // end Mark_High
+
+
     /**
      * @brief Releases the most recent allocation (LIFO)
      * 
@@ -405,6 +583,8 @@ inline BoltPool<T>* GetBoltPool()
 
 /**
  * @brief releases all allocations in the BoltPool up to the specified offset.
+ *  That being the end of whatever made them, the pool is trimmed here if over
+ *  its limit; see BoltPool::Set_Limit().
  * 
  * @tparam T the type of data to store in the pool
  */
@@ -416,4 +596,7 @@ inline void Release_Pool(const size_t offset)
     {
         pool->Release();
 	} // end while
+
+    if (pool->Over_Limit())
+        pool->Trim();
 } // end ResetBoltPool
\ No newline at end of file
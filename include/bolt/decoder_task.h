@@ -16,8 +16,13 @@
  //          INCLUDES
  //===============================================================================|
 #include <cmath>
+#include <atomic>
+#include <mutex>
 #include "connection/neoconnection.h"
 #include "bolt/bolt_result.h"
+#include "bolt/bolt_stream_decoder.h"
+#include "utils/small_fn.h"
+#include "utils/red_stats.h"
 
 
 
@@ -53,6 +58,184 @@ enum class TaskState : u8 {
 constexpr int QUERY_STATES = 16;
 
 
+/**
+ * @brief the stages a query goes through, in order; each task stamps when it
+ *  got to them so a slow query can be told apart by where the time went.
+ */
+enum class QueryStage : u8 {
+    Submit,         // task queued by Run()
+    Encoded,        // RUN and PULL in the write buffer
+    Flushed,        // handed to the socket
+    First_Byte,     // first recv holding any of its response
+    Run_Success,    // RUN's SUCCESS decoded, field names known
+    First_Record,   // first RECORD framed
+    Final_Success,  // the last summary decoded; the result is complete
+};
+constexpr int QUERY_STAGE_COUNT = 7;   // callbacks are timed apart, see CallbackStages
+
+
+/**
+ * @brief the histogram stages and callbacks are kept in; one significant digit
+ *  (within 1/16) as a connection keeps nine of them, about 5 KiB apiece rather
+ *  than LatencyHistogram's 36. The whole of a query is in the connection's
+ *  LatencyHistogram at full precision.
+ */
+using StageHistogram = HdrHistogram<1>;
+
+
+/**
+ * @brief when a task reached each QueryStage, in steady clock nanoseconds; 0 for
+ *  not (yet). Encoded and Flushed are stamped by the submitting thread after the
+ *  task is queued while the decoding thread stamps the rest, hence atomics; a
+ *  response decoded before its Flush() even returned simply misses the stamp.
+ */
+struct StageStamps
+{
+    std::atomic<s64> at[QUERY_STAGE_COUNT]{};
+
+    StageStamps() = default;
+    explicit StageStamps(const s64 submit) { at[0].store(submit, std::memory_order_relaxed); }
+    StageStamps(StageStamps&& other) noexcept { Take(other); }
+    StageStamps& operator=(StageStamps&& other) noexcept { Take(other); return *this; }
+
+    void Stamp(const QueryStage s, const s64 ns = Now())
+    {
+        at[u8(s)].store(ns, std::memory_order_release);
+    } // end Stamp
+
+    s64 operator[](const QueryStage s) const
+    {
+        return at[u8(s)].load(std::memory_order_acquire);
+    } // end operator[]
+
+    static s64 Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    } // end Now
+
+private:
+
+    void Take(StageStamps& other)
+    {
+        for (int i = 0; i < QUERY_STAGE_COUNT; i++)
+            at[i].store(other.at[i].load(std::memory_order_acquire), std::memory_order_relaxed);
+    } // end Take
+};
+
+
+/**
+ * @brief per stage latency histograms of a connection; stage[s] holds the time
+ *  from the stage stamped before s to s, so encode, send, server and our own
+ *  decode time each get their own distribution. stage[Submit] holds the whole
+ *  of it, submit to final SUCCESS.
+ */
+struct StageLatencies
+{
+    StageHistogram stage[QUERY_STAGE_COUNT];
+
+
+    /**
+     * @brief records a completed task's stamps, up to Final_Success; callbacks
+     *  are recorded in CallbackStages by whoever runs them
+     */
+    void Record(const StageStamps& s)
+    {
+        s64 prev = s[QueryStage::Submit];
+        s64 done = s[QueryStage::Final_Success];
+        if (!prev || !done) return;
+
+        for (u8 i = u8(QueryStage::Encoded); i <= u8(QueryStage::Final_Success); i++)
+        {
+            s64 at = s[QueryStage(i)];
+            if (!at || at < prev) continue;     // not stamped or raced; skip it
+
+            stage[i].Record_Latency(std::chrono::nanoseconds(at - prev));
+            prev = at;
+        } // end for
+
+        stage[0].Record_Latency(std::chrono::nanoseconds(done - s[QueryStage::Submit]));
+    } // end Record
+
+
+    void Merge(const StageLatencies& other)
+    {
+        for (int i = 0; i < QUERY_STAGE_COUNT; i++)
+            stage[i].Merge(other.stage[i]);
+    } // end Merge
+
+
+    void Clear()
+    {
+        for (auto& h : stage) h.Clear();
+    } // end Clear
+
+
+    /**
+     * @brief a short name for a stage's histogram, for reports
+     */
+    static const char* Name(const QueryStage s)
+    {
+        static const char* names[QUERY_STAGE_COUNT] = {
+            "total", "encode", "flush", "first_byte", "run_success",
+            "first_record", "final_success"
+        };
+        return names[u8(s)];
+    } // end Name
+};
+
+
+/**
+ * @brief the callback stages of a connection's tasks; recorded by the thread
+ *  running the callbacks, inline or an executor's, under the lock.
+ */
+struct CallbackStages
+{
+    std::mutex lock;
+    StageHistogram wait;    // final SUCCESS to the callback starting
+    StageHistogram run;     // the callback itself
+
+
+    /**
+     * @brief records n callbacks' stamps under one lock
+     */
+    void Record(const s64* done, const s64* started, const s64* ended, const size_t n)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (size_t i = 0; i < n; i++)
+        {
+            if (done[i] && started[i] >= done[i])
+                wait.Record_Latency(std::chrono::nanoseconds(started[i] - done[i]));
+            run.Record_Latency(std::chrono::nanoseconds(ended[i] - started[i]));
+        } // end for
+    } // end Record
+};
+
+
+/**
+ * @brief completion callback for async queries; captures live inline in the
+ *  task (no heap) and are invoked on the polling thread once the result is done.
+ */
+using ResultCallback = SmallFn<void(BoltResult&)>;
+
+
+/**
+ * @brief a callback with its finished result, stamped when it was queued; what
+ *  a connection hands a CompletionExecutor, COMPLETION_BATCH at most at once.
+ */
+struct Completion
+{
+    ResultCallback cb;
+    BoltResult result;
+    std::chrono::steady_clock::time_point queued;
+    s64 done_ns = 0;                    // Final_Success stamp of its task
+    CallbackStages* stages = nullptr;   // its connection's, to record the callback in
+};
+
+using CompletionBatch = std::vector<Completion>;
+constexpr static size_t COMPLETION_BATCH = 64;
+
+
 /**
  * @brief command types for my cellular model
  */
@@ -92,13 +275,17 @@ struct DecoderTask
     TaskState state;        // current state of the query
     BoltView view;          // view into the buffer for this query
 
-    std::chrono::_V2::system_clock::time_point start_clock = 
-        std::chrono::high_resolution_clock::now();  // starting point for timer, always now!
-    std::function<void(BoltResult&)> cb = nullptr;  // a callback for async procs ideal for web apps.
+    StageStamps stamps{ StageStamps::Now() };  // when it got to each stage; submitted now!
+    ResultCallback cb = nullptr;    // a callback for async procs ideal for web apps.
+    BoltVisitor* visitor = nullptr; // records are streamed to it instead of kept in buffer
+    int pull_n = -1;                // records per PULL; > 0 with cb hands each batch over
+    u32 sample = 0;                 // its QuerySampler slot plus one; 0 for not sampled
 
     DecoderTask() = default;
     DecoderTask(TaskState s) : state(s) { }
-	DecoderTask(TaskState s, std::function<void(BoltResult&)> c) : state(s), cb(c) {}
+	DecoderTask(TaskState s, ResultCallback&& c) : state(s), cb(std::move(c)) {}
+    DecoderTask(TaskState s, ResultCallback&& c, BoltVisitor* v) 
+        : state(s), cb(std::move(c)), visitor(v) {}
     DecoderTask(const DecoderTask&) = delete;
     DecoderTask(DecoderTask&&) = default;
 
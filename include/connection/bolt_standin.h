@@ -0,0 +1,100 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 17th of October 2026, Saturday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "neoerr.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief how a BoltStandin answers
+ */
+struct StandinSpec
+{
+    u16 port = 0;               // on 127.0.0.1; 0 for any free one
+    u8 major = 5;               // the version it agrees to
+    u8 minor = 4;
+    u32 rows = 10;              // records in every result
+    std::chrono::nanoseconds service{ 0 };     // time a query takes, per connection
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief a local stand-in for a Bolt server, for driving the driver with no
+ *  Neo4j about; i.e. load generation, or its own overheads measured alone. It
+ *  negotiates a version, answers HELLO, LOGON and everything else bar RUN and
+ *  PULL with an empty SUCCESS, RUN with two fields and PULL with the next n of
+ *  spec.rows records, n as the PULL asks (all for -1), ending in a SUCCESS with
+ *  has_more until the last. A query starting with FAIL fails half way through
+ *  its records instead, with a FAILURE; the session carries on regardless, no
+ *  RESET needed. GOODBYE hangs up.
+ *
+ *  Every connection gets a thread of its own answering its requests in order,
+ *  as a server's session does; responses are encoded once on Start(). Stall()
+ *  holds responses back for a while, i.e. a server pausing for a collection.
+ */
+class BoltStandin
+{
+public:
+
+    BoltStandin() = default;
+    ~BoltStandin();
+
+    LBStatus Start(const StandinSpec& spec);
+    void Stop();
+    u16 Port() const;
+    std::string Url() const;
+    void Stall(const std::chrono::nanoseconds d);
+    u64 Queries() const;
+
+private:
+
+    StandinSpec spec;
+    int listen_fd = -1;
+    int wake_fd = -1;           // eventfd; Stop() wakes every thread through it
+    u16 bound_port = 0;
+    std::thread accept_thread;
+    std::mutex lock;            // over sessions
+    std::vector<std::thread> sessions;
+    std::atomic<s64> stall_until{ 0 };     // steady clock ns; responses wait till then
+    std::atomic<u64> queries{ 0 };         // RUNs answered
+
+    // responses, encoded once
+    std::vector<u8> success;    // SUCCESS {}
+    std::vector<u8> hello;      // SUCCESS {server, connection_id}
+    std::vector<u8> run;        // SUCCESS {fields, t_first}
+    std::vector<u8> records;    // spec.rows RECORDs then SUCCESS {type, t_last, db}
+    std::vector<size_t> record_at;  // where each record starts in records; the summary last
+    std::vector<u8> more;       // SUCCESS {has_more}, ending a batch
+    std::vector<u8> failure;    // FAILURE {code, message}, for queries starting with FAIL
+
+    void Encode_Responses();
+    void Accept_Loop();
+    void Serve(const int fd);
+    void Answer_Pull(std::vector<u8>& out, u32& streamed, const s64 n, const bool failing);
+    bool Handshake(const int fd);
+    bool Read_Full(const int fd, u8* buf, const size_t len);
+    bool Write_All(const int fd, const u8* data, const size_t len);
+};
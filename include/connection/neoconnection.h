@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 9th of April 2025, Wednesday
- * @date updated 27th of Feburary 2026, Friday
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -12,12 +12,16 @@
  //          INCLUDES
  //===============================================================================|
 #include "connection/tcp_client.h"
+#include "connection/wire_capture.h"
 #include "bolt/bolt_decoder.h"
 #include "bolt/bolt_encoder.h"
 #include "bolt/decoder_task.h"
+#include "connection/query_sampler.h"
 #include "bolt/bolt_auth.h"
 #include "utils/lock_free_queue.h"
 #include "utils/red_stats.h"
+#include "utils/completion_signal.h"
+#include "utils/metrics.h"
 
 
 
@@ -43,11 +47,39 @@ struct Neo4jVerInfo
 
 
 
+/**
+ * @brief a connection's counters written by the thread submitting its queries,
+ *  apart from those of the thread decoding them so neither writes to the other's
+ *  cache line.
+ */
+struct alignas(CACHE_LINE_SIZE) SubmitCounters
+{
+    MetricCounter queries;      // RUNs queued
+    MetricCounter bytes_out;    // bytes handed to the socket
+    MetricCounter tasks_high;   // deepest the task queue got
+    MetricCounter requests_high;    // and the cell's request queue
+};
+
+
+/**
+ * @brief and those written by the thread decoding its responses
+ */
+struct alignas(CACHE_LINE_SIZE) DecodeCounters
+{
+    MetricCounter bytes_in;     // bytes received
+    MetricCounter failures;     // FAILURE messages
+    MetricCounter recv_pauses;  // times recv stopped on a full buffer
+    MetricCounter results_high; // deepest the results queue got
+};
+
+
+
 //===============================================================================|
 //          CLASS
 //===============================================================================|
 // forward declation
 class NeoCell;
+class CompletionExecutor;
 
 
 /**
@@ -62,10 +94,12 @@ class NeoCell;
 class NeoConnection : public TcpClient
 {
     friend class NeoCell;
+    friend class WireReplay;
 
 public:
 
-    NeoConnection(const std::string& urls, BoltValue* pauth, BoltValue* pextras);
+    NeoConnection(const std::string& urls, BoltValue* pauth, BoltValue* pextras,
+        BufferSlab* pslab = nullptr);
     ~NeoConnection();
 
     LBStatus Negotiate_Version();
@@ -76,7 +110,13 @@ public:
         const BoltValue& params, 
         const BoltValue& extras, 
         const int chunks,
-        std::function<void(BoltResult&)> cb = nullptr);
+        ResultCallback cb = nullptr,
+        BoltVisitor* visitor = nullptr);
+    template<Bolt_Param_Type... Ps>
+    LBStatus Run_Typed(const char* cypher,
+        const int n,
+        ResultCallback cb,
+        const Ps&... params);
     LBStatus Begin(const BoltValue& options = BoltValue::Make_Map());
     LBStatus Commit(const BoltValue& options = BoltValue::Make_Map());
     LBStatus Rollback(const BoltValue& options = BoltValue::Make_Map());
@@ -102,27 +142,48 @@ private:
     // connection paramters; kept inside driver
     BoltValue* pauth;       // authentication token
     BoltValue* pextras;     // extra connection parameters
+    BufferSlab* pslab;      // buffers and results held off read_buf borrow from it, if any
 
     int client_id;          // optional connection identifer
     int tran_count;		    // number of transactions executed; simulates nesting
 	int current_msg_len;    // length of the current message being decoded; used for partial decoding
+    size_t stream_base;     // read buffer offset a streamed result is decoded over and over at
     int unconsumed_count;   // prevents infinite loops due to Compact and Consume stalls
 
-    bool recv_paused;           // have we paused recv because of mem issues?
-    std::atomic<bool> is_done;  // used to notifiy whenever a streaming batch is ready
+    std::atomic<bool> recv_paused;  // have we paused recv because of mem issues? read by exporters
+    std::atomic<u64> write_owner{ 0 };  // the thread encoding into write_buf, WRITE_PARKING while parking it
+    CompletionSignal done;      // counts results completed for Fetch(), not yet taken
 
     LockFreeQueue<DecoderTask> tasks;   // queue of pipelined query requests & responses
     LockFreeQueue<BoltResult> results;  // queue of results ready to be fetched by the user
 
-    // storage buffers
+    // storage buffers; borrowed from the driver's slab when given one
     BoltBuf read_buf;
     BoltBuf write_buf;
 
     BoltEncoder encoder;
     BoltDecoder decoder;
+    BoltStreamDecoder stream;   // for tasks with a visitor; records never pile up in read_buf
 
     Neo4jVerInfo supported_version; // holds major and minor versions for server
     LatencyHistogram latencies;     // latency measurement structure
+    StageLatencies stages;          // and where it went, per stage; decoding thread only
+    CallbackStages callbacks;       // callback stages, from whichever thread runs them
+    s64 last_recv_ns = 0;           // when the last recv brought bytes in; First_Byte
+
+    SubmitCounters submit_counters;
+    DecodeCounters decode_counters;
+
+    WireCapture capture;            // bytes sent and received, when asked to
+    QuerySampler sampler;           // slow and one in n queries, when asked to
+
+    CompletionExecutor* pexec = nullptr;    // runs callbacks off this thread unless inline
+    CompletionBatch completions;            // callbacks done this read, not yet handed over
+
+    std::mutex batch_lock;      // one batch handed to batch_cb at a time
+    ResultCallback batch_cb;    // a Run_Batched() query's callback; its task relays every batch
+    std::atomic<bool> batching{ false };    // a batched query owns the cell till its last batch
+    std::atomic<bool> more_due{ false };    // a batch was handed over; Request_More() may send once
 
 
     //====================
@@ -132,10 +193,25 @@ private:
     LBStatus Poll_Readable();
     LBStatus Decode_One(DecoderTask& task);
     LBStatus Can_Decode(u8* view, const u32 bytes_remain);
+    LBStatus Decode_Stream(DecoderTask& task, u8* view, const u32 bytes_remain);
+    bool Is_Streaming();
     int Get_Client_ID() const;
     LBStatus Flush();
+    void Claim_Write();
+    void Release_Write();
+    bool Park_Write();
+
+    /**
+     * @brief holds write_buf claimed for a scope and lets go of it however the
+     *  scope is left, unless a Flush() let go already
+     */
+    struct WriteClaim
+    {
+        NeoConnection& conn;
+        explicit WriteClaim(NeoConnection& c) : conn(c) { conn.Claim_Write(); }
+        ~WriteClaim() { conn.Release_Write(); }
+    };
 
-    bool Is_Record_Done(BoltMessage& summary);
     LBStatus Encode_And_Flush(TaskState s, BoltMessage& v);
 
     // state based handlers
@@ -148,9 +224,20 @@ private:
     inline LBStatus Handle_Record(DecoderTask& task);
     inline LBStatus Handle_Failure(DecoderTask& task);
     inline LBStatus Handle_Ignored();
+    inline void Complete(DecoderTask& task);
+    bool Hold(BoltResult& result);
+    void Deliver_Batch(DecoderTask& task, const u32 summary_size);
+    void Hand_Batch(BoltResult& batch, const bool last);
+    std::optional<std::reference_wrapper<BoltResult>> In_Flight();
+    void Flush_Completions();
 
     void Encode_Pull(const int n);
-    void Wait_Task();
+    LBStatus Request_More(const int n, const bool discard);
+    void Stamp_Last(const QueryStage s);
+    void Record_Stages(DecoderTask& task);
+    void Note_Request(const u32 sample, const size_t before);
+    StageLatencies Stage_Snapshot();
+    bool Wait_Task(const CompletionSignal::duration timeout = CompletionSignal::FOREVER);
     void Wake();
 
     BoltMessage Routev43(const BoltValue& routing,
@@ -180,4 +267,76 @@ private:
         &NeoConnection::Success_Reset,
         &NeoConnection::Success_Reset,
     };
-};
\ No newline at end of file
+};
+
+
+
+//===============================================================================|
+//          TEMPLATES
+//===============================================================================|
+/**
+ * @brief the typed sibling of Run(); parameters made via P() are packed straight
+ *  into the write buffer along with the RUN message, followed by a PULL.
+ *
+ * @param cypher the cypher query string
+ * @param n the number of records to request per PULL, -1 for all
+ * @param cb optional callback for async results
+ * @param params the query parameters
+ *
+ * @return LB_OK on success, alas LB_FAIL with the domain at fault
+ */
+template<Bolt_Param_Type... Ps>
+LBStatus NeoConnection::Run_Typed(const char* cypher,
+    const int n,
+    ResultCallback cb,
+    const Ps&... params)
+{
+    if (batching.load(std::memory_order_acquire))     // a batched query owns the cell
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE,
+            LBStage::LB_STAGE_QUERY, LBCode::LB_CODE_TASKSTATE);
+
+    DecoderTask task(TaskState::Run, std::move(cb));    // submitted now
+    const size_t len = strlen(cypher);
+    WriteClaim claim(*this);
+    size_t before = write_buf.Size();
+    LBStatus rc = encoder.Encode_Run(cypher, len, nullptr, params...);
+    if (LBAction(LB_Action(rc)) == LBAction::LB_FLUSH)
+    {
+        // push whatever is pending out and retry on the emptied buffer
+        rc = Flush();
+        Claim_Write();
+        before = write_buf.Size();
+        if (LB_OK(rc)) rc = encoder.Encode_Run(cypher, len, nullptr, params...);
+        if (LBAction(LB_Action(rc)) == LBAction::LB_FLUSH)
+        {
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+                LBStage::LB_STAGE_QUERY, LBCode::LB_CODE_STATE_MEM);
+        } // end if still no room
+    } // end if out of space
+    if (!LB_OK(rc)) return rc;
+
+    if (sampler.Enabled())
+        task.sample = sampler.Note(cypher, len, u32(sizeof...(Ps)), tasks.Size());
+    const u32 sample = task.sample;
+    if (!tasks.Enqueue(std::move(task)))
+    {
+        // drop the unsent RUN, keeping whatever was pending ahead of it
+        write_buf.Skip(-static_cast<ptrdiff_t>(write_buf.Size() - before));
+        return LB_Make(
+            LBAction::LB_FAIL,
+            LBDomain::LB_DOM_STATE,
+            LBStage::LB_STAGE_QUERY,
+            LBCode::LB_CODE_STATE_QUEUE_MEM
+        );
+    } // end if enqueue error
+
+    submit_counters.queries.Add();
+    submit_counters.tasks_high.Max(tasks.Size());
+
+    Encode_Pull(n);
+    Stamp_Last(QueryStage::Encoded);
+    if (sample) Note_Request(sample, before);
+    rc = Flush();
+    Stamp_Last(QueryStage::Flushed);
+    return rc;
+} // end Run_Typed
@@ -0,0 +1,152 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bolt/decoder_task.h"        // as with it, include connection/neoconnection.h instead
+#include "utils/lock_free_queue.h"
+#include "utils/metrics.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+constexpr static size_t SAMPLE_RING_SIZE = 256;     // a connection holds one less till taken
+constexpr static size_t SAMPLE_SLOTS = 1024;        // queries in flight whose text is kept
+constexpr static size_t SAMPLE_TEXT_MAX = 1024;     // bytes of query text kept, the rest cut
+
+
+/**
+ * @brief which queries get sampled; those slower than threshold, submit to
+ *  final SUCCESS, and one in every one_in besides. Either left at 0 is off.
+ */
+struct SamplePolicy
+{
+    std::chrono::nanoseconds threshold{ 0 };
+    u32 one_in = 0;
+};
+
+
+/**
+ * @brief what a sampled query was and where its time went. Stage stamps are the
+ *  task's own, steady clock nanoseconds and 0 where not stamped.
+ */
+struct QuerySample
+{
+    int client_id = 0;
+    std::string cypher;         // as run, cut at SAMPLE_TEXT_MAX
+    u32 param_count = 0;        // parameters it was run with
+    u32 request_bytes = 0;      // RUN and PULL as encoded, parameters and all
+    u64 records = 0;
+    u64 record_bytes = 0;
+    s64 t_first = -1;           // ms, as the server's summaries had it; -1 if not
+    s64 t_last = -1;
+    bool slow = false;          // over the threshold, alas one in n
+    s64 at[QUERY_STAGE_COUNT]{};
+
+
+    /**
+     * @brief submit to final SUCCESS in nanoseconds
+     */
+    s64 Latency_Ns() const
+    {
+        return at[u8(QueryStage::Final_Success)] - at[u8(QueryStage::Submit)];
+    } // end Latency_Ns
+
+
+    /**
+     * @brief time from the stage stamped before s to s, as StageLatencies has it;
+     *  0 if s wasn't stamped
+     */
+    s64 Stage_Ns(const QueryStage s) const
+    {
+        if (s == QueryStage::Submit || !at[u8(s)]) return 0;
+        for (int i = int(s) - 1; i >= 0; i--)
+            if (at[i] && at[i] <= at[u8(s)]) return at[u8(s)] - at[i];
+        return 0;
+    } // end Stage_Ns
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief a connection's slow query sampler. The submitting thread notes each
+ *  query's text in a slot of its own before queueing it, the decoding thread
+ *  decides at final SUCCESS whether to keep it and pushes the sample into a
+ *  bounded single producer, single consumer ring the application takes them
+ *  from; a full ring drops the sample and counts it. Off (the default) it
+ *  costs a query two relaxed loads; the slots and ring are made the first
+ *  time it's turned on and kept from then on.
+ */
+class QuerySampler
+{
+public:
+
+    QuerySampler() = default;
+    ~QuerySampler();
+    QuerySampler(const QuerySampler&) = delete;
+    QuerySampler& operator=(const QuerySampler&) = delete;
+
+    void Set_Policy(const SamplePolicy& policy);
+    SamplePolicy Policy() const;
+    size_t Take(std::vector<QuerySample>& out, const size_t max = SAMPLE_RING_SIZE);
+    u64 Sampled() const;
+    u64 Dropped() const;
+
+    u32 Note(const char* cypher, const size_t len, const u32 params, const size_t in_flight);
+    void Note_Bytes(const u32 slot, const size_t bytes);
+    void Note_First(const u32 slot, const s64 t_first);
+    void Offer(const u32 slot, const int client_id, const BoltResult& result, const StageStamps& stamps);
+
+
+    /**
+     * @brief true if any queries are being sampled
+     */
+    inline bool Enabled() const
+    {
+        return threshold_ns.load(std::memory_order_relaxed) || one_in.load(std::memory_order_relaxed);
+    } // end Enabled
+
+private:
+
+    struct Slot
+    {
+        std::string text;               // written before the task is queued
+        u32 params = 0;
+        std::atomic<u32> bytes{ 0 };    // after, once encoded; hence atomic
+        s64 t_first = -1;               // by the decoding thread
+    };
+
+    struct State
+    {
+        std::unique_ptr<Slot[]> slots{ new Slot[SAMPLE_SLOTS] };
+        LockFreeQueue<QuerySample, SAMPLE_RING_SIZE> ring;
+    };
+
+    std::atomic<State*> state{ nullptr };   // made once, on first turning it on
+    std::atomic<s64> threshold_ns{ 0 };
+    std::atomic<u32> one_in{ 0 };
+
+    u64 next_slot = 0;          // submitting thread
+    u32 since_picked = 0;       // decoding thread; queries since the last one in n
+    MetricCounter sampled;      // decoding thread
+    MetricCounter dropped;
+};
@@ -0,0 +1,126 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "neoerr.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief which way captured bytes went
+ */
+enum class WireDir : u8
+{
+    In,         // received into read_buf
+    Out,        // flushed out of write_buf
+};
+
+
+/**
+ * @brief starts a capture file; the frames follow it to the end of the file
+ */
+struct CaptureHeader
+{
+    char magic[8];          // CAPTURE_MAGIC
+    s64 start_ns;           // steady clock when the capture began
+};
+
+
+/**
+ * @brief precedes every run of bytes captured; as many as a send or a recv
+ *  moved at once
+ */
+struct CaptureFrame
+{
+    s64 ns;                 // since start_ns
+    u32 len;                // bytes following
+    WireDir dir;
+    u8 reserved[3];
+};
+
+
+constexpr static char CAPTURE_MAGIC[8] = { 'L', 'B', 'W', 'I', 'R', 'E', '0', '1' };
+constexpr static size_t CAPTURE_BUFFER = 1 << 20;      // stdio buffer per capture file
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief appends the bytes a connection moves to a file, each run of them with
+ *  its time and direction, for replaying offline. Closed it costs Append() one
+ *  relaxed load; open, the sending and receiving threads take turns on a lock
+ *  to write through a large stdio buffer, so captures are for reproducing a
+ *  workload rather than left on.
+ */
+class WireCapture
+{
+public:
+
+    WireCapture() = default;
+    ~WireCapture();
+
+    LBStatus Open(const std::string& path);
+    void Close();
+    bool Is_Open() const;
+    u64 Bytes() const;
+
+
+    /**
+     * @brief appends len bytes from data going dir; from the sending or the
+     *  receiving thread
+     */
+    inline void Append(const WireDir dir, const u8* data, const size_t len)
+    {
+        if (!on.load(std::memory_order_relaxed) || !len) return;
+        Write_Frame(dir, data, len);
+    } // end Append
+
+private:
+
+    std::atomic<bool> on{ false };
+    mutable std::mutex lock;    // over file, start_ns and bytes
+    FILE* file = nullptr;
+    s64 start_ns = 0;
+    u64 bytes = 0;              // written to file, headers and all
+
+    void Write_Frame(const WireDir dir, const u8* data, const size_t len);
+};
+
+
+/**
+ * @brief reads a capture back, frame by frame
+ */
+class CaptureReader
+{
+public:
+
+    CaptureReader() = default;
+    ~CaptureReader();
+
+    LBStatus Open(const std::string& path);
+    bool Next(CaptureFrame& frame, std::vector<u8>& data);
+    void Rewind();
+
+private:
+
+    FILE* file = nullptr;
+};
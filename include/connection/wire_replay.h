@@ -0,0 +1,77 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <deque>
+#include "connection/neoconnection.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief what a replay went through and how long it took
+ */
+struct ReplayStats
+{
+    u64 frames_in = 0;          // recvs captured
+    u64 frames_out = 0;         // and sends
+    u64 bytes_in = 0;
+    u64 bytes_out = 0;
+    u64 requests = 0;           // messages sent that get a response of their own
+    u64 results = 0;            // results taken, failures included
+    u64 records = 0;            // records decoded out of them
+    u64 failures = 0;
+    u64 unmatched = 0;          // bytes received that no request was left to answer
+    s64 captured_ns = 0;        // the last frame's time; how long the capture ran
+    s64 replay_ns = 0;          // how long replaying it took
+    LatencyHistogram frame_decode;  // decoding each recv's bytes and taking its results
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief feeds a capture back through a connection with no server; the bytes
+ *  it received go through Can_Decode()/Decode_One() as they came, and every
+ *  result is taken and its records decoded, at full speed. The requests sent
+ *  are parsed to queue the tasks their responses are decoded against. Anything
+ *  the connection sends of its own accord while decoding, i.e. a RESET after
+ *  an IGNORED, goes to a socket pair and is matched off against the capture.
+ */
+class WireReplay
+{
+public:
+
+    WireReplay();
+    ~WireReplay();
+
+    LBStatus Run(CaptureReader& reader, ReplayStats& stats);
+
+private:
+
+    NeoConnection connection;
+    int peer_fd = -1;               // the other end of the connection's socket pair
+    std::vector<u8> sent;           // captured sends not yet a whole message
+    std::vector<u8> self_sent;      // and the connection's own
+    std::deque<u8> self_tags;       // tags of the messages the connection sent itself
+
+    void Queue_Requests(const u8* data, const size_t len, ReplayStats& stats);
+    void Collect_Self_Sent();
+    LBStatus Decode();
+    void Take_Results(ReplayStats& stats);
+};
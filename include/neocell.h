@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 10th of December 2025, Wednesday
- * @date updated 27th of Feburary 2026, Friday
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -12,6 +12,7 @@
  //          INCLUDES
  //===============================================================================|
 #include "connection/neoconnection.h"
+#include "neoexecutor.h"
 
 
 
@@ -19,6 +20,9 @@
 //===============================================================================|
 //          ENUM & TYPES
 //===============================================================================|
+constexpr static auto STOP_DRAIN = std::chrono::seconds(5);   // Stop() waits this long on in flight tasks
+
+
 /**
  * @brief command types and their corresponding parameters understood by the cell.
  *  The structure is meant to capture the layout of different API's offered by
@@ -34,13 +38,97 @@ struct CellCommand
     BoltValue Routes;       // list of routes for route
     BoltValue param = BoltValue::Make_Map();   // params for run, begin, commit and rollback
     BoltValue extra = BoltValue::Make_Map();   // params for run
-    std::function<void(BoltResult&)> cb;       // callback for async
+    ResultCallback cb;                         // callback for async
+    BoltVisitor* visitor = nullptr;            // streamed records go here for run
 
     // constructors
     CellCommand() = default;
     CellCommand(CellCmdType tp) : type(tp) {}
 };
 
+
+/**
+ * @brief a snapshot of what cells went through, one or merged over all of a
+ *  driver's; see NeoDriver::Metrics(). Counters are totals since the cell was
+ *  made but for the high-water marks, which are the deepest any one queue got.
+ */
+struct NeoMetrics
+{
+    u64 cells = 0;
+    u64 queries = 0;            // RUNs queued
+    u64 failures = 0;           // FAILURE responses
+    u64 retries = 0;            // reconnects and resends tried
+    u64 bytes_in = 0;
+    u64 bytes_out = 0;
+    u64 buffer_grows = 0;       // read and write buffers
+    u64 buffer_shrinks = 0;
+    u64 buffer_compactions = 0;
+    u64 buffer_bytes_moved = 0; // copied growing, shrinking and compacting
+    u64 recv_pauses = 0;        // recv stopped on a full read buffer
+    u64 samples = 0;            // queries sampled; see NeoDriver::Set_Sampler()
+    u64 samples_dropped = 0;    // and dropped on a full ring
+    u64 tasks_high = 0;         // pipelined tasks awaiting responses
+    u64 results_high = 0;       // results awaiting Fetch()
+    u64 requests_high = 0;      // requests kept for retry
+    u64 buffer_high = 0;        // the most storage any one buffer held
+
+    LatencyHistogram latency;   // submit to final SUCCESS
+    StageLatencies stages;      // and per stage
+    StageHistogram callback_wait;   // final SUCCESS to the callback starting
+    StageHistogram callback_run;    // the callback itself
+
+
+    /**
+     * @brief adds another snapshot to this one
+     */
+    void Merge(const NeoMetrics& other)
+    {
+        cells += other.cells;
+        queries += other.queries;
+        failures += other.failures;
+        retries += other.retries;
+        bytes_in += other.bytes_in;
+        bytes_out += other.bytes_out;
+        buffer_grows += other.buffer_grows;
+        buffer_shrinks += other.buffer_shrinks;
+        buffer_compactions += other.buffer_compactions;
+        buffer_bytes_moved += other.buffer_bytes_moved;
+        recv_pauses += other.recv_pauses;
+        samples += other.samples;
+        samples_dropped += other.samples_dropped;
+        tasks_high = std::max(tasks_high, other.tasks_high);
+        results_high = std::max(results_high, other.results_high);
+        requests_high = std::max(requests_high, other.requests_high);
+        buffer_high = std::max(buffer_high, other.buffer_high);
+        latency.Merge(other.latency);
+        stages.Merge(other.stages);
+        callback_wait.Merge(other.callback_wait);
+        callback_run.Merge(other.callback_run);
+    } // end Merge
+};
+
+
+
+/**
+ * @brief how a cell stands right now; read off it as it runs, for exporters
+ */
+struct CellGauges
+{
+    int client_id = 0;
+    bool connected = false;
+    bool recv_paused = false;       // recv stopped on a full read buffer
+    size_t read_capacity = 0;       // read buffer storage, 0 while parked
+    size_t read_bytes = 0;          // received and not yet consumed
+    size_t write_capacity = 0;      // likewise
+    size_t read_high = 0;           // the most storage each buffer ever held
+    size_t write_high = 0;
+    size_t tasks = 0;               // pipelined, awaiting responses
+    size_t results = 0;             // awaiting Fetch()
+    size_t requests = 0;            // kept for retry
+    size_t queue_capacity = 0;      // what each of those queues holds at most
+};
+
+
 // forwards
 class NeoDriver;
 
@@ -50,21 +138,37 @@ class NeoDriver;
 class NeoCell
 {
 	friend class NeoDriver;
+    friend class DecodeWorkers;
     friend LBStatus LB_Handle_Status(LBStatus, NeoCell*);
 
 public:
 
-    NeoCell(int epfd_, const std::string& urls, BoltValue* pauth, BoltValue* pextras);
+    NeoCell(int epfd_, const std::string& urls, BoltValue* pauth, BoltValue* pextras,
+        BufferSlab* pslab = nullptr);
     ~NeoCell();
 
     LBStatus Start_Session(const int id = 1);
-    LBStatus Run_Async(std::function<void(BoltResult&)> cb,
+    LBStatus Run_Async(ResultCallback cb,
         const char* query,
         BoltValue&& param = BoltValue::Make_Map(), 
         BoltValue&& extra = BoltValue::Make_Map());
     LBStatus Run(const char* query, BoltValue&& param = BoltValue::Make_Map(),
         BoltValue&& extra = BoltValue::Make_Map());
-    LBStatus Fetch(BoltResult& result);
+    LBStatus Run_Streamed(BoltVisitor* visitor, ResultCallback cb,
+        const char* query,
+        BoltValue&& param = BoltValue::Make_Map(),
+        BoltValue&& extra = BoltValue::Make_Map());
+    LBStatus Run_Batched(ResultCallback cb, const char* query, const int n,
+        BoltValue&& param = BoltValue::Make_Map(),
+        BoltValue&& extra = BoltValue::Make_Map());
+    LBStatus Pull_Next(const int n);
+    LBStatus Discard_Rest();
+    template<Bolt_Param_Type... Ps>
+    LBStatus Run_Typed(ResultCallback cb, const char* query, const Ps&... params);
+    LBStatus Fetch(BoltResult& result,
+        const CompletionSignal::duration timeout = CompletionSignal::FOREVER);
+    LBStatus Fetch_Many(std::span<BoltResult> out,
+        const CompletionSignal::duration timeout = CompletionSignal::FOREVER);
 
     int Get_Socket() const;
     int Get_Retry_Count() const;
@@ -72,6 +176,12 @@ public:
     int Get_ClientID() const;
 
     u64 Percentile(double p) const;
+    double Percentile_Us(double p) const;
+    LatencyHistogram Latencies() const;
+    StageLatencies Stage_Latencies();
+    NeoMetrics Metrics();
+    CellGauges Gauges();
+    void Collect_Metrics(NeoMetrics& into);
     u64 Wall_Latency() const;
 
     bool Can_Retry();
@@ -82,6 +192,10 @@ public:
     void Clear_Histo();
     void Set_Max_Retry_Count(const int n);
     void Reset_Retry();
+    LBStatus Set_Capture(const std::string& path);
+    u64 Capture_Bytes() const;
+    void Set_Sampler(const SamplePolicy& policy);
+    size_t Take_Samples(std::vector<QuerySample>& out);
 
 private:
 
@@ -89,9 +203,13 @@ private:
     int max_retries;        // the maximum number of retries allowed; default to 5
     int leftover_bytes;     // leftover bytes from previous decode
     int epfd;               // epoll descriptor
+    int decode_worker = -1; // the decode worker this cell is pinned to, -1 for none
 
 	std::atomic<int> last_rc;   // store's the last return value which maybe an error
     std::string err_desc;       // a string version of last error occured either from neo4j or internal
+    std::atomic<bool> read_posted{ false }; // readable and waiting on its decode worker
+    std::atomic<bool> fetched{ false };     // results went to Fetch() since the read buffer last parked
+    MetricCounter retries;                  // every Can_Retry(), from whichever thread handles errors
 
     NeoConnection connection;               // a connection instance; either standalone or routed
     LockFreeQueue<CellCommand> requests;    // queue of requests, allows for retry.
@@ -99,10 +217,51 @@ private:
 
 	void Consume_Read_Buffer(const size_t bytes);
 	void Reset_Read_Buffer();
+    bool Park_Idle_Buffers(const bool release);
+    void Set_Executor(CompletionExecutor* pexec);
     u8* Get_Read_Buffer_Read_Ptr();
 
     LBStatus Handshake(const int id);
     LBStatus Poll_Read();
+    LBStatus Read_Responses();
     LBStatus Execute_Command(CellCommand& cmd);
 	LBStatus Decode_Response(u8* ptr, const size_t bytes);
-};
\ No newline at end of file
+};
+
+
+
+//===============================================================================|
+//          TEMPLATES
+//===============================================================================|
+/**
+ * @brief runs a query with parameters made via P(), i.e.
+ *
+ *      pcell->Run_Typed(nullptr, "MATCH (n {id: $id}) RETURN n", P("id", 42));
+ *
+ *  The parameters are packed straight into the write buffer instead of going
+ *  through BoltValue maps. Results are fetched or delivered to cb as with
+ *  Run_Async(); the request is recorded without its parameters.
+ *
+ * @param cb optional completion callback
+ * @param query the cypher query
+ * @param params the query parameters
+ *
+ * @return LB_OK on success, alas LB_FAIL.
+ */
+template<Bolt_Param_Type... Ps>
+LBStatus NeoCell::Run_Typed(ResultCallback cb, const char* query, const Ps&... params)
+{
+	const bool kept = !cb;	// for Fetch(); a callback query is never taken off
+	LBStatus rc = connection.Run_Typed(query, -1, std::move(cb), params...);
+	if (!LB_OK(rc))
+	{
+		LB_Handle_Status(rc, this);		// recovers the cell; the query is still lost
+		return rc;
+	} // end if not sent
+	if (!kept) return rc;
+
+	CellCommand cmd(CellCmdType::Run);
+	cmd.cypher = query;
+	requests.Enqueue(std::move(cmd));	// keeps Fetch() in step with the tasks
+	return rc;
+} // end Run_Typed
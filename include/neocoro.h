@@ -0,0 +1,295 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <coroutine>
+#include <exception>
+#include "neocell.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief a detached coroutine; starts running right away and cleans up after
+ *  itself once done, i.e.
+ *
+ *      NeoTask Lookup(NeoDriver& driver, std::atomic<int>& done)
+ *      {
+ *          BoltResult res = co_await driver.Run("MATCH (n) RETURN n LIMIT 1");
+ *          ...
+ *          done.fetch_add(1);
+ *      }
+ *
+ *  Nothing is returned to the caller, so let it know when done by other means.
+ *  An exception escaping the coroutine terminates.
+ */
+struct NeoTask
+{
+    struct promise_type
+    {
+        NeoTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief co_await on a query; sends it once the coroutine suspends and resumes it
+ *  with the result when complete. The completion callback captures nothing but
+ *  the awaiter, which lives in the coroutine frame, so no allocation is made
+ *  per query.
+ *
+ *  The coroutine is resumed from the callback; i.e. on the thread the driver's
+ *  executor runs callbacks on (see NeoDriver::Set_Executor()), or handed to a
+ *  submit function given through On(). Resumed inline, the result views the
+ *  connection's receive buffer, so be done with it before waiting on anything
+ *  else; resumed off the decoding thread it holds its own copy.
+ *
+ *  Launch is a callable taking the ResultCallback and sending the query with it;
+ *  made by NeoDriver::Run().
+ */
+template<typename Launch>
+class QueryAwaiter
+{
+public:
+
+    explicit QueryAwaiter(Launch&& l) : launch(std::move(l)) {}
+    QueryAwaiter(QueryAwaiter&&) = default;
+    QueryAwaiter(const QueryAwaiter&) = delete;
+
+
+    /**
+     * @brief resumes the awaiting coroutine via post rather than on the thread
+     *  running the callback; i.e. an event loop's post(). post must outlive the
+     *  query.
+     */
+    QueryAwaiter On(const SubmitFn& post) &&
+    {
+        resume_on = &post;
+        return std::move(*this);
+    } // end On
+
+
+    bool await_ready() const noexcept { return false; }
+
+
+    /**
+     * @brief sends the query; the coroutine may be resumed (on another thread)
+     *  before this returns, so nothing here is touched once it's sent.
+     *
+     * @return false to carry on right away when the query couldn't be sent
+     */
+    bool await_suspend(std::coroutine_handle<> h)
+    {
+        waiter = h;
+        LBStatus rc = launch([this](BoltResult& r) { Done(r); });
+        if (LB_OK(rc)) return true;
+
+        result.error = true;    // never sent; no records, no summary
+        result.done = true;
+        return false;
+    } // end await_suspend
+
+
+    /**
+     * @brief the result; error is set if the query failed or couldn't be sent
+     */
+    BoltResult await_resume() noexcept { return std::move(result); }
+
+private:
+
+    Launch launch;                      // sends the query along with a callback
+    BoltResult result;                  // moved in by the callback
+    std::coroutine_handle<> waiter;     // the coroutine suspended on it
+    const SubmitFn* resume_on = nullptr;
+
+
+    /**
+     * @brief the completion callback; takes the result and resumes the waiter
+     */
+    void Done(BoltResult& r)
+    {
+        result = std::move(r);
+        if (resume_on)
+            (*resume_on)([h = waiter]() { h.resume(); });
+        else
+            waiter.resume();
+    } // end Done
+};
+
+
+
+/**
+ * @brief an async generator over the batches of a query run with PULL n on one
+ *  cell, i.e.
+ *
+ *      ResultStream stream(pcell, "MATCH (n) RETURN n", 1000);
+ *      while (co_await stream.Next())
+ *          for (auto r : stream.Batch()) ...
+ *
+ *  The next PULL is only sent when Next() is awaited again, so the server never
+ *  runs more than a batch ahead of the coroutine; a batch is valid until then.
+ *  Next() comes back true for every batch, the last included (has_more cleared,
+ *  the summary decoded, or error set), and false after. A stream left before its
+ *  end must be Cancel()ed, which drops the rest server side.
+ *
+ *  The cell refuses other queries while a stream is open on it (see
+ *  NeoCell::Run_Batched()). Batches, the last included, are resumed into where
+ *  the cell runs its callbacks, or handed to a submit function given to On().
+ */
+class ResultStream
+{
+public:
+
+    ResultStream(NeoCell* pcell_, const char* query_, const int batch_size_,
+        BoltValue&& params_ = BoltValue::Make_Map(),
+        BoltValue&& extra_ = BoltValue::Make_Map())
+        : pcell(pcell_), query(query_), batch_size(batch_size_ > 0 ? batch_size_ : 1),
+        params(std::move(params_)), extra(std::move(extra_)) {}
+    ResultStream(const ResultStream&) = delete;
+    ResultStream& operator=(const ResultStream&) = delete;
+
+
+    /**
+     * @brief resumes on post rather than where callbacks run; post must
+     *  outlive the stream
+     */
+    ResultStream& On(const SubmitFn& post)
+    {
+        resume_on = &post;
+        return *this;
+    } // end On
+
+
+    /**
+     * @brief the batch handed over by the last Next()
+     */
+    BoltResult& Batch() { return current; }
+
+
+    /**
+     * @brief awaits the next batch; runs the query on first use, pulls the next
+     *  batch after
+     *
+     * @return an awaitable resuming with true for a batch, false once past the last
+     */
+    auto Next()
+    {
+        struct Awaiter
+        {
+            ResultStream* ps;
+            bool past;      // the last batch was handed over already
+
+            bool await_ready() const noexcept { return past; }
+            bool await_suspend(std::coroutine_handle<> h)
+            {
+                ps->waiter = h;
+                return ps->Request(false);
+            } // end await_suspend
+            bool await_resume() const noexcept { return !past; }
+        };
+
+        return Awaiter{ this, last };
+    } // end Next
+
+
+    /**
+     * @brief awaits the rest being dropped; the stream is at its end after. A
+     *  no-op past the last batch.
+     */
+    auto Cancel()
+    {
+        struct Awaiter
+        {
+            ResultStream* ps;
+
+            bool await_ready() const noexcept { return ps->last; }
+            bool await_suspend(std::coroutine_handle<> h)
+            {
+                ps->waiter = h;
+                return ps->Request(true);
+            } // end await_suspend
+            void await_resume() const noexcept {}
+        };
+
+        if (!started) last = true;  // nothing sent, nothing to drop
+        return Awaiter{ this };
+    } // end Cancel
+
+private:
+
+    NeoCell* pcell;                     // the cell the query runs on, exclusively
+    const char* query;
+    int batch_size;                     // records per PULL
+    BoltValue params;                   // for the RUN; sent on the first Next()
+    BoltValue extra;
+
+    BoltResult current;                 // the batch handed over last
+    std::coroutine_handle<> waiter;     // the coroutine waiting on a batch
+    const SubmitFn* resume_on = nullptr;
+
+    bool started = false;   // RUN sent
+    bool last = false;      // last batch handed over
+
+
+    /**
+     * @brief sends the RUN, the next PULL or a DISCARD
+     *
+     * @return true if the coroutine waits on a batch, false when sending failed
+     *  and it carries on with an error batch
+     */
+    bool Request(const bool discard)
+    {
+        LBStatus rc;
+        if (!started)
+        {
+            started = true;
+            rc = pcell->Run_Batched([this](BoltResult& r) { Deliver(r); },
+                query, batch_size, std::move(params), std::move(extra));
+        } // end if first
+        else rc = discard ? pcell->Discard_Rest() : pcell->Pull_Next(batch_size);
+
+        if (LB_OK(rc)) return true;
+
+        current = BoltResult();
+        current.error = true;
+        current.done = true;
+        last = true;
+        return false;
+    } // end Request
+
+
+    /**
+     * @brief the batch callback; keeps the batch and resumes the waiter
+     */
+    void Deliver(BoltResult& r)
+    {
+        current = std::move(r);
+        last = current.error || !current.meta.has_more;
+
+        if (resume_on)
+            (*resume_on)([h = waiter]() { h.resume(); });
+        else
+            waiter.resume();
+    } // end Deliver
+};
@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 17th of January 2026, Saturday.
- * @date updated 4th of March 2026, Wednesday.
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -12,6 +12,9 @@
  //          INCLUDES
  //===============================================================================|
 #include "neopool.h"
+#include "neoworkers.h"
+#include "neocoro.h"
+#include "neoexporter.h"
 
 
 
@@ -20,6 +23,7 @@
 //===============================================================================|
 constexpr static int MAX_EVENTS = 1024;
 constexpr static int POOL_SIZE = 1;
+constexpr static s64 TRIM_INTERVAL_NS = 100'000'000;  // parking idle buffers over the limit at most this often
 
 
 enum class DbMode
@@ -45,23 +49,51 @@ public:
 
     NeoDriver(const std::string& urls, BoltValue auth,
         BoltValue extra = BoltValue::Make_Map(),
-        const int pool_size_ = POOL_SIZE);
+        const int pool_size_ = POOL_SIZE,
+        const int decode_workers_ = 0);
     ~NeoDriver();
 
-    LBStatus Execute_Async(std::function<void(BoltResult&)> cb, const char* query,
+    LBStatus Execute_Async(ResultCallback cb, const char* query,
         BoltValue&& params = BoltValue::Make_Map(), BoltValue&& extra = BoltValue::Make_Map());
     LBStatus Execute(const char* query, BoltValue&& params = BoltValue::Make_Map(),
         BoltValue&& extra = BoltValue::Make_Map());
+    template<Bolt_Param_Type P1, Bolt_Param_Type... Ps>
+    LBStatus Execute_Async(ResultCallback cb, const char* query, const P1& p1, const Ps&... params);
+    template<Bolt_Param_Type P1, Bolt_Param_Type... Ps>
+    LBStatus Execute(const char* query, const P1& p1, const Ps&... params);
+    LBStatus Execute_Streamed(BoltVisitor* visitor, ResultCallback cb, const char* query,
+        BoltValue&& params = BoltValue::Make_Map(), BoltValue&& extra = BoltValue::Make_Map());
     int Fetch(BoltResult& result);
+    auto Run(const char* query, BoltValue&& params = BoltValue::Make_Map(),
+        BoltValue&& extra = BoltValue::Make_Map());
+    template<Bolt_Param_Type P1, Bolt_Param_Type... Ps>
+    auto Run(const char* query, const P1& p1, const Ps&... params);
 
     void Close();
     void Set_Pool_Size(const int nsize);
     int Get_Pool_Size() const;
+    int Get_Decode_Workers() const;
 
     std::string Get_Last_Error() const;
     NeoCell* Get_Session();
     NeoCellPool* Get_Pool();
 
+    SlabStats Buffer_Stats() const;
+    void Set_Buffer_Cap(const size_t bytes);
+    void Set_Memory_Limit(const size_t buffer_bytes, const size_t pool_bytes = 0);
+    void Set_Memory_Policy(MemPolicy policy);
+    void Release_Idle_Buffers();
+
+    void Set_Executor(ExecPolicy policy);
+    LatencyHistogram Callback_Delay() const;
+    NeoMetrics Metrics();
+    std::string OpenMetrics();
+    LBStatus Set_Exporter(ExportPolicy policy);
+    u16 Exporter_Port() const;
+    LBStatus Set_Capture(const std::string& prefix);
+    void Set_Sampler(SamplePolicy policy);
+    size_t Take_Samples(std::vector<QuerySample>& out);
+
 private:
 
     std::string _urls;       // raw unfiltered url string for database connection
@@ -78,10 +110,19 @@ private:
     std::string last_err;       // last error string 
     std::thread poll_thread;    // polls ready connections
     std::atomic<bool> looping;
+    std::atomic<bool> park_idle{ false };   // asks the poll thread to park idle buffers
+    std::atomic<int> reactor_node{ -1 };    // NUMA node the poll thread started on
+    std::mutex sample_lock;     // one reader of the cells' sample rings at a time
+
+    BufferSlab slab;            // storage shared by all connection buffers
+    DecodeWorkers decoders;     // optional threads receiving/decoding off the poll thread
+    CompletionExecutor completions; // where async callbacks run; inline by default
+    MetricsExporter exporter;   // serves OpenMetrics() when asked to
 
     NeoCellPool* pool;          // pointer to an instance of pool
 
     void Poll_Read();
+    void Park_Idle(const bool release);
 
     struct RouteTable
     {
@@ -93,4 +134,97 @@ private:
     };
 
     RouteTable route_table;     // instance
-};
\ No newline at end of file
+};
+
+
+//===============================================================================|
+//          TEMPLATES
+//===============================================================================|
+/**
+ * @brief typed parameter overload of Execute_Async; parameters are made via P()
+ *	and packed straight into the connection's write buffer, i.e.
+ *
+ *		driver.Execute_Async(cb, "MATCH (n) WHERE n.id = $id RETURN n", P("id", 42));
+ *
+ * @param cb the callback invoked once the result is complete
+ * @param query the query to execute.
+ * @param p1, params the query parameters
+ *
+ * @return LB_OK on success, alas LB_FAIL.
+ */
+template<Bolt_Param_Type P1, Bolt_Param_Type... Ps>
+LBStatus NeoDriver::Execute_Async(ResultCallback cb, const char* query, const P1& p1,
+	const Ps&... params)
+{
+	NeoCell* pcell = pool->Acquire();
+	if (!pcell) return LB_Make(
+		LBAction::LB_FAIL,
+		LBDomain::LB_DOM_STATE,
+		LBStage::LB_STAGE_QUERY
+	);
+
+	if (!pcell->Is_Connected())
+	{
+		LBStatus rc = pcell->Start_Session(++next_client_id);
+		if (!LB_OK(rc)) return rc;
+	} // end if not connected
+
+	return pcell->Run_Typed(std::move(cb), query, p1, params...);
+} // end Execute_Async
+
+
+/**
+ * @brief typed parameter overload of Execute; results are fetched later on
+ *
+ * @param query the query to execute.
+ * @param p1, params the query parameters
+ *
+ * @return LB_OK on success, alas LB_FAIL.
+ */
+template<Bolt_Param_Type P1, Bolt_Param_Type... Ps>
+LBStatus NeoDriver::Execute(const char* query, const P1& p1, const Ps&... params)
+{
+	return Execute_Async(nullptr, query, p1, params...);
+} // end Execute
+
+
+/**
+ * @brief the awaitable sibling of Execute_Async(), i.e.
+ *
+ *		BoltResult res = co_await driver.Run("MATCH (n) RETURN n LIMIT 25");
+ *
+ *	The query is sent once the coroutine suspends on it, and the coroutine resumed
+ *	with the result where the driver's executor runs callbacks, or on a submit
+ *	function via .On(post). No thread is blocked and nothing allocated per query.
+ *
+ * @param query the query to execute.
+ * @param params parameters for cypher query above
+ * @param extra info for cypher like r/w, db name, bookmarks etc.
+ *
+ * @return a QueryAwaiter resuming with the BoltResult; error set on failure.
+ */
+inline auto NeoDriver::Run(const char* query, BoltValue&& params, BoltValue&& extra)
+{
+	return QueryAwaiter([this, query, p = std::move(params), e = std::move(extra)]
+		(ResultCallback&& cb) mutable {
+			return Execute_Async(std::move(cb), query, std::move(p), std::move(e));
+		});
+} // end Run
+
+
+/**
+ * @brief typed parameter overload of Run(); parameters made via P() are viewed
+ *	until the coroutine suspends, so use them inline in the co_await.
+ *
+ * @param query the query to execute.
+ * @param p1, params the query parameters
+ *
+ * @return a QueryAwaiter resuming with the BoltResult; error set on failure.
+ */
+template<Bolt_Param_Type P1, Bolt_Param_Type... Ps>
+auto NeoDriver::Run(const char* query, const P1& p1, const Ps&... params)
+{
+	return QueryAwaiter([this, query, &p1, &params...](ResultCallback&& cb) {
+			return Execute_Async(std::move(cb), query, p1, params...);
+		});
+} // end Run
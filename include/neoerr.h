@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 13th of April 2025, Sunday.
- * @date updated 27th of Feburary 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
  */
 #ifndef __NEO_ERROR_H
 #define __NEO_ERROR_H
@@ -84,6 +84,8 @@ enum class LBCode : u8
 	LB_CODE_STATE_QUEUE_MEM,	// out of queue memory
 	LB_CODE_STATE_QUEUE_SIZE,	// invalid queue size 
 	LB_CODE_STATE_MEM,			// memory growth issue or compact
+
+	LB_CODE_TYPE,		// value doesn't fit the requested C++ type
 };
 
 
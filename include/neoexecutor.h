@@ -0,0 +1,103 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include "connection/neoconnection.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief where async completion callbacks run
+ */
+enum class ExecMode : u8
+{
+    Inline,         // on the thread decoding the connection, as soon as done (default)
+    Pool,           // on the executor's own threads
+    Submit,         // on whatever the user's submit function hands them to
+};
+
+
+/**
+ * @brief a user supplied submit; gets a job running a batch of callbacks and
+ *  must run it exactly once, on any thread (i.e. an event loop's post()).
+ */
+using SubmitFn = std::function<void(SmallFn<void()>&&)>;
+
+
+/**
+ * @brief how the driver runs async completion callbacks
+ */
+struct ExecPolicy
+{
+    ExecMode mode = ExecMode::Inline;
+    int threads = 1;            // for ExecMode::Pool
+    SubmitFn submit = nullptr;  // for ExecMode::Submit
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief runs async completion callbacks off the thread decoding responses, so a
+ *  slow callback doesn't hold up I/O for every connection. Connections gather
+ *  the callbacks that complete during one read into a batch and hand the whole
+ *  batch over at once (or every COMPLETION_BATCH); one lock and one wake per
+ *  batch rather than per callback.
+ *
+ *  The time from a result being complete to its callback starting is recorded
+ *  as the queueing delay. Results are copied out of the connection's receive
+ *  buffer before they're handed over, into slab storage they own and take along
+ *  wherever they're moved; the connection carries on receiving meanwhile.
+ */
+class CompletionExecutor
+{
+public:
+
+    CompletionExecutor() = default;
+    ~CompletionExecutor();
+
+    void Set_Policy(ExecPolicy policy);
+    ExecMode Mode() const;
+    void Submit(CompletionBatch&& batch);
+    void Stop();
+
+    LatencyHistogram Delay() const;
+    void Clear_Delay();
+
+private:
+
+    std::atomic<ExecMode> mode{ ExecMode::Inline };
+    SubmitFn submit;                    // user's submit for ExecMode::Submit
+
+    std::mutex lock;                    // guards batches
+    std::condition_variable ready;      // signaled on every batch queued
+    std::deque<CompletionBatch> batches;    // waiting on a pool thread
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    mutable std::mutex stats_lock;      // guards delay
+    LatencyHistogram delay;             // queued to started, per callback
+
+    void Run(CompletionBatch& batch);
+    void Pool_Loop();
+};
@@ -0,0 +1,126 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <functional>
+#include <string>
+#include <thread>
+#include "neocell.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief where a MetricsExporter puts the driver's metrics
+ */
+enum class ExportMode : u8
+{
+    None,           // nowhere; the default
+    Unix_Socket,    // to whoever connects to a local socket at path, i.e. socat
+    Http,           // GET on 127.0.0.1:port, for scrapers
+    File,           // into path every period, replaced whole; i.e. a textfile collector
+};
+
+
+/**
+ * @brief how the driver exports its metrics
+ */
+struct ExportPolicy
+{
+    ExportMode mode = ExportMode::None;
+    std::string path;           // for ExportMode::Unix_Socket and File
+    u16 port = 9464;            // for ExportMode::Http; 0 for any free one
+    std::chrono::milliseconds period{ 10'000 };     // for ExportMode::File
+};
+
+
+/**
+ * @brief renders the text served; called on the exporter's thread
+ */
+using RenderFn = std::function<std::string()>;
+
+
+constexpr static const char* OPENMETRICS_TYPE =
+    "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief writes metric families in the OpenMetrics text format; counters get
+ *  their _total, histograms their cumulative buckets, _sum and _count in seconds.
+ *  Families are written whole, one after the other, and Finish() ends the text
+ *  with the # EOF it requires.
+ */
+class OpenMetricsWriter
+{
+public:
+
+    void Counter(const char* name, const char* help, const u64 value, const char* unit = nullptr);
+    void Gauge(const char* name, const char* help, const char* unit = nullptr);
+    void Sample(const char* name, const std::string& labels, const double value);
+    void Histogram(const char* name, const char* help);
+    void Buckets(const char* name, const std::string& labels, const LatencyHistogram& h);
+    void Buckets(const char* name, const std::string& labels, const StageHistogram& h);
+    std::string Finish();
+
+private:
+
+    std::string out;
+
+    void Family(const char* name, const char* type, const char* help, const char* unit);
+    void Buckets(const char* name, const std::string& labels, const u64* counts, const u64 samples,
+        const double sum);
+};
+
+
+/**
+ * @brief serves the driver's metrics off its own thread, so the I/O threads
+ *  never wait on a scraper; on a local Unix socket, a loopback HTTP endpoint or
+ *  dumped to a file every so often. What's served is rendered afresh for every
+ *  request or dump.
+ */
+class MetricsExporter
+{
+public:
+
+    MetricsExporter() = default;
+    ~MetricsExporter();
+
+    LBStatus Start(ExportPolicy policy, RenderFn render);
+    void Stop();
+    ExportMode Mode() const;
+    u16 Port() const;
+
+private:
+
+    ExportPolicy policy;
+    RenderFn render;
+    int listen_fd = -1;         // socket or HTTP listener
+    int wake_fd = -1;           // eventfd; Stop() wakes the thread through it
+    u16 bound_port = 0;         // the HTTP port listened on
+    std::thread thread;
+
+    LBStatus Listen_Unix();
+    LBStatus Listen_Http();
+    void Serve_Loop();
+    void File_Loop();
+    void Serve(const int fd);
+    bool Dump_File();
+    bool Write_All(const int fd, const std::string& data);
+};
@@ -0,0 +1,138 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <memory>
+#include <random>
+#include "neodriver.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief how queries are spaced at the target rate
+ */
+enum class Arrival : u8
+{
+    Uniform,        // evenly, 1/rate apart
+    Poisson,        // exponentially distributed gaps averaging 1/rate
+};
+
+
+/**
+ * @brief one query of a mix; picked weight out of the mix's total weight times
+ */
+struct LoadQuery
+{
+    std::string name;           // what it's reported as
+    std::string cypher;
+    u32 weight = 1;
+};
+
+
+/**
+ * @brief a load to run. Queries are scheduled open loop at rate per second over
+ *  warmup then measure; only those scheduled within measure are reported. A
+ *  query's latency runs from when it was scheduled to start, not from when it
+ *  was sent, so a sender held up, i.e. by max_inflight or a stalled server,
+ *  doesn't hide the wait of the queries behind it.
+ */
+struct LoadSpec
+{
+    double rate = 1'000;                        // queries per second intended
+    Arrival arrival = Arrival::Uniform;
+    std::chrono::nanoseconds warmup{ std::chrono::seconds(1) };
+    std::chrono::nanoseconds measure{ std::chrono::seconds(10) };
+    std::chrono::nanoseconds drain{ std::chrono::seconds(5) };   // waiting on the last ones
+    u32 max_inflight = 0;                       // queries sent and not done; 0 for no cap
+    u64 seed = 1;                               // for the mix and Poisson gaps
+    std::vector<LoadQuery> mix;
+};
+
+
+/**
+ * @brief what a load did; the histograms hold queries scheduled in measure
+ */
+struct LoadReport
+{
+    u64 scheduled = 0;          // queries scheduled in measure
+    u64 completed = 0;          // of them, done; failures included
+    u64 failed = 0;
+    u64 send_errors = 0;        // Execute_Async refused them
+    u64 timed_out = 0;          // still not done once drained
+    u64 records = 0;
+    s64 measure_ns = 0;         // measure as it ran, first scheduled to last done
+    LatencyHistogram latency;   // scheduled start to done; coordinated omission corrected
+    LatencyHistogram service;   // sent to done; what a closed loop would have seen
+    LatencyHistogram send_lag;  // scheduled start to sent; how far behind the sender fell
+    std::vector<LatencyHistogram> per_query;    // latency, by spec.mix index
+
+    double Achieved_Rate() const;
+};
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief drives a NeoDriver with an open loop load; queries start on a schedule
+ *  fixed by the target rate rather than when earlier ones finish, so a server
+ *  slowing down sees queries pile up as it would in production, and latency is
+ *  counted from the scheduled start. The calling thread does the scheduling;
+ *  completions land on whatever thread the driver runs callbacks on.
+ */
+class LoadGenerator
+{
+public:
+
+    explicit LoadGenerator(NeoDriver& driver);
+
+    LBStatus Run(const LoadSpec& spec, LoadReport& report);
+
+private:
+
+    /**
+     * @brief histograms completions are recorded into, spread so callbacks
+     *  on different connections rarely share one
+     */
+    struct Shard
+    {
+        std::mutex lock;
+        u64 completed = 0;
+        u64 failed = 0;
+        u64 records = 0;
+        s64 last_done = 0;
+        LatencyHistogram latency;
+        LatencyHistogram service;
+        std::vector<LatencyHistogram> per_query;
+    };
+
+    /**
+     * @brief outlives Run(), for callbacks of queries it gave up on
+     */
+    struct State
+    {
+        std::vector<LoadQuery> mix;
+        std::unique_ptr<Shard[]> shards;
+        size_t shard_count = 0;
+        std::atomic<u64> inflight{ 0 };
+    };
+
+    NeoDriver& driver;
+
+    static void Wait_Until(const s64 at);
+};
@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 24th of December 2025, Tuesday
- * @date updated 18th of January 2026, Sunday
+ * @date updated 16th of October 2026, Friday.
  */
 #pragma once
 
@@ -32,7 +32,8 @@ public:
 
 	NeoCellPool(int epfd, size_t nworkers, std::string& urls,
 		BoltValue* pauth, 
-		BoltValue* pextras = nullptr);
+		BoltValue* pextras = nullptr,
+		BufferSlab* pslab = nullptr);
 
 	LBStatus Start(const bool all_connections = false);
 	void Stop();
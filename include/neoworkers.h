@@ -0,0 +1,74 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neocell.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr static int DECODE_QUEUE_SIZE = 1024;     // readable cells a worker can have posted
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief decode workers that take receiving and decoding off the polling thread.
+ *  Every cell is pinned to one worker for life, so a connection's messages are
+ *  only ever decoded by one thread and in the order received; the polling thread
+ *  merely posts readable cells to their worker through a single producer, single
+ *  consumer queue and goes back to epoll_wait. A long streamed result then holds
+ *  up the other connections on its worker only, not every connection.
+ *
+ *  A cell is posted at most once until its worker gets to it; the worker reads
+ *  the socket dry (it's edge triggered) so a later readiness finds it posted
+ *  again or already drained.
+ */
+class DecodeWorkers
+{
+public:
+
+    DecodeWorkers() = default;
+    ~DecodeWorkers();
+
+    void Start(const int n, const std::vector<std::unique_ptr<NeoCell>>& cells,
+        BufferSlab* pslab = nullptr);
+    void Stop();
+    void Post(NeoCell* pcell);
+    void Park_Idle(const bool release);
+    int Size() const;
+
+private:
+
+    struct Worker
+    {
+        LockFreeQueue<NeoCell*, DECODE_QUEUE_SIZE> ready;   // cells posted readable
+        std::vector<NeoCell*> cells;        // cells pinned to this worker
+        std::atomic<u32> signal{ 0 };       // bumped on every post; waited on when idle
+        std::atomic<bool> park{ false };    // asks the worker to park its idle buffers
+        std::atomic<bool> release{ false }; // fetched from read buffers too; set before park
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<bool> running{ false };
+    BufferSlab* slab = nullptr;             // trimmed after parking
+
+    void Run(Worker* w);
+    void Wake(Worker* w);
+};
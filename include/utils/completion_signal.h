@@ -0,0 +1,136 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "basics.h"
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief counts completions posted by the thread decoding a connection and lets
+ *  synchronous callers take them, one or all at once, waiting on a futex over the
+ *  count itself while there are none. Unlike a done flag nothing is lost when
+ *  several complete between wakeups; each post is taken exactly once.
+ *
+ *  Posting is a single atomic add; the futex is only woken when someone waits.
+ */
+class CompletionSignal
+{
+public:
+
+    using duration = std::chrono::nanoseconds;
+    static constexpr duration FOREVER = duration::max();
+
+
+    /**
+     * @brief adds n completions and wakes whoever waits on them
+     */
+    void Post(const u32 n = 1)
+    {
+        count.fetch_add(n, std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst))
+            Futex(FUTEX_WAKE_PRIVATE, INT_MAX, nullptr);
+    } // end Post
+
+
+    /**
+     * @brief takes one completion, waiting up to timeout for it
+     *
+     * @return true if taken, false on timeout
+     */
+    bool Wait(const duration timeout = FOREVER)
+    {
+        return Take(1, timeout) == 1;
+    } // end Wait
+
+
+    /**
+     * @brief takes up to max completions, waiting up to timeout for at least one
+     *
+     * @return the number taken, 0 on timeout
+     */
+    u32 Take(const u32 max, const duration timeout = FOREVER)
+    {
+        if (!max) return 0;
+
+        const auto deadline = timeout == FOREVER ? std::chrono::steady_clock::time_point::max()
+            : std::chrono::steady_clock::now() + timeout;
+
+        while (true)
+        {
+            u32 c = count.load(std::memory_order_acquire);
+            while (c)
+            {
+                u32 n = c < max ? c : max;
+                if (count.compare_exchange_weak(c, c - n, std::memory_order_acq_rel))
+                    return n;
+            } // end while some posted
+
+            timespec ts, *pts = nullptr;
+            if (deadline != std::chrono::steady_clock::time_point::max())
+            {
+                auto left = deadline - std::chrono::steady_clock::now();
+                if (left <= duration::zero()) return 0;
+
+                auto ns = std::chrono::duration_cast<duration>(left).count();
+                ts.tv_sec = ns / 1'000'000'000;
+                ts.tv_nsec = ns % 1'000'000'000;
+                pts = &ts;
+            } // end if timed
+
+            waiters.fetch_add(1, std::memory_order_seq_cst);
+            Futex(FUTEX_WAIT_PRIVATE, 0, pts);    // returns at once unless still 0
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+        } // end while
+    } // end Take
+
+
+    /**
+     * @brief completions posted and not yet taken
+     */
+    u32 Pending() const
+    {
+        return count.load(std::memory_order_acquire);
+    } // end Pending
+
+
+    /**
+     * @brief drops whatever is pending; i.e. on reconnecting
+     */
+    void Reset()
+    {
+        count.store(0, std::memory_order_release);
+    } // end Reset
+
+private:
+
+    std::atomic<u32> count{ 0 };    // posted, not yet taken; the futex word
+    std::atomic<u32> waiters{ 0 };  // threads in or about to be in FUTEX_WAIT
+
+    static_assert(sizeof(std::atomic<u32>) == sizeof(u32), "futex word must be 32 bits");
+
+
+    long Futex(const int op, const u32 val, const timespec* timeout)
+    {
+        return syscall(SYS_futex, reinterpret_cast<u32*>(&count), op, val, timeout, nullptr, 0);
+    } // end Futex
+};
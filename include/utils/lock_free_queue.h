@@ -119,6 +119,20 @@ public:
     } // end front
 
 
+    /**
+     * @brief returns a reference to the item enqueued last; for the producing
+     *  thread only, i.e. to fill in what it knows after enqueuing
+     */
+    std::optional<std::reference_wrapper<T>> Back()
+    {
+        size_t pos = (tail.load(std::memory_order_relaxed) + Capacity - 1) & (Capacity - 1);
+        if (!buffer[pos].full.load(std::memory_order_acquire))
+            return std::nullopt;
+
+        return std::ref(buffer[pos].value);
+    } // end Back
+
+
     /**
 	 * @brief access item at given index without dequeuing it
      */
@@ -161,6 +175,9 @@ public:
         tail.store(0, std::memory_order_release);
     } // end Clear
 
+
+    static constexpr size_t MAX_ITEMS = Capacity - 1;  // one slot is always left empty
+
 private:
     static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of two");
 
@@ -0,0 +1,83 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <atomic>
+#include "basics.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief a counter with one writer and any number of readers; the writer adds
+ *  with a plain load and store, no locked instruction, and readers see a value
+ *  at most a few adds stale. Counters are kept where their writer is, i.e. per
+ *  connection side, and summed when read.
+ *
+ *  Add_Shared() is for the odd counter written from more than one thread.
+ */
+struct MetricCounter
+{
+    std::atomic<u64> v{ 0 };
+
+    MetricCounter() = default;
+    MetricCounter(const MetricCounter& other) : v(other.Get()) {}
+    MetricCounter& operator=(const MetricCounter& other)
+    {
+        v.store(other.Get(), std::memory_order_relaxed);
+        return *this;
+    } // end operator=
+
+
+    /**
+     * @brief adds n; the owning thread only
+     */
+    inline void Add(const u64 n = 1)
+    {
+        v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    } // end Add
+
+
+    /**
+     * @brief keeps the largest value seen, i.e. a high-water mark; the owning
+     *  thread only
+     */
+    inline void Max(const u64 x)
+    {
+        if (x > v.load(std::memory_order_relaxed))
+            v.store(x, std::memory_order_relaxed);
+    } // end Max
+
+
+    /**
+     * @brief adds n from any thread
+     */
+    inline void Add_Shared(const u64 n = 1)
+    {
+        v.fetch_add(n, std::memory_order_relaxed);
+    } // end Add_Shared
+
+
+    inline u64 Get() const
+    {
+        return v.load(std::memory_order_relaxed);
+    } // end Get
+
+
+    inline void Reset()
+    {
+        v.store(0, std::memory_order_relaxed);
+    } // end Reset
+};
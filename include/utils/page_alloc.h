@@ -0,0 +1,278 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "basics.h"
+#include <cstdlib>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE     64
+#endif
+
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;   // x86-64/aarch64 default huge page
+
+// mbind(2) modes, kept here to spare a libnuma dependency
+static constexpr int LB_MPOL_PREFERRED = 1;
+static constexpr int LB_MPOL_BIND = 2;
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief how pages backing buffers/arenas are obtained.
+ *
+ *  Heap:        posix_memalign/malloc; whatever the allocator decides (default).
+ *  First_Touch: private anonymous mmap; pages are faulted in on the node of the
+ *               thread that first writes them, i.e. the reactor for recv buffers.
+ *  Huge:        MAP_HUGETLB for blocks of 2MiB and up, falling back to THP via
+ *               madvise(MADV_HUGEPAGE) and then to First_Touch; smaller blocks
+ *               are served as First_Touch.
+ */
+enum class PagePolicy : u8
+{
+    Heap,
+    First_Touch,
+    Huge
+};
+
+
+/**
+ * @brief where the pages of an allocation came from; needed to give it back.
+ */
+enum class PageKind : u8
+{
+    Heap,       // posix_memalign
+    Mapped,     // anonymous mmap, possibly THP advised
+    Huge        // MAP_HUGETLB
+};
+
+
+/**
+ * @brief an allocation policy. When node is non-negative mapped pages are bound
+ *  (preferred) to that NUMA node via mbind(2), alas they land wherever first
+ *  touched.
+ */
+struct MemPolicy
+{
+    PagePolicy pages = PagePolicy::Heap;
+    int node = -1;
+};
+
+
+/**
+ * @brief an allocated block as handed out by PageAlloc
+ */
+struct PageBlock
+{
+    u8* ptr = nullptr;
+    size_t size = 0;            // bytes actually mapped/allocated
+    PageKind kind = PageKind::Heap;
+    size_t asked = 0;           // bytes asked for; size rounds it up to whole pages
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+namespace PageAlloc
+{
+    /**
+     * @brief packs a policy into 16-bits so it can live in an atomic; low byte
+     *  is the page policy, high byte the (signed) node.
+     */
+    inline u16 Pack(const MemPolicy& policy)
+    {
+        return static_cast<u16>(static_cast<u8>(policy.pages)) |
+            static_cast<u16>(static_cast<u8>(static_cast<s8>(policy.node)) << 8);
+    } // end Pack
+
+
+    /**
+     * @brief the reverse of Pack()
+     */
+    inline MemPolicy Unpack(const u16 bits)
+    {
+        return { PagePolicy(bits & 0xFF), static_cast<int>(static_cast<s8>(bits >> 8)) };
+    } // end Unpack
+
+
+    /**
+     * @brief the process wide default policy; used by buffers without a slab and
+     *  the BoltValue arenas.
+     */
+    inline std::atomic<u16>& Default_Policy_Bits()
+    {
+        static std::atomic<u16> bits{ Pack(MemPolicy{}) };
+        return bits;
+    } // end Default_Policy_Bits
+
+
+    /**
+     * @brief return's the process wide default policy
+     */
+    inline MemPolicy Default_Policy()
+    {
+        return Unpack(Default_Policy_Bits().load(std::memory_order_relaxed));
+    } // end Default_Policy
+
+
+    /**
+     * @brief sets the process wide default policy; only allocations made after
+     *  the call are affected.
+     */
+    inline void Set_Default_Policy(const MemPolicy& policy)
+    {
+        Default_Policy_Bits().store(Pack(policy), std::memory_order_relaxed);
+    } // end Set_Default_Policy
+
+
+    /**
+     * @brief return's the NUMA node of the cpu the calling thread runs on or 0
+     *  should the kernel not tell.
+     */
+    inline int Current_Node()
+    {
+        unsigned cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+            return 0;
+        return static_cast<int>(node);
+    } // end Current_Node
+
+
+    /**
+     * @brief asks the kernel to place the pages of a mapped range on the given node.
+     *  Best effort; fails quietly on single node boxes or without CAP_SYS_NICE
+     *  for strict binding.
+     *
+     * @param ptr page aligned start of range
+     * @param len length of range
+     * @param node NUMA node
+     * @param mode LB_MPOL_PREFERRED or LB_MPOL_BIND
+     *
+     * @return true if the kernel took it
+     */
+    inline bool Bind_Node(void* ptr, const size_t len, const int node,
+        const int mode = LB_MPOL_PREFERRED)
+    {
+        if (node < 0 || node >= 64) return false;
+
+        unsigned long mask = 1UL << node;
+        return syscall(SYS_mbind, ptr, len, mode, &mask, 64, 0) == 0;
+    } // end Bind_Node
+
+
+    /**
+     * @brief maps anonymous private pages
+     */
+    inline u8* Map(const size_t size, const int flags = 0)
+    {
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+        return p == MAP_FAILED ? nullptr : static_cast<u8*>(p);
+    } // end Map
+
+
+    /**
+     * @brief allocates size bytes according to policy. Mapped blocks are page
+     *  aligned (hence cache aligned) and rounded up to whole pages; heap blocks
+     *  are cache aligned.
+     *
+     * @param size number of bytes
+     * @param policy how to get the pages
+     *
+     * @return the block; ptr is nullptr when out of memory
+     */
+    inline PageBlock Allocate(const size_t size, const MemPolicy& policy = Default_Policy())
+    {
+        PageBlock blk;
+        if (size == 0) return blk;
+        blk.asked = size;
+
+        if (policy.pages == PagePolicy::Huge && size >= HUGE_PAGE_SIZE)
+        {
+            size_t len = ((size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+            if ((blk.ptr = Map(len, MAP_HUGETLB)))
+            {
+                blk.kind = PageKind::Huge;
+                blk.size = len;
+            } // end if reserved huge pages
+            else if ((blk.ptr = Map(len)))
+            {
+                madvise(blk.ptr, len, MADV_HUGEPAGE);   // THP; ignored if disabled
+                blk.kind = PageKind::Mapped;
+                blk.size = len;
+            } // end else transparent
+        } // end if huge
+        else if (policy.pages != PagePolicy::Heap)
+        {
+            size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            size_t len = ((size + page - 1) / page) * page;
+            if ((blk.ptr = Map(len)))
+            {
+                blk.kind = PageKind::Mapped;
+                blk.size = len;
+            } // end if mapped
+        } // end else first touch
+
+        if (blk.ptr)
+        {
+            if (policy.node >= 0) Bind_Node(blk.ptr, blk.size, policy.node);
+            return blk;
+        } // end if mapped
+
+        // the heap; either by policy or as the last resort
+        void* p = nullptr;
+        if (posix_memalign(&p, CACHE_LINE_SIZE, size) != 0)
+            return blk;
+
+        blk.ptr = static_cast<u8*>(p);
+        blk.size = size;
+        blk.kind = PageKind::Heap;
+        return blk;
+    } // end Allocate
+
+
+    /**
+     * @brief gives a block back to where it came from
+     *
+     * @param ptr pointer returned by Allocate
+     * @param size the block size as returned by Allocate
+     * @param kind the block kind as returned by Allocate
+     */
+    inline void Release(void* ptr, const size_t size, const PageKind kind)
+    {
+        if (!ptr) return;
+        if (kind == PageKind::Heap) std::free(ptr);
+        else munmap(ptr, size);
+    } // end Release
+
+
+    /**
+     * @brief release overload for blocks
+     */
+    inline void Release(const PageBlock& blk)
+    {
+        Release(blk.ptr, blk.size, blk.kind);
+    } // end Release
+} // end PageAlloc
@@ -0,0 +1,53 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+
+//===============================================================================|
+//          MACROS
+//===============================================================================|
+/**
+ * @brief USDT (SystemTap style) static probes on the driver's hot paths, under
+ *  the provider "lightningbolt"; i.e.
+ *
+ *      bpftrace -e 'usdt:./libdriver.so:lightningbolt:flush_end { @[arg0] = hist(arg2); }'
+ *
+ *  Built with -DLB_USDT=ON, where <sys/sdt.h> is found, each probe is a single
+ *  nop and its arguments loaded into registers; nothing more is done until a
+ *  tracer attaches. Otherwise they expand to nothing and their arguments aren't
+ *  evaluated, so only pass values already at hand.
+ *
+ *  probe               arguments
+ *  query_submit        client id, cypher (char*)
+ *  flush_start         client id, bytes to send
+ *  flush_end           client id, bytes left unsent, LBStatus
+ *  recv                client id, bytes received, bytes now unread in read_buf
+ *  frame               client id, message bytes, bytes left from it on
+ *  run_success         client id, fields bytes
+ *  record_success      client id, records, record bytes
+ *  buf_grow            old capacity, new capacity
+ *  buf_compact         bytes moved, capacity
+ *  callback            client id, records, ns from done to dispatch
+ */
+#if defined(LB_USDT) && LB_USDT && __has_include(<sys/sdt.h>)
+
+#include <sys/sdt.h>
+#define LB_PROBES_ON            1
+#define LB_PROBE1(name, a)              DTRACE_PROBE1(lightningbolt, name, a)
+#define LB_PROBE2(name, a, b)           DTRACE_PROBE2(lightningbolt, name, a, b)
+#define LB_PROBE3(name, a, b, c)        DTRACE_PROBE3(lightningbolt, name, a, b, c)
+
+#else
+
+#define LB_PROBES_ON            0
+#define LB_PROBE1(name, a)              ((void)0)
+#define LB_PROBE2(name, a, b)           ((void)0)
+#define LB_PROBE3(name, a, b, c)        ((void)0)
+
+#endif
@@ -1,9 +1,9 @@
 /**
  * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
- * 
- * @version 1.0
+ *
+ * @version 1.1
  * @date created 14th of May 2025, Wednesday
- * @date update 18th of Feburary 2026, Tuesday
+ * @date update 16th of October 2026, Friday
  */
 #pragma once
 
@@ -11,6 +11,8 @@
  //===============================================================================|
  //          INCLUDES
  //===============================================================================|
+#include <atomic>
+#include <string_view>
 #include "basics.h"
 
 
@@ -20,15 +22,48 @@
 //          ENUM & TYPES
 //===============================================================================|
 /**
- * @brief a structure that helps in measurments of latencies as a histogram of
- *  distributions. Makes use of bit bucket in which ith bucket is represented by
- *  the range [2^i,2^i+1) nanoseconds.
+ * @brief a log-linear (HDR style) histogram of latencies in nanoseconds. Values
+ *  are kept to Digits significant decimal digits over the whole range, 1 ns to
+ *  HDR_MAX_NS, in a fixed array of counts; every power of two range is split in
+ *  linear sub-buckets fine enough for that precision. So a percentile read back
+ *  is within 10^-Digits of the recorded value, relative, unlike power of two
+ *  buckets that can be off by 2x. Values past the range count at the top of it.
+ *
+ *  Copyable and mergeable; memory is counts only, i.e. 36 KiB at 2 digits and
+ *  264 KiB at 3. A histogram has a single writer but may be read while it
+ *  records, i.e. merged into a metrics snapshot off another thread; so counts
+ *  and totals are written and read as relaxed atomics, plain moves on x86-64,
+ *  and a reader sees every count whole if not the latest of each. Copies of a
+ *  live one are taken by Merge() into an empty one, not by copying.
  */
-struct LatencyHistogram
+template<int Digits>
+struct HdrHistogram
 {
+    static_assert(Digits >= 1 && Digits <= 4, "HdrHistogram: 1 to 4 significant digits");
+
     using clock = std::chrono::steady_clock;
     using duration = std::chrono::nanoseconds;
-    static constexpr size_t HIST_BUCKETS = 64;
+
+    static constexpr u64 HDR_MAX_NS = 3'600'000'000'000ULL;    // an hour
+
+    // sub-buckets per power of two; the smallest power of two >= 2 * 10^Digits
+    static constexpr int SUB_MAGNITUDE = std::bit_width(2 * [] {
+            u64 p = 1;
+            for (int i = 0; i < Digits; i++) p *= 10;
+            return p;
+        }() - 1);
+    static constexpr u64 SUB_COUNT = 1ULL << SUB_MAGNITUDE;
+    static constexpr int HALF_MAGNITUDE = SUB_MAGNITUDE - 1;
+    static constexpr u64 HALF_COUNT = SUB_COUNT >> 1;
+    static constexpr u64 SUB_MASK = SUB_COUNT - 1;
+
+    // power of two ranges needed to reach HDR_MAX_NS
+    static constexpr int BUCKETS = [] {
+            int n = 1;
+            for (u64 top = SUB_COUNT; top <= HDR_MAX_NS; top <<= 1) n++;
+            return n;
+        }();
+    static constexpr size_t HIST_BUCKETS = size_t(BUCKETS + 1) * HALF_COUNT;
 
     u64 samples{ 0 };
     duration best_latency{ duration::max() };
@@ -47,16 +82,21 @@ struct LatencyHistogram
      * @brief records a latency sample
      *
      * @param d the duration to record
+     * @param count how many times it was seen
      */
-    inline void Record_Latency(duration d)
+    inline void Record_Latency(duration d, const u64 count = 1)
     {
-        ++samples;
-        total_latency += d;
+        if (d < duration::zero()) d = duration::zero();
+
+        // the only writer; its own reads are plain
+        Store(samples, samples + count);
+        Store(total_latency, duration(total_latency + d * count));
 
-        if (d < best_latency)  best_latency = d;
-        if (d > worst_latency) worst_latency = d;
+        if (d < best_latency)  Store(best_latency, d);
+        if (d > worst_latency) Store(worst_latency, d);
 
-        latency_hist[Bucket_For(d)]++;
+        u64& bucket = latency_hist[Bucket_For(d)];
+        Store(bucket, bucket + count);
     } // end Record_Latency
 
 
@@ -67,47 +107,125 @@ struct LatencyHistogram
      */
     inline duration Avg_Latency() const
     {
-        return samples ? duration(total_latency / samples) : duration::zero();
+        const u64 n = Load(samples);
+        return n ? duration(Load(total_latency) / n) : duration::zero();
     } // end Avg_Latency
 
 
     /**
-     * @brief computes the p-th percentile latency
+     * @brief computes the p-th percentile latency; the highest value that falls
+     *  in the same sub-bucket as the sample at p, capped to the worst recorded.
      *
      * @param p the percentile to compute in [0.0, 1.0]
      */
     duration Percentile(double p) const
     {
-        if (!samples) return duration::zero();
+        const u64 n = Load(samples);
+        if (!n) return duration::zero();
 
-        uint64_t target = static_cast<uint64_t>(std::ceil(p * samples));
-        uint64_t cumulative = 0;
+        p = p < 0.0 ? 0.0 : (p > 1.0 ? 1.0 : p);
+        u64 target = static_cast<u64>(std::ceil(p * n));
+        if (!target) target = 1;
+        u64 cumulative = 0;
+        const duration worst = Load(worst_latency), best = Load(best_latency);
 
         for (size_t i = 0; i < HIST_BUCKETS; ++i)
         {
-            cumulative += latency_hist[i];
+            cumulative += Load(latency_hist[i]);
             if (cumulative >= target)
             {
-                // representative value for bucket i
-                uint64_t ns = 1ULL << (i + 1);
+                u64 ns = Highest_Equivalent(i);
+                if (ns > u64(worst.count())) ns = worst.count();
+                if (ns < u64(best.count())) ns = best.count();
                 return duration(ns);
             } // end if
         } // end for
 
-        return worst_latency;
+        return worst;
     } // end Percentile
 
-    
+
+    /**
+     * @brief the p-th percentile in nanoseconds
+     */
+    u64 Percentile_Ns(double p) const
+    {
+        return Percentile(p).count();
+    } // end Percentile_Ns
+
+
+    /**
+     * @brief the p-th percentile in microseconds, fractions kept
+     */
+    double Percentile_Us(double p) const
+    {
+        return Percentile(p).count() / 1e3;
+    } // end Percentile_Us
+
+
+    /**
+     * @brief counts the samples at most each of the given bounds, in one pass;
+     *  i.e. the cumulative buckets of an exposition format. A sub-bucket is
+     *  counted under a bound only if all of it is, so a count may miss samples
+     *  within the precision of its bound.
+     *
+     * @param bounds_ns the bounds in nanoseconds, ascending
+     * @param n how many bounds
+     * @param counts gets the n counts
+     */
+    void Cumulative(const u64* bounds_ns, const size_t n, u64* counts) const
+    {
+        u64 cumulative = 0;
+        size_t b = 0;
+
+        for (size_t i = 0; i < HIST_BUCKETS && b < n; i++)
+        {
+            u64 top = Highest_Equivalent(i);
+            while (b < n && top > bounds_ns[b])
+                counts[b++] = cumulative;
+            cumulative += Load(latency_hist[i]);
+        } // end for
+
+        while (b < n) counts[b++] = cumulative;
+    } // end Cumulative
+
+
+    /**
+     * @brief adds other's samples to this; both must be of the same precision,
+     *  which the type makes sure of. Other may be recording meanwhile; samples
+     *  is then summed from the counts taken, so percentiles stay consistent.
+     */
+    void Merge(const HdrHistogram& other)
+    {
+        u64 taken = 0;
+        for (size_t i = 0; i < HIST_BUCKETS; i++)
+        {
+            const u64 c = Load(other.latency_hist[i]);
+            latency_hist[i] += c;
+            taken += c;
+        } // end for
+        if (!taken) return;
+
+        samples += taken;
+        total_latency += Load(other.total_latency);
+        const duration best = Load(other.best_latency), worst = Load(other.worst_latency);
+        if (best < best_latency) best_latency = best;
+        if (worst > worst_latency) worst_latency = worst;
+        total_bytes_written += Load(other.total_bytes_written);
+        total_bytes_read += Load(other.total_bytes_read);
+    } // end Merge
+
+
     /**
      * @brief clears stored histogram
      */
     inline void Clear()
     {
-        memset(latency_hist, 0, sizeof(s64) * HIST_BUCKETS);
-        samples = 0;
-		best_latency = duration::max();
-		worst_latency = duration::zero();
-        total_latency = duration::zero();
+        for (u64& c : latency_hist) Store(c, u64(0));
+        Store(samples, u64(0));
+		Store(best_latency, duration::max());
+		Store(worst_latency, duration::zero());
+        Store(total_latency, duration::zero());
         total_bytes_written = 0;
         total_bytes_read = 0;
         avg_bytes_written = 0;
@@ -115,20 +233,147 @@ struct LatencyHistogram
     } // end Clear
 
 
+    /**
+     * @brief writes the histogram out as one line of text that Deserialize()
+     *  reads back on any machine; the precision, totals and the non zero counts
+     *  as index:count pairs, i.e.
+     *
+     *      LBHDR1 2 1000 812 48213 9120331 130:12 131:40 ...
+     *
+     *  Histograms of other precisions are refused when read, so percentiles
+     *  compared across deployments are compared like for like.
+     */
+    std::string Serialize() const
+    {
+        std::string out = "LBHDR1 " + std::to_string(Digits) + " " + std::to_string(samples) + " " +
+            std::to_string(samples ? best_latency.count() : 0) + " " +
+            std::to_string(worst_latency.count()) + " " + std::to_string(total_latency.count());
+
+        for (size_t i = 0; i < HIST_BUCKETS; i++)
+            if (latency_hist[i])
+                out += " " + std::to_string(i) + ":" + std::to_string(latency_hist[i]);
+
+        return out;
+    } // end Serialize
+
+
+    /**
+     * @brief reads back what Serialize() wrote, replacing what this holds
+     *
+     * @return false on another format or precision, or a malformed line; this
+     *  is left cleared then
+     */
+    bool Deserialize(std::string_view in)
+    {
+        Clear();
+
+        auto next = [&in](u64& v, const char stop) {
+            while (!in.empty() && in.front() == ' ') in.remove_prefix(1);
+            if (in.empty() || in.front() < '0' || in.front() > '9') return false;
+            v = 0;
+            while (!in.empty() && in.front() >= '0' && in.front() <= '9')
+            {
+                v = v * 10 + u64(in.front() - '0');
+                in.remove_prefix(1);
+            } // end while digits
+            if (stop != ' ')
+            {
+                if (in.empty() || in.front() != stop) return false;
+                in.remove_prefix(1);
+            } // end if separator
+            return true;
+        };
+
+        constexpr std::string_view magic = "LBHDR1 ";
+        if (in.substr(0, magic.size()) != magic) return false;
+        in.remove_prefix(magic.size());
+
+        u64 digits, n, best, worst, total;
+        if (!next(digits, ' ') || digits != u64(Digits) || !next(n, ' ') || !next(best, ' ') ||
+            !next(worst, ' ') || !next(total, ' '))
+            return Fail();
+
+        u64 counted = 0;
+        while (!in.empty())
+        {
+            u64 i, c;
+            if (!next(i, ':') || !next(c, ' ') || i >= HIST_BUCKETS) return Fail();
+            latency_hist[i] += c;
+            counted += c;
+        } // end while
+
+        if (counted != n) return Fail();
+
+        samples = n;
+        best_latency = n ? duration(best) : duration::max();
+        worst_latency = duration(worst);
+        total_latency = duration(total);
+        return true;
+    } // end Deserialize
+
+
     /**
      * @brief computes the histogram bucket for a given duration
      *
      * @param d the duration to compute bucket for
      * @return size_t the bucket index
      */
-    static inline size_t Bucket_For(LatencyHistogram::duration d)
+    static inline size_t Bucket_For(duration d)
     {
-        u64 ns = d.count();
-        // avoid zero
-        ns |= 1;
-        return std::min<size_t>(
-            LatencyHistogram::HIST_BUCKETS - 1,
-            63 - __builtin_clzll(ns)
-        );
+        u64 ns = d.count() > 0 ? u64(d.count()) : 0;
+        if (ns > HDR_MAX_NS) ns = HDR_MAX_NS;
+
+        // power of two range, then the linear step within it
+        int bucket = 63 - std::countl_zero(ns | SUB_MASK) - HALF_MAGNITUDE;
+        u64 sub = ns >> bucket;
+        return (size_t(bucket + 1) << HALF_MAGNITUDE) + size_t(sub - HALF_COUNT);
     } // end Bucket_For
-};
\ No newline at end of file
+
+
+    /**
+     * @brief the largest value counted at index i
+     */
+    static inline u64 Highest_Equivalent(const size_t i)
+    {
+        s64 bucket = s64(i >> HALF_MAGNITUDE) - 1;
+        u64 sub = (i & (HALF_COUNT - 1)) + HALF_COUNT;
+        if (bucket < 0)
+        {
+            sub -= HALF_COUNT;
+            bucket = 0;
+        } // end if first
+
+        return (sub << bucket) + (1ULL << bucket) - 1;
+    } // end Highest_Equivalent
+
+private:
+
+    bool Fail()
+    {
+        Clear();
+        return false;
+    } // end Fail
+
+
+    /**
+     * @brief relaxed atomic load and store of a count or total, see the class
+     */
+    template<typename V>
+    static V Load(const V& v)
+    {
+        return std::atomic_ref<V>(const_cast<V&>(v)).load(std::memory_order_relaxed);
+    } // end Load
+
+    template<typename V>
+    static void Store(V& v, const V x)
+    {
+        std::atomic_ref<V>(v).store(x, std::memory_order_relaxed);
+    } // end Store
+};
+
+
+/**
+ * @brief the histogram the driver keeps latencies in; two significant digits,
+ *  i.e. within 1%, from a nanosecond up to an hour
+ */
+using LatencyHistogram = HdrHistogram<2>;
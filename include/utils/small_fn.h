@@ -0,0 +1,183 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+#pragma once
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+static constexpr size_t SMALL_FN_CAPACITY = 48;     // inline bytes for captures
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+template<typename Sig, size_t Capacity = SMALL_FN_CAPACITY>
+class SmallFn;
+
+
+/**
+ * @brief a move only callable with fixed inline storage; a std::function that
+ *  never touches the heap. Whatever is stored (lambda captures, functors or plain
+ *  function pointers) must fit in Capacity bytes, which is checked at compile
+ *  time, so a capture list that grew too fat fails the build rather than quietly
+ *  allocating on every query.
+ *
+ * Type erasure is done via a static table of three function pointers per stored
+ *  type (invoke, move, destroy) so moving a SmallFn through the request and task
+ *  queues is a plain memberwise move of the captures.
+ */
+template<typename R, typename... Args, size_t Capacity>
+class SmallFn<R(Args...), Capacity>
+{
+public:
+
+    SmallFn() noexcept = default;
+    SmallFn(std::nullptr_t) noexcept {}
+
+
+    /**
+     * @brief stores any callable invocable with Args... and returning R
+     *
+     * @param fn the callable; moved or copied into inline storage
+     */
+    template<typename F, typename D = std::decay_t<F>,
+        typename = std::enable_if_t<!std::is_same_v<D, SmallFn> &&
+            std::is_invocable_r_v<R, D&, Args...>>>
+    SmallFn(F&& fn)
+    {
+        static_assert(sizeof(D) <= Capacity,
+            "SmallFn: callable too large for inline storage; capture less or by pointer");
+        static_assert(alignof(D) <= alignof(std::max_align_t),
+            "SmallFn: callable over aligned");
+        static_assert(std::is_nothrow_move_constructible_v<D>,
+            "SmallFn: callable must be nothrow move constructible");
+
+        // a function passed by name decays to a pointer that is never null; only
+        // real pointers are checked lest the compiler warn about the address
+        if constexpr (!std::is_function_v<std::remove_reference_t<F>> &&
+            (std::is_pointer_v<D> || std::is_member_pointer_v<D>))
+        {
+            if (fn == nullptr) return;  // null function pointer; stay empty
+        } // end if pointer
+
+        ::new (static_cast<void*>(storage)) D(std::forward<F>(fn));
+        ops = &Ops_For<D>;
+    } // end SmallFn
+
+
+    SmallFn(const SmallFn&) = delete;
+    SmallFn& operator=(const SmallFn&) = delete;
+
+    SmallFn(SmallFn&& other) noexcept
+    {
+        Take(other);
+    } // end move cntr
+
+
+    SmallFn& operator=(SmallFn&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            Take(other);
+        } // end if not self
+
+        return *this;
+    } // end move assign
+
+
+    SmallFn& operator=(std::nullptr_t) noexcept
+    {
+        Clear();
+        return *this;
+    } // end null assign
+
+
+    ~SmallFn()
+    {
+        Clear();
+    } // end ~SmallFn
+
+
+    /**
+     * @brief invokes the stored callable; must not be empty
+     */
+    R operator()(Args... args)
+    {
+        return ops->invoke(storage, std::forward<Args>(args)...);
+    } // end operator()
+
+
+    explicit operator bool() const noexcept { return ops != nullptr; }
+    bool operator==(std::nullptr_t) const noexcept { return ops == nullptr; }
+
+
+    /**
+     * @brief destroys the stored callable, if any, leaving this empty
+     */
+    void Clear() noexcept
+    {
+        if (ops)
+        {
+            ops->destroy(storage);
+            ops = nullptr;
+        } // end if has one
+    } // end Clear
+
+private:
+
+    struct Ops
+    {
+        R (*invoke)(void*, Args&&...);
+        void (*move)(void* dst, void* src);     // move constructs dst and destroys src
+        void (*destroy)(void*);
+    };
+
+    template<typename D>
+    static constexpr Ops Ops_For{
+        [](void* p, Args&&... args) -> R {
+            return static_cast<R>((*static_cast<D*>(p))(std::forward<Args>(args)...));
+        },
+        [](void* dst, void* src) {
+            ::new (dst) D(std::move(*static_cast<D*>(src)));
+            static_cast<D*>(src)->~D();
+        },
+        [](void* p) { static_cast<D*>(p)->~D(); }
+    };
+
+    alignas(std::max_align_t) unsigned char storage[Capacity];
+    const Ops* ops = nullptr;
+
+
+    /**
+     * @brief moves other's callable into this (which must be empty) and leaves
+     *  other empty
+     */
+    void Take(SmallFn& other) noexcept
+    {
+        if (other.ops)
+        {
+            other.ops->move(storage, other.storage);
+            ops = other.ops;
+            other.ops = nullptr;
+        } // end if other has one
+    } // end Take
+};
@@ -0,0 +1,507 @@
+/**
+ * @file microbench.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief microbenchmarks of the parts the driver spends its time in, with no
+ *  server needed: BoltEncoder::Encode for every type and each of its size
+ *  classes, the jump table decoder over the record shapes queries mostly
+ *  return, BoltBuf writes, compactions and grows, BoltPool allocs and releases
+ *  and LockFreeQueue throughput between two threads.
+ *
+ *  Every case is run once to warm up and then timed over a number of runs; the
+ *  least, median and most ns per operation are kept. Usage:
+ *
+ *      microbench [filter] [--reps n] [--json path]
+ *
+ *  filter runs only the cases whose name has it in, i.e. "encode/string".
+ *  --json writes the results for comparing against an earlier run; "-" writes
+ *  them to stdout in place of the table.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <deque>
+#include <thread>
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_decoder.h"
+#include "utils/lock_free_queue.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+using Clock = std::chrono::steady_clock;
+
+
+/**
+ * @brief one case's timings
+ */
+struct BenchResult
+{
+    std::string name;           // group/param
+    size_t ops;                 // operations per run
+    size_t bytes;               // bytes handled per operation; 0 when it means nothing
+    double min_ns;              // ns per operation, over the runs
+    double median_ns;
+    double max_ns;
+};
+
+
+/**
+ * @brief a queue item the size of a cache line
+ */
+struct Line
+{
+    u64 v[8];
+};
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr int RECORDS = 2'000;          // records per decode run
+
+std::vector<BenchResult> results;
+const char* filter = nullptr;
+int reps = 7;
+bool quiet = false;                     // JSON going to stdout
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief keeps the compiler from dropping work whose result is never read
+ */
+template<typename T>
+inline void Keep(const T& v)
+{
+    asm volatile("" : : "g"(&v) : "memory");
+} // end Keep
+
+
+/**
+ * @brief operations per run, so that a run handles about 32 MiB or a million
+ *  operations, whichever is fewer
+ */
+size_t Ops_For(const size_t bytes)
+{
+    return std::clamp<size_t>((32u << 20) / (bytes + 16), 200, 1'000'000);
+} // end Ops_For
+
+
+/**
+ * @brief runs fn, which does ops operations of bytes each, once to warm up and
+ *  reps times more timed
+ */
+template<typename F>
+void Measure(const std::string& name, const size_t ops, const size_t bytes, F&& fn)
+{
+    if (filter && name.find(filter) == std::string::npos) return;
+
+    fn();
+    std::vector<double> ns;
+    for (int r = 0; r < reps; r++)
+    {
+        auto t0 = Clock::now();
+        fn();
+        ns.push_back(std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / double(ops));
+    } // end for
+
+    std::sort(ns.begin(), ns.end());
+    const BenchResult& res = results.emplace_back(BenchResult{ name, ops, bytes, ns.front(), ns[ns.size() / 2],
+        ns.back() });
+
+    if (quiet) return;
+    if (bytes) Utils::Print("  %-32s %12.1f %12.1f %12.1f %10.1f", name.c_str(), res.min_ns, res.median_ns,
+        res.max_ns, double(bytes) * 1e3 / res.median_ns);
+    else Utils::Print("  %-32s %12.1f %12.1f %12.1f %10s", name.c_str(), res.min_ns, res.median_ns, res.max_ns, "-");
+} // end Measure
+
+
+/**
+ * @brief times encoding val over and over into a buffer it fits in
+ */
+template<typename T>
+void Encode_Case(const std::string& name, const T& val)
+{
+    BoltBuf probe(1u << 20);        // compound values are written without growing
+    BoltEncoder(probe).Encode(val);
+    const size_t bytes = probe.Size();
+
+    BoltBuf buf(bytes + 4096);
+    BoltEncoder encoder(buf);
+    Measure("encode/" + name, Ops_For(bytes), bytes, [&] {
+        for (size_t i = 0, n = Ops_For(bytes); i < n; i++)
+        {
+            buf.Reset();
+            encoder.Encode(val);
+            Keep(buf);
+        } // end for
+    });
+} // end Encode_Case
+
+
+/**
+ * @brief a node struct; id, labels, 8 properties and element id, kept in keep
+ */
+BoltValue Make_Node(const int i, std::deque<std::string>& keep)
+{
+    return BoltValue(0x4E, {
+        BoltValue::Make_Int(i),
+        BoltValue({ "Person", "Customer" }),
+        BoltValue({
+            mp("id", BoltValue::Make_Int(i)),
+            mp("name", BoltValue("Lightning Bolt Person")),
+            mp("created", BoltValue::Make_Int(1700000000000ll + i)),
+            mp("age", BoltValue::Make_Int(20 + i % 60)),
+            mp("score", BoltValue::Make_Float(i * 0.5)),
+            mp("city", BoltValue("Addis Ababa")),
+            mp("email", BoltValue("someone@example.com")),
+            mp("active", BoltValue::Make_Bool(i & 1)) }),
+        BoltValue(keep.emplace_back("4:b6a1:" + std::to_string(i))) });
+} // end Make_Node
+
+
+/**
+ * @brief every type, and strings, bytes, lists and maps in each size class the
+ *  encoder has a marker for
+ */
+void Encoder()
+{
+    Encode_Case("null", nullptr);
+    Encode_Case("bool", true);
+    Encode_Case("int/tiny", s64(42));
+    Encode_Case("int/int8", s64(-100));
+    Encode_Case("int/int16", s64(1'000));
+    Encode_Case("int/int32", s64(100'000));
+    Encode_Case("int/int64", s64(1'000'000'000'000));
+    Encode_Case("float", 3.14159);
+
+    const std::pair<const char*, size_t> classes[] = { { "tiny_8", 8 }, { "8bit_200", 200 },
+        { "16bit_4000", 4'000 }, { "32bit_100000", 100'000 } };
+
+    for (auto& [cls, n] : classes)
+        Encode_Case("string/" + std::string(cls), std::string(n, 'x'));
+
+    for (auto& [cls, n] : classes)
+        if (n >= 16) Encode_Case("bytes/" + std::string(cls), std::vector<u8>(n, 0xAB));
+
+    std::deque<std::string> keep;
+    for (auto& [cls, n] : classes)
+    {
+        if (n > 4'000) break;
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltValue list = BoltValue::Make_List();
+        BoltValue map = BoltValue::Make_Map();
+        for (size_t k = 0; k < n; k++)
+        {
+            list.Insert_List(BoltValue::Make_Int(s64(k) * 1000));
+            map.Insert_Map(BoltValue(keep.emplace_back("key" + std::to_string(k))), BoltValue::Make_Int(s64(k)));
+        } // end for
+
+        Encode_Case("list/" + std::string(cls), list);
+        Encode_Case("map/" + std::string(cls), map);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Encode_Case("struct/node", Make_Node(7, keep));
+    Release_Pool<BoltValue>(offset);
+} // end Encoder
+
+
+/**
+ * @brief encodes RECORDS records of the given shape into buf, as they come
+ *  over the wire
+ */
+void Fill(BoltBuf& buf, const int shape)
+{
+    BoltEncoder encoder(buf);
+    for (int i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        std::deque<std::string> keep;
+        BoltValue row;
+        switch (shape)
+        {
+        case 0:     // flat row
+            row = BoltValue({ i, "Lightning Bolt", i * 0.25, (i & 1) == 0,
+                BoltValue::Make_Null(), s64(i) * 100000 });
+            break;
+
+        case 1:     // node
+            row = BoltValue({ Make_Node(i, keep) });
+            break;
+
+        case 2:     // path of three nodes
+        {
+            BoltValue rel(0x72, { BoltValue::Make_Int(i), BoltValue("KNOWS"), BoltValue::Make_Map() });
+            BoltValue path(0x50, {
+                BoltValue({ Make_Node(i, keep), Make_Node(i + 1, keep), Make_Node(i + 2, keep) }),
+                BoltValue({ rel, rel }),
+                BoltValue({ 1, 1, 2, 2 }) });
+            row = BoltValue({ path });
+            break;
+        } // end path
+
+        default:    // 300 numbers, a LIST16
+        {
+            BoltValue wide = BoltValue::Make_List();
+            for (int k = 0; k < 300; k++)
+                wide.Insert_List(BoltValue::Make_Int(k % 3 ? k : k * 1000));
+            row = BoltValue({ i, wide });
+            break;
+        } // end wide
+        } // end switch
+
+        BoltMessage rec(BoltValue(BOLT_RECORD, { row }));
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+} // end Fill
+
+
+/**
+ * @brief the jump table over each record shape; an operation is a record
+ *  decoded, its values given back to the pool after every run
+ */
+void Decoder()
+{
+    const char* shapes[] = { "flat_row", "node", "path", "list_300" };
+    for (int shape = 0; shape < 4; shape++)
+    {
+        BoltBuf buf(8u << 20);
+        Fill(buf, shape);
+
+        Measure("decode/" + std::string(shapes[shape]), RECORDS, buf.Size() / RECORDS, [&] {
+            size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+            u8* cursor = buf.Data();
+            u8* end = cursor + buf.Size();
+            while (cursor < end)
+            {
+                BoltValue v;
+                v.buf = &buf;
+                u8* pos = cursor + 2;
+                if (!jump_table[*pos](pos, v)) Fatal("decode failed");
+                Keep(v);
+                cursor = pos + 2;       // single chunk records; skip the 00 00
+            } // end while
+            Release_Pool<BoltValue>(offset);
+        });
+    } // end for
+} // end Decoder
+
+
+/**
+ * @brief writes of a few sizes, compactions of a few leftovers and growing
+ *  from the least capacity up to a few sizes
+ */
+void Buffers()
+{
+    for (size_t n : { 16, 256, 4'096 })
+    {
+        BoltBuf buf(MIN_CAPACITY);
+        std::vector<u8> src(n, 0x5A);
+        const size_t ops = Ops_For(n);
+        Measure("boltbuf/write/" + std::to_string(n), ops, n, [&] {
+            for (size_t i = 0; i < ops; i++)
+            {
+                if (buf.Writable_Size() < n) buf.Reset();
+                if (!buf.Write(src.data(), n)) Fatal("boltbuf: write refused");
+            } // end for
+            Keep(buf);
+        });
+    } // end for writes
+
+    for (size_t left : { 64, 4'096, 32'768 })
+    {
+        BoltBuf buf(MIN_CAPACITY);
+        const size_t fill = MIN_CAPACITY - 4;
+        const size_t ops = Ops_For(left);
+        Measure("boltbuf/compact/" + std::to_string(left), ops, left, [&] {
+            for (size_t i = 0; i < ops; i++)
+            {
+                buf.Reset();
+                buf.Advance(fill);
+                buf.Consume(fill - left);
+                buf.Compact();
+            } // end for
+            Keep(buf);
+        });
+    } // end for compactions
+
+    for (size_t target : { 256u << 10, 1u << 20, 16u << 20 })
+    {
+        const size_t ops = std::max<size_t>(8, (64u << 20) / target);
+        Measure("boltbuf/grow/" + std::to_string(target >> 10) + "k", ops, target, [&] {
+            for (size_t i = 0; i < ops; i++)
+            {
+                BoltBuf buf(MIN_CAPACITY);
+                while (buf.Capacity() < target)
+                    if (buf.Grow()) Fatal("grow failed");
+                Keep(buf);
+            } // end for
+        });
+    } // end for grows
+} // end Buffers
+
+
+/**
+ * @brief allocs released right away, in the scratch and spilling into the
+ *  arena, and nested allocs given back at once the way a decoded row is
+ */
+void Pool()
+{
+    BoltPool<BoltValue>* pool = GetBoltPool<BoltValue>();
+    const size_t ops = 1'000'000;
+
+    for (size_t count : { 1, 16, 256, 4'096 })
+    {
+        Measure("boltpool/alloc_release/" + std::to_string(count), ops, 0, [&] {
+            for (size_t i = 0; i < ops; i++)
+            {
+                size_t at = pool->Alloc(count);
+                Keep(at);
+                pool->Release();
+            } // end for
+        });
+    } // end for
+
+    const size_t depth = 32;
+    Measure("boltpool/nested/" + std::to_string(depth), ops / depth, 0, [&] {
+        for (size_t i = 0; i < ops / depth; i++)
+        {
+            size_t offset = pool->Get_Last_Offset();
+            for (size_t d = 0; d < depth; d++)
+                Keep(pool->Alloc(4));
+            Release_Pool<BoltValue>(offset);
+        } // end for
+    });
+} // end Pool
+
+
+/**
+ * @brief ops items from a producer thread to this one through the queue; an
+ *  operation is an item across
+ */
+template<typename T>
+void Queue_Case(const std::string& name, const size_t ops)
+{
+    auto q = std::make_unique<LockFreeQueue<T>>();
+    Measure("queue/spsc/" + name, ops, sizeof(T), [&] {
+        std::thread producer([&] {
+            T item{};
+            for (size_t i = 0; i < ops; i++)
+            {
+                reinterpret_cast<u64&>(item) = i;
+                while (!q->Enqueue(item)) std::this_thread::yield();
+            } // end for
+        });
+
+        u64 sum = 0;
+        for (size_t i = 0; i < ops; i++)
+        {
+            std::optional<T> item;
+            while (!(item = q->Dequeue())) std::this_thread::yield();
+            sum += reinterpret_cast<const u64&>(*item);
+        } // end for
+        producer.join();
+        if (sum != u64(ops) * (ops - 1) / 2) Fatal("queue lost items");
+    });
+} // end Queue_Case
+
+
+/**
+ * @brief the queue between two threads for a small and a cache line item, and
+ *  on one thread with no one to contend with
+ */
+void Queue()
+{
+    const size_t ops = 1u << 20;
+    Queue_Case<u64>("u64", ops);
+    Queue_Case<Line>("64b", ops);
+
+    auto q = std::make_unique<LockFreeQueue<u64>>();
+    Measure("queue/ping/u64", ops, sizeof(u64), [&] {
+        for (size_t i = 0; i < ops; i++)
+        {
+            q->Enqueue(i);
+            Keep(q->Dequeue());
+        } // end for
+    });
+} // end Queue
+
+
+/**
+ * @brief writes the results as JSON to path, or stdout given "-"
+ */
+void Write_Json(const char* path)
+{
+    FILE* out = strcmp(path, "-") ? fopen(path, "w") : stdout;
+    if (!out) Fatal("can't open %s", path);
+
+    fprintf(out, "{\n  \"suite\": \"lightningbolt-microbench\",\n  \"compiler\": \"%s\",\n"
+        "  \"computed_goto\": %s,\n  \"reps\": %d,\n  \"benchmarks\": [\n", __VERSION__,
+        LB_COMPUTED_GOTO ? "true" : "false", reps);
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchResult& r = results[i];
+        fprintf(out, "    { \"name\": \"%s\", \"ops\": %zu, \"bytes_per_op\": %zu, \"ns_per_op\": "
+            "{ \"min\": %.2f, \"median\": %.2f, \"max\": %.2f }, \"mb_per_s\": %.1f }%s\n", r.name.c_str(), r.ops,
+            r.bytes, r.min_ns, r.median_ns, r.max_ns, r.bytes ? double(r.bytes) * 1e3 / r.median_ns : 0.0,
+            i + 1 < results.size() ? "," : "");
+    } // end for
+
+    fprintf(out, "  ]\n}\n");
+    if (out != stdout) fclose(out);
+} // end Write_Json
+
+
+int main(int argc, char** argv)
+{
+    const char* json = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--json") && i + 1 < argc) json = argv[++i];
+        else if (!strcmp(argv[i], "--reps") && i + 1 < argc) reps = std::max(1, atoi(argv[++i]));
+        else filter = argv[i];
+    } // end for
+
+    quiet = json && !strcmp(json, "-");
+    if (!quiet)
+    {
+        Utils::Print_Title();
+        Utils::Print("%d runs per case, ns/op (computed goto %s)", reps, LB_COMPUTED_GOTO ? "on" : "off");
+        Utils::Print("  %-32s %12s %12s %12s %10s", "case", "min", "median", "max", "MB/s");
+    } // end if
+
+    Encoder();
+    Decoder();
+    Buffers();
+    Pool();
+    Queue();
+
+    if (json) Write_Json(json);
+    if (!quiet) Utils::Print("%zu cases.", results.size());
+    return 0;
+} // end main
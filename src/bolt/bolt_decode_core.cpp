@@ -0,0 +1,304 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <array>
+#include "bolt/boltvalue.h"
+#include "bolt/bolt_jump_table.h"
+#include "bolt/bolt_row.h"
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief what a marker byte is, so one dispatch covers all 256 markers; the
+ *  order is that of the labels in Walk().
+ */
+enum Marker_Class : u8
+{
+    MC_TINY_INT, MC_TINY_STRING, MC_TINY_LIST, MC_TINY_MAP, MC_STRUCT,
+    MC_NULL, MC_FALSE, MC_TRUE, MC_FLOAT,
+    MC_INT8, MC_INT16, MC_INT32, MC_INT64,
+    MC_STRING8, MC_STRING16, MC_STRING32,
+    MC_BYTES8, MC_BYTES16, MC_BYTES32,
+    MC_LIST8, MC_LIST16, MC_LIST32,
+    MC_MAP8, MC_MAP16, MC_MAP32,
+    MC_BAD,
+};
+
+
+static constexpr std::array<u8, 256> marker_class = [] {
+    std::array<u8, 256> c{};
+    for (int m = 0; m < 256; m++)
+    {
+        if (m < 0x80 || m >= 0xF0) c[m] = MC_TINY_INT;
+        else if (m < 0x90) c[m] = MC_TINY_STRING;
+        else if (m < 0xA0) c[m] = MC_TINY_LIST;
+        else if (m < 0xB0) c[m] = MC_TINY_MAP;
+        else if (m < 0xC0) c[m] = MC_STRUCT;
+        else c[m] = MC_BAD;
+    } // end for
+
+    c[BOLT_NULL] = MC_NULL;         c[BOLT_FLOAT64] = MC_FLOAT;
+    c[BOLT_BOOL_FALSE] = MC_FALSE;  c[BOLT_BOOL_TRUE] = MC_TRUE;
+    c[BOLT_INT8] = MC_INT8;         c[BOLT_INT16] = MC_INT16;
+    c[BOLT_INT32] = MC_INT32;       c[BOLT_INT64] = MC_INT64;
+    c[BOLT_STRING8] = MC_STRING8;   c[BOLT_STRING16] = MC_STRING16;   c[BOLT_STRING32] = MC_STRING32;
+    c[BOLT_BYTES8] = MC_BYTES8;     c[BOLT_BYTES16] = MC_BYTES16;     c[BOLT_BYTES32] = MC_BYTES32;
+    c[BOLT_LIST8] = MC_LIST8;       c[BOLT_LIST16] = MC_LIST16;       c[BOLT_LIST32] = MC_LIST32;
+    c[BOLT_MAP8] = MC_MAP8;         c[BOLT_MAP16] = MC_MAP16;         c[BOLT_MAP32] = MC_MAP32;
+    return c;
+}();
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief steps over the pending values that follow a container's header; nested
+ *  containers add their items to pending rather than recurse. Values inside a
+ *  container aren't kept (BoltValue containers decode their items on access),
+ *  so all this does is find the end. Every marker is handled right here.
+ *
+ *  With Goto each handler jumps straight to the next one through a table of
+ *  label addresses (GCC/Clang labels as values), giving the branch predictor a
+ *  jump per handler; without, it's a switch in a loop. Same handlers either way.
+ *
+ * @param pos start of the first pending value; moved past the last on success
+ * @param pending number of values to step over
+ *
+ * @return false on a reserved marker, with pos at it
+ */
+template<bool Goto>
+static inline bool Walk(u8*& pos, size_t pending)
+{
+    u8* p = pos;
+
+#if LB_COMPUTED_GOTO
+    static const void* const labels[] = {
+        &&tiny_int, &&tiny_string, &&tiny_list, &&tiny_map, &&structure,
+        &&one, &&one, &&one, &&nine,
+        &&two, &&three, &&five, &&nine,
+        &&string8, &&string16, &&string32,
+        &&string8, &&string16, &&string32,
+        &&list8, &&list16, &&list32,
+        &&map8, &&map16, &&map32,
+        &&bad,
+    };
+#endif
+
+next:
+    if (pending == 0)
+    {
+        pos = p;
+        return true;
+    } // end if done
+    pending--;
+
+#if LB_COMPUTED_GOTO
+    if constexpr (Goto) goto *labels[marker_class[*p]];
+#endif
+
+    switch (marker_class[*p])
+    {
+    case MC_TINY_INT: tiny_int:
+    case MC_NULL: case MC_FALSE: case MC_TRUE: one:
+        p += 1;
+        goto next;
+
+    case MC_TINY_STRING: tiny_string:
+        p += 1 + (*p & 0x0F);
+        goto next;
+
+    case MC_TINY_LIST: tiny_list:
+        pending += *p++ & 0x0F;
+        goto next;
+
+    case MC_TINY_MAP: tiny_map:
+        pending += 2 * (*p++ & 0x0F);
+        goto next;
+
+    case MC_STRUCT: structure:
+        pending += *p & 0x0F;
+        p += 2;
+        goto next;
+
+    case MC_INT8: two: p += 2; goto next;
+    case MC_INT16: three: p += 3; goto next;
+    case MC_INT32: five: p += 5; goto next;
+    case MC_INT64: case MC_FLOAT: nine: p += 9; goto next;
+
+    case MC_STRING8: case MC_BYTES8: string8:
+        p += 2 + p[1];
+        goto next;
+    case MC_STRING16: case MC_BYTES16: string16:
+        p += 3 + Unpack::Get_BE<u16>(p + 1);
+        goto next;
+    case MC_STRING32: case MC_BYTES32: string32:
+        p += 5 + size_t(Unpack::Get_BE<u32>(p + 1));
+        goto next;
+
+    case MC_LIST8: list8: pending += p[1]; p += 2; goto next;
+    case MC_LIST16: list16: pending += Unpack::Get_BE<u16>(p + 1); p += 3; goto next;
+    case MC_LIST32: list32: pending += Unpack::Get_BE<u32>(p + 1); p += 5; goto next;
+
+    case MC_MAP8: map8: pending += 2 * size_t(p[1]); p += 2; goto next;
+    case MC_MAP16: map16: pending += 2 * size_t(Unpack::Get_BE<u16>(p + 1)); p += 3; goto next;
+    case MC_MAP32: map32: pending += 2 * size_t(Unpack::Get_BE<u32>(p + 1)); p += 5; goto next;
+
+    default: bad:
+        pos = p;
+        return false;
+    } // end switch
+} // end Walk
+
+
+/**
+ * @brief reads the header of a sized string/bytes/list/map at p
+ *
+ * @return the header size; n receives the length
+ */
+template<typename T>
+static inline size_t Sized(const u8* p, u32& n)
+{
+    n = sizeof(T) == 1 ? p[1] : static_cast<u32>(Unpack::Get_BE<T>(p + 1));
+    return 1 + sizeof(T);
+} // end Sized
+
+
+/**
+ * @brief decodes the value at pos into out as the jump table would; scalars in
+ *  full, containers as a view (offset + size) after stepping over their items
+ *  with Walk(). Tiny ints and tiny strings, most of any record, are tested for
+ *  before anything else.
+ */
+template<bool Goto>
+static inline bool Decode_Core(u8*& pos, BoltValue& out)
+{
+    u8* p = pos;
+    const u8 m = *p;
+    BoltBuf* buf = out.buf;
+    size_t h;
+    u32 n;
+
+    if (m < 0x80 || m >= 0xF0)
+    {
+        out.type = BoltType::Int;
+        out.int_val = static_cast<s8>(m);
+        out.is_decoded = true;
+        pos = p + 1;
+        return true;
+    } // end if tiny int
+
+    if ((m & 0xF0) == BOLT_STRINGTINY)
+    {
+        n = m & 0x0F;
+        out = BoltValue::Make_String(p + 1 - buf->Data(), n, buf);
+        pos = p + 1 + n;
+        return true;
+    } // end if tiny string
+
+    switch (marker_class[m])
+    {
+    case MC_STRUCT:
+        n = m & 0x0F;
+        out = BoltValue::Make_Struct(p + 2 - buf->Data(), p[1], n, buf);
+        p += 2;
+        break;
+
+    case MC_TINY_LIST: n = m & 0x0F; h = 1; goto list;
+    case MC_LIST8: h = Sized<u8>(p, n); goto list;
+    case MC_LIST16: h = Sized<u16>(p, n); goto list;
+    case MC_LIST32: h = Sized<u32>(p, n);
+    list:
+        out = BoltValue::Make_List(p + h - buf->Data(), n, buf);
+        p += h;
+        break;
+
+    case MC_TINY_MAP: n = m & 0x0F; h = 1; goto map;
+    case MC_MAP8: h = Sized<u8>(p, n); goto map;
+    case MC_MAP16: h = Sized<u16>(p, n); goto map;
+    case MC_MAP32: h = Sized<u32>(p, n);
+    map:
+        out = BoltValue::Make_Map(p + h - buf->Data(), n, buf);
+        p += h;
+        n *= 2;
+        break;
+
+    case MC_STRING8: h = Sized<u8>(p, n); goto string;
+    case MC_STRING16: h = Sized<u16>(p, n); goto string;
+    case MC_STRING32: h = Sized<u32>(p, n);
+    string:
+        out = BoltValue::Make_String(p + h - buf->Data(), n, buf);
+        pos = p + h + n;
+        return true;
+
+    case MC_BYTES8: h = Sized<u8>(p, n); goto bytes;
+    case MC_BYTES16: h = Sized<u16>(p, n); goto bytes;
+    case MC_BYTES32: h = Sized<u32>(p, n);
+    bytes:
+        out = BoltValue::Make_Bytes(p + h - buf->Data(), n, buf);
+        pos = p + h + n;
+        return true;
+
+    case MC_INT8: out.Set_Int_RawDirect<s8>(p + 1); out.is_decoded = true; pos = p + 2; return true;
+    case MC_INT16: out.Set_Int_RawDirect<s16>(p + 1); out.is_decoded = true; pos = p + 3; return true;
+    case MC_INT32: out.Set_Int_RawDirect<s32>(p + 1); out.is_decoded = true; pos = p + 5; return true;
+    case MC_INT64: out.Set_Int_RawDirect<s64>(p + 1); out.is_decoded = true; pos = p + 9; return true;
+
+    case MC_FLOAT:
+    {
+        double v;
+        iCpy(&v, p + 1, sizeof(double));
+        out = BoltValue::Make_Float(swap_endian_double(v));
+        pos = p + 9;
+        return true;
+    } // end float
+
+    case MC_NULL: out = BoltValue::Make_Null(); pos = p + 1; return true;
+    case MC_FALSE: out = BoltValue::Make_Bool(false); pos = p + 1; return true;
+    case MC_TRUE: out = BoltValue::Make_Bool(true); pos = p + 1; return true;
+
+    default:
+        out = BoltValue::Make_Unknown();
+        pos = p + 1;
+        return false;
+    } // end switch
+
+    // a container; find its end
+    pos = p;
+    return Walk<Goto>(pos, n);
+} // end Decode_Core
+
+
+/**
+ * @brief decodes a value through the threaded core; computed goto where the
+ *  compiler has it, the switch elsewhere.
+ */
+bool Decode_Threaded(u8*& pos, BoltValue& out)
+{
+    return Decode_Core<LB_COMPUTED_GOTO != 0>(pos, out);
+} // end Decode_Threaded
+
+
+/**
+ * @brief decodes a value through the threaded core's switch, whatever the
+ *  compiler; mostly to measure it against the other two.
+ */
+bool Decode_Switched(u8*& pos, BoltValue& out)
+{
+    return Decode_Core<false>(pos, out);
+} // end Decode_Switched
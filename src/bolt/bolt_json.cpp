@@ -0,0 +1,727 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <charconv>
+#include <cmath>
+#include "bolt/bolt_json.h"
+#include "bolt/bolt_graph.h"
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define LB_JSON_SSE2 1
+#else
+#define LB_JSON_SSE2 0
+#endif
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief appends to a BoltBuf through a cursor of its own; Reserve() before the
+ *  Put() functions, which write without checking, and Flush() to hand what was
+ *  written back to the buffer. A failed Reserve() is remembered so the callers
+ *  can tell running out of memory from malformed input.
+ */
+struct Json_Writer
+{
+    BoltBuf& buf;
+    u8* w;                  // where the next byte goes
+    u8* limit;              // end of the room the buffer has
+    bool no_mem = false;
+
+    explicit Json_Writer(BoltBuf& out) : buf(out) { Sync(); }
+    ~Json_Writer() { Flush(); }
+
+    void Sync()
+    {
+        w = buf.Data() + buf.Get_Write_Offset();
+        limit = w + buf.Writable_Size();
+    } // end Sync
+
+    void Flush()
+    {
+        buf.Advance(w - (buf.Data() + buf.Get_Write_Offset()));
+    } // end Flush
+
+    bool Reserve(const size_t n)
+    {
+        if (static_cast<size_t>(limit - w) >= n) return true;
+
+        Flush();
+        while (buf.Writable_Size() < n)
+            if (buf.Grow() != 0) { no_mem = true; Sync(); return false; }
+        Sync();
+        return true;
+    } // end Reserve
+
+    void Put(const char c) { *w++ = static_cast<u8>(c); }
+    void Put(std::string_view s) { iCpy(w, s.data(), s.size()); w += s.size(); }
+
+    bool Write(const char c) { if (!Reserve(1)) return false; Put(c); return true; }
+    bool Write(std::string_view s) { if (!Reserve(s.size())) return false; Put(s); return true; }
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief writes the escape sequence for c
+ */
+static inline u8* Escape_Byte(u8* w, const u8 c)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    *w++ = '\\';
+    switch (c)
+    {
+    case '"': *w++ = '"'; break;
+    case '\\': *w++ = '\\'; break;
+    case '\n': *w++ = 'n'; break;
+    case '\r': *w++ = 'r'; break;
+    case '\t': *w++ = 't'; break;
+    case '\b': *w++ = 'b'; break;
+    case '\f': *w++ = 'f'; break;
+    default:
+        *w++ = 'u'; *w++ = '0'; *w++ = '0';
+        *w++ = hex[c >> 4];
+        *w++ = hex[c & 0x0F];
+        break;
+    } // end switch
+
+    return w;
+} // end Escape_Byte
+
+
+/**
+ * @brief writes s quoted and escaped at w, which has room for 6 * n + 2 bytes.
+ *  Under SSE2 16 bytes are stored as they are and tested at once; only the
+ *  first byte needing an escape, if any, stops the run.
+ *
+ * @return past the closing quote
+ */
+static inline u8* Escape_Into(u8* w, const u8* s, const size_t n)
+{
+    size_t i = 0;
+    *w++ = '"';
+
+#if LB_JSON_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('\\');
+    const __m128i ctl = _mm_set1_epi8(0x1F);
+
+    while (i + 16 <= n)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m128i hit = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, slash)),
+            _mm_cmpeq_epi8(_mm_min_epu8(v, ctl), v));     // v <= 0x1F unsigned
+
+        // at least 16 input bytes left means at least 96 bytes of room
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(w), v);
+
+        const int mask = _mm_movemask_epi8(hit);
+        if (mask == 0) { w += 16; i += 16; continue; }
+
+        const int clean = __builtin_ctz(mask);
+        w = Escape_Byte(w + clean, s[i + clean]);
+        i += clean + 1;
+    } // end while
+#endif
+
+    for (; i < n; i++)
+    {
+        const u8 c = s[i];
+        if (c == '"' || c == '\\' || c < 0x20) w = Escape_Byte(w, c);
+        else *w++ = c;
+    } // end for
+
+    *w++ = '"';
+    return w;
+} // end Escape_Into
+
+
+/**
+ * @brief writes s as a JSON string
+ */
+static inline bool String(Json_Writer& w, std::string_view s)
+{
+    if (!w.Reserve(6 * s.size() + 2)) return false;
+
+    w.w = Escape_Into(w.w, reinterpret_cast<const u8*>(s.data()), s.size());
+    return true;
+} // end String
+
+
+/**
+ * @brief writes v in decimal
+ */
+static inline bool Int(Json_Writer& w, const s64 v)
+{
+    if (!w.Reserve(24)) return false;
+
+    char* start = reinterpret_cast<char*>(w.w);
+    w.w = reinterpret_cast<u8*>(std::to_chars(start, start + 24, v).ptr);
+    return true;
+} // end Int
+
+
+/**
+ * @brief writes d in the shortest form that reads back the same
+ */
+static inline bool Float(Json_Writer& w, const double d)
+{
+    if (std::isnan(d)) return w.Write("\"NaN\"");
+    if (std::isinf(d)) return w.Write(d > 0 ? "\"Infinity\"" : "\"-Infinity\"");
+    if (!w.Reserve(32)) return false;
+
+    char* start = reinterpret_cast<char*>(w.w);
+    w.w = reinterpret_cast<u8*>(std::to_chars(start, start + 32, d).ptr);
+    return true;
+} // end Float
+
+
+/**
+ * @brief writes n bytes at s as a base64 string
+ */
+static bool Base64(Json_Writer& w, const u8* s, const size_t n)
+{
+    static const char digits[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    if (!w.Reserve((n + 2) / 3 * 4 + 2)) return false;
+
+    u8* o = w.w;
+    size_t i = 0;
+    *o++ = '"';
+    for (; i + 3 <= n; i += 3)
+    {
+        const u32 v = (u32(s[i]) << 16) | (u32(s[i + 1]) << 8) | s[i + 2];
+        *o++ = digits[v >> 18];
+        *o++ = digits[(v >> 12) & 0x3F];
+        *o++ = digits[(v >> 6) & 0x3F];
+        *o++ = digits[v & 0x3F];
+    } // end for
+
+    if (i < n)
+    {
+        const u32 v = (u32(s[i]) << 16) | (i + 1 < n ? u32(s[i + 1]) << 8 : 0);
+        *o++ = digits[v >> 18];
+        *o++ = digits[(v >> 12) & 0x3F];
+        *o++ = i + 1 < n ? digits[(v >> 6) & 0x3F] : '=';
+        *o++ = '=';
+    } // end if tail
+
+    *o++ = '"';
+    w.w = o;
+    return true;
+} // end Base64
+
+
+/**
+ * @brief the civil date of days since 1970-01-01 (proleptic Gregorian)
+ */
+static void Civil_Date(s64 days, s64& y, unsigned& m, unsigned& d)
+{
+    days += 719468;
+    const s64 era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mon = (5 * doy + 2) / 153;
+
+    d = doy - (153 * mon + 2) / 5 + 1;
+    m = mon < 10 ? mon + 3 : mon - 9;
+    y = static_cast<s64>(yoe) + era * 400 + (m <= 2);
+} // end Civil_Date
+
+
+/**
+ * @brief appends v with at least width digits, zero padded
+ */
+static char* Put_Padded(char* o, u64 v, int width)
+{
+    char digits[20];
+    int n = 0;
+    do { digits[n++] = char('0' + v % 10); v /= 10; } while (v);
+    while (n < width) digits[n++] = '0';
+    while (n) *o++ = digits[--n];
+    return o;
+} // end Put_Padded
+
+
+/**
+ * @brief appends .f for a fraction of a second in nanoseconds; trailing zeros
+ *  trimmed, nothing at all for none
+ */
+static char* Put_Fraction(char* o, s64 nanos)
+{
+    if (nanos <= 0) return o;
+
+    int digits = 9;
+    while (nanos % 10 == 0) { nanos /= 10; digits--; }
+    *o++ = '.';
+    return Put_Padded(o, static_cast<u64>(nanos), digits);
+} // end Put_Fraction
+
+
+/**
+ * @brief appends YYYY-MM-DD for days since the epoch
+ */
+static char* Format_Date(char* o, const s64 days)
+{
+    s64 y;
+    unsigned m, d;
+    Civil_Date(days, y, m, d);
+
+    if (y < 0) { *o++ = '-'; y = -y; }
+    o = Put_Padded(o, static_cast<u64>(y), 4);
+    *o++ = '-';
+    o = Put_Padded(o, m, 2);
+    *o++ = '-';
+    return Put_Padded(o, d, 2);
+} // end Format_Date
+
+
+/**
+ * @brief appends HH:MM:SS and the fraction, if any, for nanoseconds since midnight
+ */
+static char* Format_Time(char* o, const s64 nanos)
+{
+    const u64 secs = static_cast<u64>(nanos / 1'000'000'000);
+    o = Put_Padded(o, secs / 3600, 2);
+    *o++ = ':';
+    o = Put_Padded(o, secs / 60 % 60, 2);
+    *o++ = ':';
+    o = Put_Padded(o, secs % 60, 2);
+    return Put_Fraction(o, nanos % 1'000'000'000);
+} // end Format_Time
+
+
+/**
+ * @brief appends YYYY-MM-DDTHH:MM:SS[.f] for seconds since the epoch
+ */
+static char* Format_Date_Time(char* o, const s64 seconds, const s64 nanos)
+{
+    const s64 days = (seconds >= 0 ? seconds : seconds - 86399) / 86400;
+    o = Format_Date(o, days);
+    *o++ = 'T';
+    return Format_Time(o, (seconds - days * 86400) * 1'000'000'000 + nanos);
+} // end Format_Date_Time
+
+
+/**
+ * @brief appends an offset from UTC; Z for none, +HH:MM[:SS] otherwise
+ */
+static char* Format_Offset(char* o, const s64 offset)
+{
+    if (offset == 0) { *o++ = 'Z'; return o; }
+
+    const u64 a = static_cast<u64>(offset < 0 ? -offset : offset);
+    *o++ = offset < 0 ? '-' : '+';
+    o = Put_Padded(o, a / 3600, 2);
+    *o++ = ':';
+    o = Put_Padded(o, a / 60 % 60, 2);
+    if (a % 60) { *o++ = ':'; o = Put_Padded(o, a % 60, 2); }
+    return o;
+} // end Format_Offset
+
+
+/**
+ * @brief appends an ISO 8601 duration; PnMnDTn[.f]S
+ */
+static char* Format_Duration(char* o, const s64 months, const s64 days, s64 seconds, s64 nanos)
+{
+    *o++ = 'P';
+    o = std::to_chars(o, o + 20, months).ptr;
+    *o++ = 'M';
+    o = std::to_chars(o, o + 20, days).ptr;
+    *o++ = 'D';
+    *o++ = 'T';
+
+    // nanos are always positive on the wire; fold them into a negative second count
+    const bool negative = seconds < 0;
+    if (negative && nanos > 0) { seconds += 1; nanos = 1'000'000'000 - nanos; }
+    if (negative) *o++ = '-';
+
+    o = Put_Padded(o, static_cast<u64>(seconds < 0 ? -seconds : seconds), 1);
+    o = Put_Fraction(o, nanos);
+    *o++ = 'S';
+    return o;
+} // end Format_Duration
+
+
+static bool Value(const u8*& p, const u8* end, Json_Writer& w, int depth);
+
+
+/**
+ * @brief writes the n key/value pairs at p as an object
+ */
+static bool Map_Body(const u8*& p, const u8* end, u32 n, Json_Writer& w, int depth)
+{
+    if (!w.Write('{')) return false;
+    for (u32 i = 0; i < n; i++)
+    {
+        std::string_view key;
+        if (!Unpack::Read_String(p, end, key)) return false;
+        if (i && !w.Write(',')) return false;
+        if (!String(w, key) || !w.Write(':') || !Value(p, end, w, depth)) return false;
+    } // end for
+
+    return w.Write('}');
+} // end Map_Body
+
+
+/**
+ * @brief writes n values at p as an array
+ */
+static bool List_Body(const u8*& p, const u8* end, u32 n, Json_Writer& w, int depth)
+{
+    if (!w.Write('[')) return false;
+    for (u32 i = 0; i < n; i++)
+        if ((i && !w.Write(',')) || !Value(p, end, w, depth)) return false;
+
+    return w.Write(']');
+} // end List_Body
+
+
+/**
+ * @brief writes a node in the documented shape
+ */
+static bool Node(const NodeView& node, Json_Writer& w, int depth)
+{
+    const u8* props = node.props.p;
+    if (!w.Write("{\"id\":") || !Int(w, node.id) || !w.Write(",\"labels\":[")) return false;
+
+    bool first = true;
+    for (std::string_view label : node.labels)
+    {
+        if (!first && !w.Write(',')) return false;
+        if (!String(w, label)) return false;
+        first = false;
+    } // end for labels
+
+    if (!w.Write("],\"properties\":") ||
+        !Map_Body(props, node.props.stop, node.props.count, w, depth))
+        return false;
+    if (!node.element_id.empty() &&
+        (!w.Write(",\"elementId\":") || !String(w, node.element_id)))
+        return false;
+
+    return w.Write('}');
+} // end Node
+
+
+/**
+ * @brief writes a relationship in the documented shape; an unbound one without
+ *  its ends unless given them (as in a path)
+ */
+static bool Rel(const RelView& rel, Json_Writer& w, int depth)
+{
+    const u8* props = rel.props.p;
+    const bool ends = rel.start_id != -1 || rel.end_id != -1;
+
+    if (!w.Write("{\"id\":") || !Int(w, rel.id)) return false;
+    if (ends && (!w.Write(",\"startNodeId\":") || !Int(w, rel.start_id) ||
+        !w.Write(",\"endNodeId\":") || !Int(w, rel.end_id)))
+        return false;
+    if (!w.Write(",\"type\":") || !String(w, rel.type) || !w.Write(",\"properties\":") ||
+        !Map_Body(props, rel.props.stop, rel.props.count, w, depth))
+        return false;
+
+    if (!rel.element_id.empty() && (!w.Write(",\"elementId\":") || !String(w, rel.element_id)))
+        return false;
+    if (!rel.start_element_id.empty() &&
+        (!w.Write(",\"startNodeElementId\":") || !String(w, rel.start_element_id) ||
+        !w.Write(",\"endNodeElementId\":") || !String(w, rel.end_element_id)))
+        return false;
+
+    return w.Write('}');
+} // end Rel
+
+
+/**
+ * @brief writes a path as its nodes and relationships in path order
+ */
+static bool Path(const PathView& path, Json_Writer& w, int depth)
+{
+    NodeView node;
+    RelView rel;
+
+    if (!w.Write("{\"nodes\":[")) return false;
+    for (size_t i = 0; i <= path.Length(); i++)
+        if ((i && !w.Write(',')) || !path.Node(i, node) || !Node(node, w, depth)) return false;
+
+    if (!w.Write("],\"relationships\":[")) return false;
+    for (size_t i = 0; i < path.Length(); i++)
+        if ((i && !w.Write(',')) || !path.Rel(i, rel) || !Rel(rel, w, depth)) return false;
+
+    return w.Write("]}");
+} // end Path
+
+
+/**
+ * @brief writes the temporal struct tag with the given fields as an ISO 8601
+ *  string; false if tag isn't one or the fields don't fit it
+ */
+static bool Temporal(const u8*& p, const u8* end, const u8 tag, const u32 fields, Json_Writer& w)
+{
+    s64 a = 0, b = 0, c = 0, d = 0;
+    std::string_view zone;
+    char text[160];
+    char* o = text;
+
+    switch (tag)
+    {
+    case 0x44:      // Date{days}
+        if (fields != 1 || !Unpack::Read_Int(p, end, a)) return false;
+        o = Format_Date(o, a);
+        break;
+
+    case 0x74:      // LocalTime{nanoseconds}
+        if (fields != 1 || !Unpack::Read_Int(p, end, a)) return false;
+        o = Format_Time(o, a);
+        break;
+
+    case 0x54:      // Time{nanoseconds, tz_offset_seconds}
+        if (fields != 2 || !Unpack::Read_Int(p, end, a) || !Unpack::Read_Int(p, end, b)) return false;
+        o = Format_Offset(Format_Time(o, a), b);
+        break;
+
+    case 0x64:      // LocalDateTime{seconds, nanoseconds}
+        if (fields != 2 || !Unpack::Read_Int(p, end, a) || !Unpack::Read_Int(p, end, b)) return false;
+        o = Format_Date_Time(o, a, b);
+        break;
+
+    case 0x49:      // DateTime{utc seconds, nanoseconds, tz_offset_seconds}
+    case 0x46:      // legacy; seconds already local
+        if (fields != 3 || !Unpack::Read_Int(p, end, a) || !Unpack::Read_Int(p, end, b) ||
+            !Unpack::Read_Int(p, end, c))
+            return false;
+        o = Format_Offset(Format_Date_Time(o, tag == 0x49 ? a + c : a, b), c);
+        break;
+
+    case 0x69:      // DateTimeZoneId{utc seconds, nanoseconds, tz_id}
+    case 0x66:      // legacy; seconds already local
+        if (fields != 3 || !Unpack::Read_Int(p, end, a) || !Unpack::Read_Int(p, end, b) ||
+            !Unpack::Read_String(p, end, zone) || zone.size() > 64)
+            return false;
+        o = Format_Date_Time(o, a, b);
+        if (tag == 0x69) *o++ = 'Z';
+        *o++ = '[';
+        o = std::copy(zone.begin(), zone.end(), o);
+        *o++ = ']';
+        break;
+
+    case 0x45:      // Duration{months, days, seconds, nanoseconds}
+        if (fields != 4 || !Unpack::Read_Int(p, end, a) || !Unpack::Read_Int(p, end, b) ||
+            !Unpack::Read_Int(p, end, c) || !Unpack::Read_Int(p, end, d))
+            return false;
+        o = Format_Duration(o, a, b, c, d);
+        break;
+
+    default:
+        return false;
+    } // end switch
+
+    return String(w, std::string_view(text, o - text));
+} // end Temporal
+
+
+/**
+ * @brief writes the struct whose header was just read
+ */
+static bool Struct(const u8*& p, const u8* end, const u8 tag, const u32 fields, Json_Writer& w, int depth)
+{
+    switch (tag)
+    {
+    case BOLT_NODE:
+    {
+        NodeView node;
+        return NodeView::Read_Fields(p, end, tag, fields, node) && Node(node, w, depth);
+    } // end node
+
+    case BOLT_RELATIONSHIP:
+    case BOLT_UNBOUND_REL:
+    {
+        RelView rel;
+        return RelView::Read_Fields(p, end, tag, fields, rel) && Rel(rel, w, depth);
+    } // end relationship
+
+    case BOLT_PATH:
+    {
+        PathView path;
+        return PathView::Read_Fields(p, end, tag, fields, path) && Path(path, w, depth);
+    } // end path
+
+    case 0x58:      // Point2D{srid, x, y}
+    case 0x59:      // Point3D{srid, x, y, z}
+    {
+        s64 srid;
+        double xyz[3];
+        const u32 dims = tag == 0x58 ? 2 : 3;
+        if (fields != dims + 1 || !Unpack::Read_Int(p, end, srid)) return false;
+        for (u32 i = 0; i < dims; i++)
+            if (!Unpack::Read_Float(p, end, xyz[i])) return false;
+
+        if (!w.Write("{\"srid\":") || !Int(w, srid)) return false;
+        for (u32 i = 0; i < dims; i++)
+        {
+            const char* key[] = { ",\"x\":", ",\"y\":", ",\"z\":" };
+            if (!w.Write(key[i]) || !Float(w, xyz[i])) return false;
+        } // end for
+
+        return w.Write('}');
+    } // end point
+
+    default:
+    {
+        const u8* q = p;
+        if (Temporal(q, end, tag, fields, w)) { p = q; return true; }
+        if (w.no_mem) return false;
+
+        return w.Write("{\"tag\":") && Int(w, tag) && w.Write(",\"fields\":") &&
+            List_Body(p, end, fields, w, depth) && w.Write('}');
+    } // end other
+    } // end switch
+} // end Struct
+
+
+/**
+ * @brief writes the value at p, whatever it is
+ */
+static bool Value(const u8*& p, const u8* end, Json_Writer& w, int depth)
+{
+    if (p >= end || ++depth > JSON_MAX_DEPTH) return false;
+
+    const u8 m = *p;
+    const u8 hi = m & 0xF0;
+    u32 n;
+    s64 i;
+    double d;
+    std::string_view s;
+
+    if (m < 0x80 || m >= 0xF0 || (m >= BOLT_INT8 && m <= BOLT_INT64))
+        return Unpack::Read_Int(p, end, i) && Int(w, i);
+
+    if (hi == BOLT_STRINGTINY || (m >= BOLT_STRING8 && m <= BOLT_STRING32))
+        return Unpack::Read_String(p, end, s) && String(w, s);
+
+    switch (m)
+    {
+    case BOLT_NULL: p++; return w.Write("null");
+    case BOLT_BOOL_TRUE: p++; return w.Write("true");
+    case BOLT_BOOL_FALSE: p++; return w.Write("false");
+    case BOLT_FLOAT64: return Unpack::Read_Float(p, end, d) && Float(w, d);
+    default: break;
+    } // end switch
+
+    if (Unpack::Read_List(p, end, n)) return List_Body(p, end, n, w, depth);
+    if (Unpack::Read_Map(p, end, n)) return Map_Body(p, end, n, w, depth);
+
+    if (hi == BOLT_STRUCT)
+    {
+        u8 tag;
+        return Unpack::Read_Struct(p, end, tag, n) && Struct(p, end, tag, n, w, depth);
+    } // end if struct
+
+    if (m >= BOLT_BYTES8 && m <= BOLT_BYTES32)
+    {
+        const size_t h = size_t(1) << (m - BOLT_BYTES8);
+        if (static_cast<size_t>(end - p) < 1 + h) return false;
+        n = h == 1 ? p[1] : h == 2 ? Unpack::Get_BE<u16>(p + 1) : Unpack::Get_BE<u32>(p + 1);
+        if (static_cast<size_t>(end - p) < 1 + h + n) return false;
+
+        p += 1 + h + n;
+        return Base64(w, p - n, n);
+    } // end if bytes
+
+    return false;       // reserved marker
+} // end Value
+
+
+/**
+ * @brief the status for a failed transcode
+ */
+static LBStatus Json_Fail(const Json_Writer& w)
+{
+    if (w.no_mem)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM);
+
+    return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
+        LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_PROTO);
+} // end Json_Fail
+
+
+LBStatus Json_String(std::string_view s, BoltBuf& out)
+{
+    Json_Writer w(out);
+    return String(w, s) ? LBOK_INFO(0) : Json_Fail(w);
+} // end Json_String
+
+
+LBStatus Json_Value(const u8*& p, const u8* end, BoltBuf& out)
+{
+    Json_Writer w(out);
+    const u8* q = p;
+    if (!Value(q, end, w, 0)) return Json_Fail(w);
+
+    p = q;
+    return LBOK_INFO(0);
+} // end Json_Value
+
+
+LBStatus Json_Record(const u8*& p, const u8* end, const std::vector<std::string>* keys, BoltBuf& out)
+{
+    Json_Writer w(out);
+    const u8* q = p;
+    u32 n;
+    if (!Unpack::Read_List(q, end, n)) return Json_Fail(w);
+
+    bool ok;
+    if (keys && keys->size() == n)
+    {
+        ok = w.Write('{');
+        for (u32 i = 0; ok && i < n; i++)
+            ok = (!i || w.Write(',')) && w.Write((*keys)[i]) && Value(q, end, w, 0);
+        ok = ok && w.Write('}');
+    } // end if object
+    else ok = List_Body(q, end, n, w, 0);
+
+    if (!ok) return Json_Fail(w);
+
+    p = q;
+    return LBOK_INFO(0);
+} // end Json_Record
+
+
+void Json_Keys(const std::vector<std::string_view>& names, std::vector<std::string>& keys)
+{
+    keys.clear();
+    keys.reserve(names.size());
+
+    std::string scratch(6 * 64 + 3, '\0');
+    for (std::string_view name : names)
+    {
+        if (scratch.size() < 6 * name.size() + 3) scratch.resize(6 * name.size() + 3);
+        u8* start = reinterpret_cast<u8*>(scratch.data());
+        u8* stop = Escape_Into(start, reinterpret_cast<const u8*>(name.data()), name.size());
+        *stop++ = ':';
+        keys.emplace_back(scratch.data(), stop - start);
+    } // end for
+} // end Json_Keys
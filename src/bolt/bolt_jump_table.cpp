@@ -3,7 +3,7 @@
  * 
  * @version 1.0
  * @date created 14th of April 2025, Monday.
- * @date updated 2nd of Feburary 2026, Monday.
+ * @date updated 16th of October 2026, Friday.
  */
 
 
@@ -153,9 +153,8 @@ template <typename T>
 static inline bool Decode_Bytes(u8*& pos, BoltValue& out)
 {
     T len; 
-    if constexpr (sizeof(T) == 1) 
-        len = static_cast<T>(*++pos);
-    else if constexpr (sizeof(T) == 2)
+    iCpy(&len, ++pos, sizeof(T));
+    if constexpr (sizeof(T) == 2)
         len = ntohs(len);
     else if constexpr (sizeof(T) == 4) //(marker == 0xCE)
         len = ntohl(len);
@@ -262,7 +261,7 @@ static inline bool Decode_List(u8*& pos, BoltValue& out)
     iCpy(&size, pos, sizeof(T));
     if constexpr (sizeof(T) > 1)
     {
-        if constexpr (is_big_endian)
+        if constexpr (!is_big_endian)
             size = byte_swap(size);
     } // end if
 
@@ -328,7 +327,7 @@ static inline bool Decode_Map(u8*& pos, BoltValue& out)
     iCpy(&len, ++pos, sizeof(T));
     if constexpr (sizeof(T) > 1)
     {
-        if constexpr (is_big_endian)
+        if constexpr (!is_big_endian)
             len = byte_swap(len);
     } // end if
 
@@ -336,7 +335,7 @@ static inline bool Decode_Map(u8*& pos, BoltValue& out)
     out = BoltValue::Make_Map(pos - out.buf->Data(), len, out.buf);
 
     BoltValue dummy;
-    for (u8 i = 0; i < len; i++)
+    for (T i = 0; i < len; i++)
     {
 		dummy.buf = out.buf;
         if (!jump_table[*pos](pos, dummy))  // key
@@ -0,0 +1,470 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 17th of October 2026, Saturday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "connection/neoconnection.h"
+#include "connection/bolt_standin.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr u32 BOLT_MAGIC = 0x6060B017;
+constexpr u32 BOLT_MANIFEST_V1 = 0x000001FF;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief encodes msg and appends its bytes to out
+ */
+static void Append_Message(std::vector<u8>& out, BoltMessage msg)
+{
+    BoltBuf buf(1 << 12);
+    BoltEncoder(buf).Encode(msg);
+    out.insert(out.end(), buf.Data(), buf.Data() + buf.Size());
+} // end Append_Message
+
+
+/**
+ * @brief the n a PULL's payload asks for; -1, all, when it doesn't say
+ */
+static s64 Pull_N(const u8* p, const u8* end)
+{
+    u8 tag;
+    u32 fields, entries;
+    if (!Unpack::Read_Struct(p, end, tag, fields) || !fields || !Unpack::Read_Map(p, end, entries))
+        return -1;
+
+    while (entries--)
+    {
+        std::string_view key;
+        s64 n;
+        if (!Unpack::Read_String(p, end, key)) return -1;
+        if (key == "n" && Unpack::Read_Int(p, end, n)) return n;
+        if (!(p = Unpack::Skip(p, end))) return -1;
+    } // end while
+
+    return -1;
+} // end Pull_N
+
+
+/**
+ * @brief true if a RUN's payload carries a query starting with FAIL
+ */
+static bool Run_Fails(const u8* p, const u8* end)
+{
+    u8 tag;
+    u32 fields;
+    std::string_view query;
+    return Unpack::Read_Struct(p, end, tag, fields) && fields &&
+        Unpack::Read_String(p, end, query) && query.starts_with("FAIL");
+} // end Run_Fails
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief destructor; stops if running
+ */
+BoltStandin::~BoltStandin()
+{
+    Stop();
+} // end destructor
+
+
+/**
+ * @brief listens on 127.0.0.1 and starts accepting; one already running is
+ *  stopped first.
+ *
+ * @param new_spec how to answer
+ *
+ * @return LB_OK on success, alas LB_FAIL with the errno of listening
+ */
+LBStatus BoltStandin::Start(const StandinSpec& new_spec)
+{
+    Stop();
+    spec = new_spec;
+    Encode_Responses();
+
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (wake_fd < 0 || listen_fd < 0)
+    {
+        LBStatus rc = LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+        Stop();
+        return rc;
+    } // end if no sockets
+
+    int yes = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(spec.port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    socklen_t len = sizeof(addr);
+    if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 64) < 0 ||
+        getsockname(listen_fd, (sockaddr*)&addr, &len) < 0)
+    {
+        LBStatus rc = LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+        Stop();
+        return rc;
+    } // end if can't listen
+
+    bound_port = ntohs(addr.sin_port);
+    accept_thread = std::thread(&BoltStandin::Accept_Loop, this);
+    return LB_Make();
+} // end Start
+
+
+/**
+ * @brief wakes every thread, joins them and closes the listener; connections
+ *  still open are hung up on
+ */
+void BoltStandin::Stop()
+{
+    if (wake_fd >= 0)
+    {
+        u64 one = 1;
+        write(wake_fd, &one, sizeof(one));  // stays readable; every poll sees it
+    } // end if wake
+
+    if (accept_thread.joinable())
+        accept_thread.join();
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (auto& t : sessions)
+            if (t.joinable()) t.join();
+        sessions.clear();
+    } // end lock
+
+    if (listen_fd >= 0) CLOSE(listen_fd);
+    if (wake_fd >= 0) CLOSE(wake_fd);
+    listen_fd = wake_fd = -1;
+    bound_port = 0;
+} // end Stop
+
+
+/**
+ * @brief the port listened on; the one picked when asked for 0
+ */
+u16 BoltStandin::Port() const
+{
+    return bound_port;
+} // end Port
+
+
+/**
+ * @brief the url a driver connects to it with
+ */
+std::string BoltStandin::Url() const
+{
+    return "bolt://127.0.0.1:" + std::to_string(bound_port);
+} // end Url
+
+
+/**
+ * @brief holds back every response for d from now; requests keep being read
+ */
+void BoltStandin::Stall(const std::chrono::nanoseconds d)
+{
+    stall_until.store(StageStamps::Now() + d.count(), std::memory_order_relaxed);
+} // end Stall
+
+
+/**
+ * @brief RUNs answered so far
+ */
+u64 BoltStandin::Queries() const
+{
+    return queries.load(std::memory_order_relaxed);
+} // end Queries
+
+
+/**
+ * @brief encodes the responses sent over and over
+ */
+void BoltStandin::Encode_Responses()
+{
+    success.clear();
+    hello.clear();
+    run.clear();
+    records.clear();
+    record_at.clear();
+    more.clear();
+    failure.clear();
+
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Append_Message(success, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue::Make_Map() })));
+    Append_Message(hello, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("server", BoltValue("Neo4j/5.26.0")), mp("connection_id", BoltValue("bolt-standin")) }) })));
+    Append_Message(run, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("t_first", BoltValue::Make_Int(0)), mp("fields", BoltValue({ "n", "name" })) }) })));
+
+    for (u32 r = 1; r <= spec.rows; r++)
+    {
+        record_at.push_back(records.size());
+        BoltValue row = BoltValue::Make_List();
+        row.Insert_List(BoltValue::Make_Int(r));
+        row.Insert_List(BoltValue("standin"));
+        Append_Message(records, BoltMessage(BoltValue(BOLT_RECORD, { row })));
+    } // end for rows
+
+    record_at.push_back(records.size());
+    Append_Message(records, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("type", BoltValue("r")), mp("t_last", BoltValue::Make_Int(0)), mp("db", BoltValue("neo4j")) }) })));
+    Append_Message(more, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("has_more", BoltValue(true)) }) })));
+    Append_Message(failure, BoltMessage(BoltValue(BOLT_FAILURE, { BoltValue({
+        mp("code", BoltValue("Neo.ClientError.Statement.ArithmeticError")),
+        mp("message", BoltValue("/ by zero")) }) })));
+    Release_Pool<BoltValue>(offset);
+} // end Encode_Responses
+
+
+/**
+ * @brief accepts connections until woken by Stop(), each served on a thread
+ *  of its own
+ */
+void BoltStandin::Accept_Loop()
+{
+    pollfd fds[2] = { { listen_fd, POLLIN, 0 }, { wake_fd, POLLIN, 0 } };
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            return;
+        } // end if poll error
+
+        if (fds[1].revents) return;     // stopping
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        int fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) continue;
+
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        std::lock_guard<std::mutex> guard(lock);
+        sessions.emplace_back(&BoltStandin::Serve, this, fd);
+    } // end while
+} // end Accept_Loop
+
+
+/**
+ * @brief one connection; its requests are answered in the order they come, a
+ *  recv's worth at a time, until the client hangs up, says GOODBYE or Stop()
+ *  is called
+ *
+ * @param fd the accepted connection; closed on return
+ */
+void BoltStandin::Serve(const int fd)
+{
+    if (!Handshake(fd))
+    {
+        CLOSE(fd);
+        return;
+    } // end if no handshake
+
+    u8 buf[16384];
+    std::vector<u8> pending;    // requests not yet whole
+    std::vector<u8> out;        // answers to those that are
+    pollfd fds[2] = { { fd, POLLIN, 0 }, { wake_fd, POLLIN, 0 } };
+    bool bye = false;
+    u32 streamed = 0;           // records of the last RUN's result sent so far
+    bool failing = false;       // the last RUN's query starts with FAIL
+
+    while (!bye)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            break;
+        } // end if poll error
+        if (fds[1].revents) break;
+
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        pending.insert(pending.end(), buf, buf + n);
+
+        // walk whole messages; [size][chunk]... 00 00, the tag second in the first chunk
+        size_t at = 0, pos = 0, first = 0;   // first: the message's first chunk
+        int tag = -1;
+        while (pos + 2 <= pending.size())
+        {
+            u16 size = ntohs(*(u16*)(pending.data() + pos));
+            if (size == 0)
+            {
+                pos += 2;
+                at = pos;
+                switch (tag)
+                {
+                case -1: break;     // a NOOP
+                case BOLT_HELLO: out.insert(out.end(), hello.begin(), hello.end()); break;
+                case BOLT_RUN:
+                    if (spec.service.count()) std::this_thread::sleep_for(spec.service);
+                    out.insert(out.end(), run.begin(), run.end());
+                    queries.fetch_add(1, std::memory_order_relaxed);
+                    streamed = 0;
+                    failing = Run_Fails(pending.data() + first + 2,
+                        pending.data() + first + 2 + ntohs(*(u16*)(pending.data() + first)));
+                    break;
+                case BOLT_PULL:
+                    Answer_Pull(out, streamed, Pull_N(pending.data() + first + 2,
+                        pending.data() + first + 2 + ntohs(*(u16*)(pending.data() + first))), failing);
+                    break;
+                case BOLT_GOODBYE: bye = true; break;
+                default: out.insert(out.end(), success.begin(), success.end()); break;
+                } // end switch
+
+                tag = -1;
+                continue;
+            } // end if end of message
+
+            if (pos + 2 + size > pending.size()) break;
+            if (tag < 0 && size >= 2)
+            {
+                tag = pending[pos + 3];
+                first = pos;
+            } // end if first chunk
+            pos += 2 + size;
+        } // end while messages
+        pending.erase(pending.begin(), pending.begin() + at);
+
+        if (out.empty()) continue;
+        for (s64 now = StageStamps::Now(), until = stall_until.load(std::memory_order_relaxed);
+            now < until; now = StageStamps::Now())
+            std::this_thread::sleep_for(std::chrono::nanoseconds(std::min<s64>(until - now, 1'000'000)));
+
+        if (!Write_All(fd, out.data(), out.size())) break;
+        out.clear();
+    } // end while
+
+    CLOSE(fd);
+} // end Serve
+
+
+/**
+ * @brief answers a PULL with the next n records of the result, SUCCESS with
+ *  has_more after them unless they were the last; a failing query's result ends
+ *  in a FAILURE half way through
+ *
+ * @param out the answers
+ * @param streamed records of the result sent before; moved past these
+ * @param n records asked for, -1 for the rest
+ * @param failing the query fails half way through
+ */
+void BoltStandin::Answer_Pull(std::vector<u8>& out, u32& streamed, const s64 n, const bool failing)
+{
+    const u32 stop = failing ? spec.rows / 2 : spec.rows;
+    const u32 upto = n < 0 ? stop : u32(std::min<s64>(stop, streamed + n));
+    out.insert(out.end(), records.begin() + record_at[streamed], records.begin() + record_at[upto]);
+    streamed = upto;
+
+    if (upto < stop)
+        out.insert(out.end(), more.begin(), more.end());
+    else if (failing)
+        out.insert(out.end(), failure.begin(), failure.end());
+    else
+        out.insert(out.end(), records.begin() + record_at[spec.rows], records.end());
+} // end Answer_Pull
+
+
+/**
+ * @brief agrees to spec's version; through the v1 manifest when the client
+ *  offers one, as the driver does, alas picked off the plain proposals
+ *
+ * @return false on a client that's not Bolt or gone
+ */
+bool BoltStandin::Handshake(const int fd)
+{
+    u8 hs[20];
+    if (!Read_Full(fd, hs, sizeof(hs)) || ntohl(*(u32*)hs) != BOLT_MAGIC)
+        return false;
+
+    bool manifest = false;
+    for (int i = 1; i < 5; i++)
+        manifest |= ntohl(*(u32*)(hs + i * 4)) == BOLT_MANIFEST_V1;
+
+    if (manifest)
+    {
+        // the manifest, one version and no capabilities; the client echoes
+        //  the version it picked and its capabilities back
+        u8 reply[10] = { 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, spec.minor, spec.major, 0x00 };
+        u8 picked[5];
+        return Write_All(fd, reply, sizeof(reply)) && Read_Full(fd, picked, sizeof(picked));
+    } // end if manifest
+
+    u8 reply[4] = { 0x00, 0x00, spec.minor, spec.major };
+    return Write_All(fd, reply, sizeof(reply));
+} // end Handshake
+
+
+/**
+ * @brief reads exactly len bytes, unless woken by Stop()
+ */
+bool BoltStandin::Read_Full(const int fd, u8* buf, const size_t len)
+{
+    pollfd fds[2] = { { fd, POLLIN, 0 }, { wake_fd, POLLIN, 0 } };
+    size_t got = 0;
+    while (got < len)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        } // end if poll error
+        if (fds[1].revents) return false;
+
+        ssize_t n = recv(fd, buf + got, len - got, 0);
+        if (n <= 0) return false;
+        got += size_t(n);
+    } // end while
+
+    return true;
+} // end Read_Full
+
+
+/**
+ * @brief sends all of data
+ */
+bool BoltStandin::Write_All(const int fd, const u8* data, const size_t len)
+{
+    size_t sent = 0;
+    while (sent < len)
+    {
+        ssize_t n = send(fd, data + sent, len - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        sent += size_t(n);
+    } // end while
+
+    return true;
+} // end Write_All
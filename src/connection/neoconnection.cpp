@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 9th of April 2025, Wednesday.
- * @date updated 4th of March 2026, Wednesday.
+ * @date updated 17th of October 2026, Saturday.
  */
 
 
@@ -11,6 +11,31 @@
  //          INCLUDES
  //===============================================================================|
 #include "connection/neoconnection.h"
+#include "neoexecutor.h"
+#include "utils/probes.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr u64 WRITE_PARKING = ~0ull;    // write_owner while Park_Write() is at it
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief the calling thread's mark in write_owner; never 0 nor WRITE_PARKING
+ */
+static u64 This_Thread()
+{
+    static thread_local const u8 mark = 0;
+    return reinterpret_cast<u64>(&mark);
+} // end This_Thread
 
 
 
@@ -20,14 +45,22 @@
 //===============================================================================|
 /**
  * @brief constructor
+ *
+ * @param urls the connection string
+ * @param pauth authentication token
+ * @param pextras extra connection parameters
+ * @param pslab optional shared slab to borrow read/write buffer storage from
  */
-NeoConnection::NeoConnection(const std::string& urls, BoltValue* pauth, BoltValue* pextras)
-    : encoder(write_buf), decoder(read_buf), pauth(pauth), pextras(pextras), is_done(false)
+NeoConnection::NeoConnection(const std::string& urls, BoltValue* pauth, BoltValue* pextras,
+    BufferSlab* pslab)
+    : read_buf(8192, pslab), write_buf(8192, pslab),
+    encoder(write_buf), decoder(read_buf), pauth(pauth), pextras(pextras), pslab(pslab)
 {
     // defaults
     client_id = -1;
     tran_count = 0;
     current_msg_len = 0;
+    stream_base = 0;
     unconsumed_count = 0;
 
     is_open = false;
@@ -73,6 +106,13 @@ LBStatus NeoConnection::Negotiate_Version()
 {
     LBStatus rc;    // return status codes
     tasks.Clear();  // make certain no false moves here
+    done.Reset();   // nor completions of the last connection
+    {
+        std::lock_guard<std::mutex> guard(batch_lock);
+        batch_cb = nullptr; // nor a batched query cut short
+        more_due.store(false, std::memory_order_relaxed);
+        batching.store(false, std::memory_order_release);
+    }
 
     int buf_len = 128;
     u8 versions[128]{
@@ -167,6 +207,7 @@ LBStatus NeoConnection::Send_Hellov5(TaskState& state)
 
     // memorize pool position
     size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    std::string uagent{ "LB/v" + std::to_string(client_id + 1) + ".0" };   // outlives the encode
 
     // extract out any extra parameters from conn_params, supplied from the
     //  user during connection string
@@ -180,7 +221,7 @@ LBStatus NeoConnection::Send_Hellov5(TaskState& state)
     std::vector<Param_Helper> param_list{
         {USER_AGENT_STRING, (pextras && pextras[0][USER_AGENT_STRING].type != BoltType::Unk) ?
             pextras[0][USER_AGENT_STRING] :
-            BoltValue(("LB/v" + std::to_string(client_id + 1) + ".0").c_str()), 1.0, 100},
+            BoltValue(uagent.c_str()), 1.0, 100},
 
         {PATCH_BOLT_STRING, (pextras ? pextras[0][PATCH_BOLT_STRING] : BoltValue::Make_Unknown()), 4.3, 4.4},
         {ROUTES_STRING, (pextras ? pextras[0][ROUTES_STRING] : BoltValue::Make_Unknown()), 4.1, 100},
@@ -213,6 +254,7 @@ LBStatus NeoConnection::Send_Hellov5(TaskState& state)
     } // end sversion
 
     hello.msg.Insert_Struct(bmp);
+    WriteClaim claim(*this);
     rc = encoder.Encode(hello);
     if (!LB_OK(rc))
     {
@@ -262,6 +304,7 @@ LBStatus NeoConnection::Send_Hellov4(TaskState& state)
         map
         }));
 
+    WriteClaim claim(*this);
     LBStatus rc = encoder.Encode(hello);
     if (!LB_OK(rc))
     {
@@ -320,6 +363,8 @@ LBStatus NeoConnection::Logon(TaskState& state)
  * @param extras optional extra parameters for the cypher query (see bolt specs)
  * @param n optional the numbe r of chunks to request, i.e. 1000 records
  * @param cb optional callback for async results
+ * @param visitor optional; records are streamed to it as they arrive and the
+ *  result carries only the count, fields and summary
  *
  * @return 0 on success and -2 on application error
  */
@@ -327,8 +372,22 @@ LBStatus NeoConnection::Run(const char* cypher,
     const BoltValue& params, 
     const BoltValue& extras,
     const int n,
-    std::function<void(BoltResult&)> cb)
+    ResultCallback cb,
+    BoltVisitor* visitor)
 {
+    // a batched query owns the cell till its last batch; nothing else may be
+    //  answered behind its pending PULLs, nor another batched query start
+    const bool batched = n > 0 && cb && !visitor;
+    if (batched ? batching.exchange(true, std::memory_order_acq_rel) : batching.load(std::memory_order_acquire))
+    {
+        return LB_Make(
+            LBAction::LB_FAIL,
+            LBDomain::LB_DOM_STATE,
+            LBStage::LB_STAGE_QUERY,
+            LBCode::LB_CODE_TASKSTATE
+        );
+    } // end if cell taken
+
     // protect pool
     size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
 
@@ -341,8 +400,41 @@ LBStatus NeoConnection::Run(const char* cypher,
             })
         );
 
-    if (!tasks.Enqueue({ TaskState::Run, cb }))
+    // a batched query's callback gets every batch; kept aside, the task relays
+    ResultCallback user_cb;
+    if (batched)
     {
+        user_cb = std::move(cb);
+        cb = [this](BoltResult& r) { Hand_Batch(r, true); };
+    } // end if batched
+
+    // the task is queued only once its RUN is in; a query refused here leaves
+    //  no task behind to take someone else's response, nor a callback to fire
+    DecoderTask task(TaskState::Run, std::move(cb), visitor);
+    task.pull_n = n;
+    WriteClaim claim(*this);
+    size_t before = write_buf.Size();
+    LBStatus rc = encoder.Encode(run);
+    if (!LB_OK(rc))
+    {
+        rc = Retry_Encode(run);     // on the emptied buffer
+        before = 0;
+        if (!LB_OK(rc))
+        {
+            if (batched) batching.store(false, std::memory_order_release);
+            Release_Pool<BoltValue>(offset);
+            return rc;
+        } // end if still bad
+    } // end if wasn't good
+
+    if (sampler.Enabled())
+        task.sample = sampler.Note(cypher, strlen(cypher), u32(params.map_val.size), tasks.Size());
+    const u32 sample = task.sample;
+    if (!tasks.Enqueue(std::move(task)))
+    {
+        // drop the unsent RUN, keeping whatever was pending ahead of it
+        write_buf.Skip(-static_cast<ptrdiff_t>(write_buf.Size() - before));
+        if (batched) batching.store(false, std::memory_order_release);
         Release_Pool<BoltValue>(offset);
         return LB_Make(
             LBAction::LB_FAIL,
@@ -352,19 +444,20 @@ LBStatus NeoConnection::Run(const char* cypher,
         );
     } // end if enqueue error
 
-    LBStatus rc = encoder.Encode(run);
-    if (!LB_OK(rc))
+    if (batched)
     {
-        rc = Retry_Encode(run);
-        if (!LB_OK(rc))
-        {
-            Release_Pool<BoltValue>(offset);
-            return rc;
-        } // end if still bad
-    } // end if wasn't good
+        std::lock_guard<std::mutex> guard(batch_lock);
+        batch_cb = std::move(user_cb);  // nothing answers before the flush below
+    } // end if batched
+    submit_counters.queries.Add();
+    submit_counters.tasks_high.Max(tasks.Size());
+
     Encode_Pull(n);
+    Stamp_Last(QueryStage::Encoded);
+    if (sample) Note_Request(sample, before);
 
     rc = Flush();
+    Stamp_Last(QueryStage::Flushed);
     Release_Pool<BoltValue>(offset);
     return rc;
 } // end Run_Query
@@ -706,6 +799,10 @@ void NeoConnection::Terminate()
     is_open = false;
     read_buf.Reset();
     write_buf.Reset();
+
+    // hand storage back to the slab, if any
+    read_buf.Park();
+    Park_Write();
 } // end Terminate
 
 
@@ -745,7 +842,12 @@ void NeoConnection::Set_Host_Address(const std::string& host, const std::string&
 LBStatus NeoConnection::Poll_Writable()
 {
     LBStatus rc = Send(write_buf.Read_Ptr(), write_buf.Size());
-    if (LB_OK(rc)) write_buf.Consume(LB_Aux(rc));
+    if (LB_OK(rc))
+    {
+        capture.Append(WireDir::Out, write_buf.Read_Ptr(), LB_Aux(rc));
+        write_buf.Consume(LB_Aux(rc));
+        submit_counters.bytes_out.Add(LB_Aux(rc));
+    } // end if sent
 
     return rc;
 } // end Poll_Writable
@@ -769,6 +871,17 @@ LBStatus NeoConnection::Poll_Readable()
 {
     LBStatus rc = 0;        // store's return value
 
+    // borrow storage back if parked while idle; the slab may refuse on its cap
+    if (!read_buf.Unpark())
+    {
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM);
+    } // end if no storage
+
+    // a streamed task is done with everything it consumed; receive over it
+    if (Is_Streaming())
+        read_buf.Rewind(stream_base);
+
     // have we run out of space?
     if (read_buf.Writable_Size() == 0)
     {
@@ -784,6 +897,7 @@ LBStatus NeoConnection::Poll_Readable()
                         LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM);
                 } // end if
 
+                if (!recv_paused) decode_counters.recv_pauses.Add();
                 recv_paused = true;
             } // end if no compaction
             else
@@ -801,7 +915,11 @@ LBStatus NeoConnection::Poll_Readable()
             return rc; // fail, retry or wait
 
         int bytes = LB_Aux(rc);
+        capture.Append(WireDir::In, read_buf.Write_Ptr(), bytes);
         read_buf.Advance(bytes);
+        LB_PROBE3(recv, client_id, bytes, read_buf.Size());
+        if (bytes) last_recv_ns = StageStamps::Now();
+        decode_counters.bytes_in.Add(bytes);
         return LBOK_INFO(bytes);
     } // end if can recv
     else 
@@ -849,44 +967,89 @@ LBStatus NeoConnection::Decode_One(DecoderTask& task)
 /**
  * @brief determines if a compelete bolt packet has been receved. The requirement
  *  of more data is left to the calling routine. The method only checks for
- *  a complete bolt packet;
- *  i.e. header_size + 2 + 2 (should trailing 0 exist) <= bytes_remain
+ *  a complete bolt packet, which may span several chunks;
+ *  i.e. (2 + chunk_size) for every chunk + 2 for the trailing 0 <= bytes_remain
  *
  * @return a true if a complete bolt packet is recieved
  */
 LBStatus NeoConnection::Can_Decode(u8* view, const u32 bytes_remain)
 {
-    u16 temp;  // vars
+    BoltFrame frame;    // vars
 
     if (bytes_remain <= 4)
         return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT);  
 
-    // get the message size from the header
-    memcpy(&temp, view, sizeof(u16));
-    current_msg_len = ntohs(temp) + 2;      // message size + header size
+    // walk the chunks upto the empty one ending the message
+    LBStatus rc = BoltDecoder::Frame(view, bytes_remain, frame);
+    if (!LB_OK(rc))
+        return rc;
 
-    // padding?
-    if ((current_msg_len + 2) <= bytes_remain)
-    {
-        if (reinterpret_cast<u16*>(view + current_msg_len)[0] == 0)
-            current_msg_len += 2;
-    } // end if enough bytes for padding too
-    else
-        return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT);
+    current_msg_len = frame.wire_size;     // all chunks + headers + 00 00
 
     // sweet, now make sure this is a proper bolt packet by
-    //  checking the signature byte, if not then it's a protocol error
-    if ((0xB0 & view[2]) != 0xB0)
+    //  checking the signature byte, if not then it's a protocol error;
+    //  the first chunk must hold at least the signature and the tag
+    if (ntohs(*(u16*)view) < 2 || (0xB0 & view[2]) != 0xB0)
     {
         return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT,
             LBStage::LB_STAGE_DECODEING_TASK, LBCode::LB_CODE_PROTO);
     } // end if not valid
 
     // we can decode it
+    LB_PROBE3(frame, client_id, current_msg_len, bytes_remain);
     return LBOK_INFO(current_msg_len);
 } // end Can_Decode
 
 
+/**
+ * @brief feeds the records of a task with a visitor to the stream decoder, whole
+ *  or not. On the first call, right past RUN's success, it marks where they start
+ *  in read_buf; Poll_Readable() keeps receiving over that same stretch for as
+ *  long as the task streams, so a record of any size needs no more buffer than
+ *  a recv brings in.
+ *
+ * @param task the task at the front of the queue
+ * @param view where the undecoded bytes start
+ * @param bytes_remain number of bytes in view
+ *
+ * @return LB_HASMORE with the bytes consumed when everything was fed, LB_OK_INFO
+ *  with the bytes consumed when a message other than RECORD is next (summary or
+ *  failure; for Decode_One), LB_FAIL on protocol errors.
+ */
+LBStatus NeoConnection::Decode_Stream(DecoderTask& task, u8* view, const u32 bytes_remain)
+{
+    if (task.state == TaskState::Pull)
+    {
+        stream.Reset(task.visitor);
+        stream_base = view - read_buf.Data();
+        task.state = TaskState::Record;     // summaries go to Success_Record
+    } // end if first bytes
+
+    u64 before = stream.Records();
+    LBStatus rc = stream.Feed(view, bytes_remain);
+    if (stream.Records() > before && !task.stamps[QueryStage::First_Record])
+        task.stamps.Stamp(QueryStage::First_Record);
+
+    auto result = In_Flight();
+    if (result.has_value())
+        result->get().message_count += stream.Records() - before;
+
+    return rc;
+} // end Decode_Stream
+
+
+/**
+ * @brief true if the front task is in the middle of streaming records to its
+ *  visitor; i.e. read_buf may be rewound to stream_base
+ */
+bool NeoConnection::Is_Streaming()
+{
+    auto task = tasks.Front();
+    return task.has_value() && task->get().visitor &&
+        task->get().state == TaskState::Record;
+} // end Is_Streaming
+
+
 /**
  * @brief return's the client id for this driver
  */
@@ -899,13 +1062,15 @@ int NeoConnection::Get_Client_ID() const
 /**
  * @brief makes sure all the contents of the write buffer has been written to the
  *  sending buffer and kernel is probably sending it. The function also resets
- *  the send buffer once data is fully uploaded.
+ *  the send buffer once data is fully uploaded and lets go of it, so an idle
+ *  tick may park it (see Park_Write()).
  *
  * @return LBStatus with LB_OK being a succesful call.
  */
 LBStatus NeoConnection::Flush()
 {
-    LBStatus rc;
+    LBStatus rc = 0;
+    LB_PROBE2(flush_start, client_id, write_buf.Size());
     while (!write_buf.Empty())
     {
         rc = Poll_Writable();
@@ -916,35 +1081,62 @@ LBStatus NeoConnection::Flush()
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
     } // end while
 
+    LB_PROBE3(flush_end, client_id, write_buf.Size(), rc);
     write_buf.Reset();
+    write_owner.store(0, std::memory_order_release);
     return rc;
 } // end Flush
 
 
 /**
- * @brief determines if the record streaming is done based on the presence of
- *  "has_more" key in the summary message map.
- *
- * @param cursor pointer to the current position in the buffer
- * @param v reference to boltvalue to decode into
- *
- * @return true if record streaming is done else false
+ * @brief claims write_buf for the calling thread ahead of encoding into it,
+ *  waiting out another thread's claim or a park in progress; held till the next
+ *  Flush() or Release_Write(). A claim the thread holds already is kept, i.e. a
+ *  PULL encoded behind its RUN. Submitters and the decoding thread, answering
+ *  with a LOGON or RESET, claim alike.
  */
-bool NeoConnection::Is_Record_Done(BoltMessage& summary)
+void NeoConnection::Claim_Write()
 {
-    if (summary.msg(0).type == BoltType::Map &&
-        summary.msg(0)["has_more"].type != BoltType::Unk &&
-        summary.msg(0)["has_more"].bool_val == true)
-    {
-        //t.state = TaskState::Streaming;    // still streaming
-        return false;   // not done
-    } // end if
-    else
+    const u64 me = This_Thread();
+    if (write_owner.load(std::memory_order_relaxed) == me)
+        return;
+
+    u64 free = 0;
+    while (!write_owner.compare_exchange_weak(free, me, std::memory_order_acquire))
     {
-        //t.state = TaskState::Done;
-        return true;
-    } // end else done
-} // end Is_Record_Done
+        free = 0;
+        std::this_thread::yield();
+    } // end while claimed elsewhere
+} // end Claim_Write
+
+
+/**
+ * @brief lets go of a claim the calling thread holds; a no-op otherwise, i.e.
+ *  once a Flush() let go of it already
+ */
+void NeoConnection::Release_Write()
+{
+    u64 me = This_Thread();
+    write_owner.compare_exchange_strong(me, 0, std::memory_order_release, std::memory_order_relaxed);
+} // end Release_Write
+
+
+/**
+ * @brief hands write_buf's storage back to the slab unless a submitter is at it;
+ *  from the idle tick, on whichever thread runs it.
+ *
+ * @return true if parked
+ */
+bool NeoConnection::Park_Write()
+{
+    u64 free = 0;
+    if (!write_owner.compare_exchange_strong(free, WRITE_PARKING, std::memory_order_acquire))
+        return false;
+
+    const bool parked = write_buf.Park();
+    write_owner.store(0, std::memory_order_release);
+    return parked;
+} // end Park_Write
 
 
 /**
@@ -958,26 +1150,39 @@ bool NeoConnection::Is_Record_Done(BoltMessage& summary)
  */
 LBStatus NeoConnection::Encode_And_Flush(TaskState s, BoltMessage& msg)
 {
-    tasks.Enqueue({ s });
+    WriteClaim claim(*this);
+    size_t before = write_buf.Size();
     LBStatus rc = encoder.Encode(msg);
     if (!LB_OK(rc))
     {
-        rc = Retry_Encode(msg);
+        rc = Retry_Encode(msg);     // on the emptied buffer
+        before = 0;
         if (!LB_OK(rc))
             return rc;
 	} // end if wasn't good
 
+    // queued once encoded, so a request that never went leaves no task behind
+    if (!tasks.Enqueue({ s }))
+    {
+        write_buf.Skip(-static_cast<ptrdiff_t>(write_buf.Size() - before));
+        return LB_Make(
+            LBAction::LB_FAIL,
+            LBDomain::LB_DOM_STATE,
+            LBStage::LB_STAGE_QUERY,
+            LBCode::LB_CODE_STATE_QUEUE_MEM
+        );
+    } // end if enqueue error
+
 	rc = Flush();
     return rc;
 } // end Encode_And_Flush
 
 
 /**
- * @brief a dummy function
+ * @brief a dummy function; nothing to hand over, so nothing is posted either
  */
 inline LBStatus NeoConnection::Success_None(DecoderTask& task)
 {
-    Wake();
     tasks.Dequeue();
     return LBOK_INFO(task.view.size);
 } // end if None
@@ -1006,9 +1211,8 @@ inline LBStatus NeoConnection::Success_Hello(DecoderTask& task)
     BoltResult r;
     r.done = true;  // not gonna care about meta
     results.Enqueue(std::move(r));
-    latencies.Record_Latency(
-        std::chrono::high_resolution_clock::now() - task.start_clock
-    );
+    latencies.Record_Latency(std::chrono::nanoseconds(
+        StageStamps::Now() - task.stamps[QueryStage::Submit]));
     tasks.Dequeue();
     Wake();         // unhalt the waiting process
 
@@ -1029,6 +1233,7 @@ inline LBStatus NeoConnection::Success_Run(DecoderTask& task)
 {
     BoltResult result;
     task.state = TaskState::Pull;
+    task.stamps.Stamp(QueryStage::Run_Success);
 
     // parse and save the field names; until its needed and guranteed to exist
     //  as long as we are streaming the result. 
@@ -1039,7 +1244,21 @@ inline LBStatus NeoConnection::Success_Run(DecoderTask& task)
 
     result.pdec = &decoder;
 	result.start_offset = (task.view.cursor + LB_Aux(rc)) - read_buf.Data();
+    LB_PROBE2(run_success, client_id, LB_Aux(rc));
+
+    if (task.sample)
+    {
+        // t_first is in RUN's summary; scanned again for those sampled, in place
+        //  as the fields may have been decoded out of the gather buffer
+        BoltFrame frame;
+        BoltSummary meta;
+        if (LB_OK(BoltDecoder::Frame(task.view.cursor, current_msg_len, frame)) && frame.chunks == 1 &&
+            LB_OK(Scan_Summary(task.view.cursor + 2, task.view.cursor + 2 + frame.payload_size, meta)))
+            sampler.Note_First(task.sample, meta.t_first);
+    } // end if sampled
+
     results.Enqueue(std::move(result));
+    decode_counters.results_high.Max(results.Size());
 
     return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT,
         LBStage::LB_STAGE_QUERY,
@@ -1049,9 +1268,9 @@ inline LBStatus NeoConnection::Success_Run(DecoderTask& task)
 
 /**
  * @brief handles the success summary message sent after the completion of each
- *  record streaming. If the summary message contains "has_more" key and is set
- *  to true then it persumes not done and sets the state back to PULL and returns
- *  OK has more to continue receiving.
+ *  record streaming. The known keys are scanned into the result's meta without
+ *  decoding; if "has_more" is set it persumes not done and returns has more to
+ *  continue receiving, otherwise the summary is decoded for the caller.
  *
  * @param task the next task on the queue to process
  *
@@ -1059,17 +1278,42 @@ inline LBStatus NeoConnection::Success_Run(DecoderTask& task)
  */
 inline LBStatus NeoConnection::Success_Record(DecoderTask& task)
 {
-    auto result = results.Front();
-    LBStatus rc = decoder.Decode(task.view.cursor, result->get().summary);
+    auto result = In_Flight();
+
+    // scan for has_more & co in place; only the final summary gets decoded
+    BoltFrame frame;
+    LBStatus rc = BoltDecoder::Frame(task.view.cursor, current_msg_len, frame);
     if (!LB_OK(rc))
         return rc;
 
-    if (!Is_Record_Done(result->get().summary))
+    const u8* payload = frame.chunks > 1 ? decoder.Gather(task.view.cursor, frame)
+        : task.view.cursor + 2;
+    if (!payload)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+            LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM);
+    rc = Scan_Summary(payload, payload + frame.payload_size, result->get().meta);
+    if (!LB_OK(rc))
+        return rc;
+
+    if (result->get().meta.has_more)
+    {
+        if (task.pull_n > 0 && task.cb && !task.visitor)
+            Deliver_Batch(task, frame.wire_size);
+
         return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT,
             LBStage::LB_STAGE_QUERY,
-            LBCode::LB_CODE_NONE, LB_Aux(rc));
+            LBCode::LB_CODE_NONE, frame.wire_size);
+    } // end if more to pull
 
-    Wake();
+    rc = decoder.Decode(task.view.cursor, result->get().summary);
+    if (!LB_OK(rc))
+        return rc;
+
+    result->get().done = true;
+    LB_PROBE3(record_success, client_id, result->get().message_count, result->get().total_bytes);
+    Record_Stages(task);
+    if (task.sample) sampler.Offer(task.sample, client_id, result->get(), task.stamps);
+    Complete(task);     // or posted for Fetch()
     tasks.Dequeue();
     return LBOK_INFO(LB_Aux(rc));  // should be LB_OK_INFO
 } // end Success_Record
@@ -1102,7 +1346,9 @@ inline LBStatus NeoConnection::Success_Reset(DecoderTask& task)
  */
 inline LBStatus NeoConnection::Handle_Record(DecoderTask& task)
 {
-    auto result = results.Front();
+    auto result = In_Flight();
+    if (task.state != TaskState::Record)
+        task.stamps.Stamp(QueryStage::First_Record);
     task.state = TaskState::Record;
     result->get().message_count++;
 	result->get().total_bytes += current_msg_len;
@@ -1115,7 +1361,9 @@ inline LBStatus NeoConnection::Handle_Record(DecoderTask& task)
 
 /**
  * @brief decodes the stream containing the error, sets the connection
- *  error string and takes appropriate action based on the current state.
+ *  error string and takes appropriate action based on the current state. A
+ *  query failing after its RUN is done with; its callback, or Fetch(), gets the
+ *  failure in place of the result the RUN started.
  *
  * @param task the next task on the queue to process
  *
@@ -1132,7 +1380,14 @@ inline LBStatus NeoConnection::Handle_Failure(DecoderTask& task)
     r.error = true;
     r.start_offset = task.view.cursor - read_buf.Data();
     r.total_bytes += current_msg_len;
-    results.Enqueue(std::move(r));
+    decode_counters.failures.Add();
+
+    // failing mid stream, it takes the place of the result its RUN started
+    auto result = In_Flight();
+    if ((task.state == TaskState::Pull || task.state == TaskState::Record) && result.has_value())
+        result->get() = std::move(r);
+    else
+        results.Enqueue(std::move(r));
 
     TaskState qs = task.state;
     switch (qs)
@@ -1153,8 +1408,8 @@ inline LBStatus NeoConnection::Handle_Failure(DecoderTask& task)
 
     default:
         action = LBAction::LB_FAIL;
+        Complete(task);     // the callback gets the failure, alas Fetch() is woken
         tasks.Dequeue();
-        Wake();
         break;
     }; // end switch
 
@@ -1175,11 +1430,14 @@ inline LBStatus NeoConnection::Handle_Failure(DecoderTask& task)
 inline LBStatus NeoConnection::Handle_Ignored()
 {
     auto task = tasks.Dequeue();
-    auto res = results.Front();
+    auto res = In_Flight();     // the failure, just queued
     if (res.has_value())
     {
-        if (!std::string("Neo.TransientError.General.DatabaseUnavailable").
-            compare(res->get().begin().bv(0)["neo4j_code"].ToString()))
+        bool transient = !std::string("Neo.TransientError.General.DatabaseUnavailable").
+            compare(res->get().begin().bv(0)["neo4j_code"].ToString());
+
+        if (task.has_value()) Complete(task.value());   // hand over the failure
+        if (transient)
         {
             Reset();
             return LB_Make(
@@ -1198,6 +1456,297 @@ inline LBStatus NeoConnection::Handle_Ignored()
 } // end Handle_Ignored
 
 
+/**
+ * @brief delivers the result at the front of the results queue to the task's
+ *  callback, if it has one, and drops it from the queue since the callback is
+ *  its consumer; tasks without one leave it there for Fetch() and post it as
+ *  done. Inline, the callback runs right here on the decoding thread and should
+ *  be short; with an executor it joins the batch handed over by
+ *  Flush_Completions(), its bytes held apart from read_buf (see Hold()). Should
+ *  the slab refuse the room for them, it runs inline all the same.
+ *
+ * @param task the finished task
+ */
+inline void NeoConnection::Complete(DecoderTask& task)
+{
+    if (!task.cb)
+    {
+        Wake();
+        return;
+    } // end if for Fetch()
+
+    auto result = results.Dequeue();
+    if (result.has_value())
+    {
+        result->client_id = client_id;
+        if (pexec && pexec->Mode() != ExecMode::Inline && Hold(result.value()))
+        {
+            completions.push_back({ std::move(task.cb), std::move(result.value()),
+                LatencyHistogram::clock::now(), task.stamps[QueryStage::Final_Success], &callbacks });
+            if (completions.size() >= COMPLETION_BATCH)
+                Flush_Completions();
+        } // end if executor
+        else
+        {
+            s64 done_ns = task.stamps[QueryStage::Final_Success];
+            s64 started = StageStamps::Now();
+            LB_PROBE3(callback, client_id, result->message_count, done_ns);
+            task.cb(result.value());
+            s64 ended = StageStamps::Now();
+            callbacks.Record(&done_ns, &started, &ended, 1);
+        } // end else inline
+    } // end if result
+
+    task.cb = nullptr;
+} // end Complete
+
+
+/**
+ * @brief copies a finished result's records, field names and summary out of
+ *  read_buf into storage the result owns, borrowed from the slab, and points it
+ *  there; for results handed off this thread, as read_buf may be compacted,
+ *  grown or parked from under them meanwhile. The copy goes wherever the result
+ *  is moved to, so it stays valid past the callback it's handed to.
+ *
+ * @param result a finished result, viewing read_buf
+ *
+ * @return false if the slab refused the room or a message couldn't be walked;
+ *  result is left as it was
+ */
+bool NeoConnection::Hold(BoltResult& result)
+{
+    // the extent of a message decoded in place, read_buf or the gather buffer
+    auto span = [](const BoltMessage& m, const u8*& from, size_t& n) {
+        const BoltValue& v = m.msg;
+        n = 0;
+        if (v.type != BoltType::Struct || !v.is_decoded || !v.buf) return true;
+
+        const u8* end = v.buf->Data() + v.buf->Get_Write_Offset();
+        const u8* p = from = v.buf->Data() + v.struct_val.offset;
+        for (size_t i = 0; i < v.struct_val.size; i++)
+            if (!(p = Unpack::Skip(p, end))) return false;
+
+        n = p - from;
+        return true;
+    };
+
+    const u8* fields_at = nullptr;
+    const u8* summary_at = nullptr;
+    size_t fields_n, summary_n;
+    if (!span(result.fields, fields_at, fields_n) || !span(result.summary, summary_at, summary_n))
+        return false;
+
+    const size_t records = result.total_bytes;
+    auto held = std::make_unique<HeldBytes>(records + fields_n + summary_n, pslab);
+    auto keep = [&held](const u8* from, const size_t n) { return !n || held->buf.Write(from, n); };
+    if (!keep(read_buf.Data() + result.start_offset, records) ||
+        !keep(fields_at, fields_n) || !keep(summary_at, summary_n))
+        return false;
+
+    result.pdec = &held->decoder;
+    result.start_offset = 0;
+    if (fields_n)
+    {
+        result.fields.msg.buf = &held->buf;
+        result.fields.msg.struct_val.offset = records;
+    } // end if field names
+    if (summary_n)
+    {
+        result.summary.msg.buf = &held->buf;
+        result.summary.msg.struct_val.offset = records + fields_n;
+    } // end if summary
+
+    result.held = std::move(held);
+    return true;
+} // end Hold
+
+
+/**
+ * @brief hands a batch of a task run with PULL n over to its callback the way
+ *  Complete() does the final one; inline, or joining the batch handed to the
+ *  executor with its bytes held apart from read_buf, so every batch of a query
+ *  is resumed into on the same side. The next batch starts in place at the front
+ *  of the results queue. Nothing more comes for the task until the callback's
+ *  owner asks for it via Request_More(), so inline the batch's records stay put
+ *  in read_buf until then. The final batch, no has_more, completes the task.
+ *
+ * @param task the task streaming records, at the front of the queue
+ * @param summary_size bytes of the has_more summary ending the batch
+ */
+void NeoConnection::Deliver_Batch(DecoderTask& task, const u32 summary_size)
+{
+    auto slot = In_Flight();
+    BoltResult& next = slot->get();
+
+    BoltResult batch;
+    batch = std::move(next);    // leaves fields in place for the next batch
+    batch.pdec = &decoder;
+
+    next.pdec = &decoder;
+    next.meta = BoltSummary{};
+    next.message_count = 0;
+    next.total_bytes = 0;
+    next.start_offset = (task.view.cursor + summary_size) - read_buf.Data();
+
+    task.state = TaskState::Record;     // a SUCCESS next, without records, ends it
+    batch.client_id = client_id;
+    more_due.store(true, std::memory_order_release);   // before the consumer can ask
+
+    if (pexec && pexec->Mode() != ExecMode::Inline && Hold(batch))
+    {
+        completions.push_back({ [this](BoltResult& r) { Hand_Batch(r, false); }, std::move(batch),
+            LatencyHistogram::clock::now(), StageStamps::Now(), &callbacks });
+        if (completions.size() >= COMPLETION_BATCH)
+            Flush_Completions();
+    } // end if executor
+    else
+        Hand_Batch(batch, false);
+} // end Deliver_Batch
+
+
+/**
+ * @brief calls a Run_Batched() query's callback with a batch; from wherever
+ *  callbacks run. One at a time, as a pool may start the next batch before the
+ *  callback asking for it has returned. The last takes the callback out first,
+ *  so the cell may start another batched query from inside it.
+ *
+ * @param batch the batch, or the final result
+ * @param last no more batches come after it
+ */
+void NeoConnection::Hand_Batch(BoltResult& batch, const bool last)
+{
+    std::unique_lock<std::mutex> guard(batch_lock);
+    if (!last)
+    {
+        if (batch_cb) batch_cb(batch);  // gone if the connection was reset since
+        return;
+    } // end if more to come
+
+    ResultCallback cb = std::move(batch_cb);
+    batch_cb = nullptr;
+    more_due.store(false, std::memory_order_relaxed);
+    batching.store(false, std::memory_order_release);   // the cell may run anything again
+    guard.unlock();
+    if (cb) cb(batch);
+} // end Hand_Batch
+
+
+/**
+ * @brief the result of the task being decoded, the one queued last; those ahead
+ *  of it are done, waiting on Fetch(), so records and failures must not land
+ *  on the front one.
+ */
+std::optional<std::reference_wrapper<BoltResult>> NeoConnection::In_Flight()
+{
+    return results.Back();
+} // end In_Flight
+
+
+/**
+ * @brief asks for more of the result a task run with PULL n stopped at; another
+ *  PULL of n records, or a DISCARD of the rest. No task is queued since the one
+ *  run is still at the front, waiting on it. Called from wherever the batch was
+ *  handed over, so write_buf is claimed outright rather than as the submitter.
+ *
+ * @param n the number of records to pull, -1 for the rest
+ * @param discard DISCARD rather than PULL
+ *
+ * @return LB_OK on success, alas LB_FAIL with no batch handed over since the
+ *  last ask, or the status of encoding or Flush()
+ */
+LBStatus NeoConnection::Request_More(const int n, const bool discard)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    BoltMessage more(BoltValue(
+        discard ? BOLT_DISCARD : BOLT_PULL, {
+            {mp("n", n), mp("qid",-1)}
+        }));
+
+    // once per batch handed over; a second ask would pull a batch no one waits on
+    if (!more_due.exchange(false, std::memory_order_acq_rel))
+    {
+        Release_Pool<BoltValue>(offset);
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE,
+            LBStage::LB_STAGE_QUERY, LBCode::LB_CODE_TASKSTATE);
+    } // end if nothing due
+
+    // on the consumer's thread; waits out the submitter should it be mid flush
+    WriteClaim claim(*this);
+    LBStatus rc = encoder.Encode(more);
+    if (!LB_OK(rc)) rc = Retry_Encode(more);
+    Release_Pool<BoltValue>(offset);
+    if (!LB_OK(rc))
+    {
+        more_due.store(true, std::memory_order_release);    // nothing sent; may ask again
+        return rc;
+    } // end if not encoded
+
+    return Flush();
+} // end Request_More
+
+
+/**
+ * @brief stamps the task enqueued last, i.e. the one just run, at the given
+ *  stage; called by the submitting thread once it gets there.
+ */
+void NeoConnection::Stamp_Last(const QueryStage s)
+{
+    auto task = tasks.Back();
+    if (task.has_value())
+        task->get().stamps.Stamp(s);
+} // end Stamp_Last
+
+
+/**
+ * @brief stamps a task's final SUCCESS and records its stages, along with its
+ *  total latency
+ */
+void NeoConnection::Record_Stages(DecoderTask& task)
+{
+    task.stamps.Stamp(QueryStage::Final_Success);
+    stages.Record(task.stamps);
+    latencies.Record_Latency(std::chrono::nanoseconds(
+        task.stamps[QueryStage::Final_Success] - task.stamps[QueryStage::Submit]));
+} // end Record_Stages
+
+
+/**
+ * @brief notes the bytes a sampled query's RUN and PULL took in the write buffer,
+ *  from its size before; one flushed to make room leaves only them in it.
+ */
+void NeoConnection::Note_Request(const u32 sample, const size_t before)
+{
+    const size_t after = write_buf.Size();
+    sampler.Note_Bytes(sample, after >= before ? after - before : after);
+} // end Note_Request
+
+
+/**
+ * @brief a copy of the per stage histograms; merged rather than copied, as the
+ *  decoding thread may be recording into them meanwhile
+ */
+StageLatencies NeoConnection::Stage_Snapshot()
+{
+    StageLatencies copy;
+    copy.Merge(stages);
+    return copy;
+} // end Stage_Snapshot
+
+
+/**
+ * @brief hands the callbacks completed so far to the executor in one go; called
+ *  once a read is decoded, or when the batch fills up.
+ */
+void NeoConnection::Flush_Completions()
+{
+    if (completions.empty()) return;
+
+    if (pexec) pexec->Submit(std::move(completions));
+    completions.clear();    // moved from; empty and ready for the next batch
+    completions.reserve(COMPLETION_BATCH);
+} // end Flush_Completions
+
+
 /**
  * @brief encodes a PULL message after a RUN command to fetch all results.
  *
@@ -1213,39 +1762,34 @@ void NeoConnection::Encode_Pull(const int n)
             {mp("n", n), mp("qid",-1)}
         }));
 
+    Claim_Write();
     encoder.Encode(pull);
     Release_Pool<BoltValue>(offset);
 } // end Send_Pull
 
 
 /**
- * @brief waits completion of the next streaming. When the atomic is_done is
- *  set to true it breaks the loop and terminates. It also wakes/notifies a waiting
- *  process to continue processing. On exit resets is_done back to false so that
- *  the next caller can wait till done if needed.
+ * @brief waits for the next result left for Fetch() to complete and takes it;
+ *  completions are counted, so any that came in since the last call are taken
+ *  one per call without waiting.
+ *
+ * @param timeout how long to wait at most
+ *
+ * @return true if one was taken, false on timeout
  */
-void NeoConnection::Wait_Task()
+bool NeoConnection::Wait_Task(const CompletionSignal::duration timeout)
 {
-    while (1)
-    {
-        bool prev = is_done.load(std::memory_order_acquire);
-        if (prev) break;
-
-        is_done.wait(prev);
-    } // end while
-
-    is_done.store(false, std::memory_order_release);    // reset
-} // end Wait_Result
+    return done.Wait(timeout);
+} // end Wait_Task
 
 
 /**
- * @brief wakes a waiting process viz its atomic is_done. Function sets is_done to
- *  true and sends notifications to wake a waiting thread.
+ * @brief posts a completion to Wait_Task(); one per result left in the results
+ *  queue, so none is coalesced with another.
  */
 void NeoConnection::Wake()
 {
-    is_done.store(true, std::memory_order_release);
-    is_done.notify_one();
+    done.Post();
 } // end Wake
 
 
@@ -1332,6 +1876,18 @@ LBStatus NeoConnection::Retry_Encode(BoltMessage& dat)
     LBStatus rc = Flush();
     if (!LB_OK(rc)) return rc;
 
+    // a parked buffer that can't be unparked is the slab's cap talking
+    Claim_Write();
+    if (!write_buf.Unpark())
+    {
+        return LB_Make(
+            LBAction::LB_FAIL,
+            LBDomain::LB_DOM_MEMORY,
+            LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_STATE_MEM
+        );
+    } // end if no storage
+
     // encode it back
     rc = encoder.Encode(dat);
     if (!LB_OK(rc))
@@ -0,0 +1,203 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <algorithm>
+#include "connection/neoconnection.h"     // brings in query_sampler.h after decoder_task.h
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief destructor; frees the slots and whatever samples weren't taken
+ */
+QuerySampler::~QuerySampler()
+{
+    delete state.load(std::memory_order_acquire);
+} // end destructor
+
+
+/**
+ * @brief sets which queries are sampled from the next one noted on; the slots
+ *  and ring are made the first time any are. A policy of zeros turns it off,
+ *  samples not yet taken are kept.
+ *
+ * @param policy the threshold and one in n to sample by
+ */
+void QuerySampler::Set_Policy(const SamplePolicy& policy)
+{
+    if ((policy.threshold.count() > 0 || policy.one_in) && !state.load(std::memory_order_acquire))
+    {
+        State* fresh = new State;
+        State* none = nullptr;
+        if (!state.compare_exchange_strong(none, fresh, std::memory_order_acq_rel))
+            delete fresh;   // someone beat us to it
+    } // end if first on
+
+    threshold_ns.store(std::max<s64>(0, policy.threshold.count()), std::memory_order_relaxed);
+    one_in.store(policy.one_in, std::memory_order_relaxed);
+} // end Set_Policy
+
+
+/**
+ * @brief the policy sampled by
+ */
+SamplePolicy QuerySampler::Policy() const
+{
+    SamplePolicy p;
+    p.threshold = std::chrono::nanoseconds(threshold_ns.load(std::memory_order_relaxed));
+    p.one_in = one_in.load(std::memory_order_relaxed);
+    return p;
+} // end Policy
+
+
+/**
+ * @brief moves up to max samples, oldest first, onto the end of out; for one
+ *  reader at a time.
+ *
+ * @return the number of samples taken
+ */
+size_t QuerySampler::Take(std::vector<QuerySample>& out, const size_t max)
+{
+    State* s = state.load(std::memory_order_acquire);
+    if (!s) return 0;
+
+    size_t n = 0;
+    for (; n < max; n++)
+    {
+        auto sample = s->ring.Dequeue();
+        if (!sample.has_value()) break;
+        out.push_back(std::move(*sample));
+    } // end for
+
+    return n;
+} // end Take
+
+
+/**
+ * @brief samples pushed into the ring so far
+ */
+u64 QuerySampler::Sampled() const
+{
+    return sampled.Get();
+} // end Sampled
+
+
+/**
+ * @brief and those dropped on finding it full
+ */
+u64 QuerySampler::Dropped() const
+{
+    return dropped.Get();
+} // end Dropped
+
+
+/**
+ * @brief notes a query about to be queued; by the submitting thread. The text
+ *  is copied in case it's sampled, as the caller's is long gone by then. Slots
+ *  go round in order and tasks complete in order, so refusing once in_flight
+ *  reaches SAMPLE_SLOTS keeps a slot from being reused under a live task.
+ *
+ * @param cypher the query text
+ * @param len its length
+ * @param params the number of parameters it's run with
+ * @param in_flight tasks queued on the connection before this one
+ *
+ * @return the task's sample slot plus one, alas 0 if it won't be sampled
+ */
+u32 QuerySampler::Note(const char* cypher, const size_t len, const u32 params, const size_t in_flight)
+{
+    State* s = state.load(std::memory_order_acquire);
+    if (!s || !Enabled() || in_flight >= SAMPLE_SLOTS)
+        return 0;
+
+    const u32 at = u32(next_slot++ & (SAMPLE_SLOTS - 1));
+    Slot& slot = s->slots[at];
+    slot.text.assign(cypher, std::min(len, SAMPLE_TEXT_MAX));
+    slot.params = params;
+    slot.bytes.store(0, std::memory_order_relaxed);
+    slot.t_first = -1;
+    return at + 1;
+} // end Note
+
+
+/**
+ * @brief the bytes its RUN and PULL took, once encoded; by the submitting thread
+ *  after the task is queued
+ */
+void QuerySampler::Note_Bytes(const u32 slot, const size_t bytes)
+{
+    State* s = state.load(std::memory_order_acquire);
+    if (!slot || !s) return;
+    s->slots[slot - 1].bytes.store(u32(std::min<size_t>(bytes, UINT32_MAX)), std::memory_order_relaxed);
+} // end Note_Bytes
+
+
+/**
+ * @brief the server's t_first from RUN's SUCCESS; by the decoding thread
+ */
+void QuerySampler::Note_First(const u32 slot, const s64 t_first)
+{
+    State* s = state.load(std::memory_order_acquire);
+    if (!slot || !s) return;
+    s->slots[slot - 1].t_first = t_first;
+} // end Note_First
+
+
+/**
+ * @brief decides on a completed task's sample; by the decoding thread at its
+ *  final SUCCESS, stamps up to it taken. Those over the threshold are kept
+ *  as slow, the rest counted towards the next one in n.
+ *
+ * @param slot as Note() gave it
+ * @param client_id the connection's
+ * @param result the task's result, summary scanned
+ * @param stamps the task's stage stamps
+ */
+void QuerySampler::Offer(const u32 slot, const int client_id, const BoltResult& result,
+    const StageStamps& stamps)
+{
+    State* s = state.load(std::memory_order_acquire);
+    if (!slot || !s) return;
+
+    const s64 latency = stamps[QueryStage::Final_Success] - stamps[QueryStage::Submit];
+    const s64 threshold = threshold_ns.load(std::memory_order_relaxed);
+    const u32 n = one_in.load(std::memory_order_relaxed);
+
+    const bool slow = threshold && latency > threshold;
+    bool picked = false;
+    if (n && ++since_picked >= n)
+    {
+        since_picked = 0;
+        picked = true;
+    } // end if one in n
+    if (!slow && !picked) return;
+
+    Slot& from = s->slots[slot - 1];
+    QuerySample sample;
+    sample.client_id = client_id;
+    sample.cypher = from.text;
+    sample.param_count = from.params;
+    sample.request_bytes = from.bytes.load(std::memory_order_relaxed);
+    sample.records = result.message_count;
+    sample.record_bytes = result.total_bytes;
+    sample.t_first = from.t_first;
+    sample.t_last = result.meta.t_last;
+    sample.slow = slow;
+    for (u8 i = 0; i <= u8(QueryStage::Final_Success); i++)
+        sample.at[i] = stamps[QueryStage(i)];
+
+    if (s->ring.Enqueue(std::move(sample))) sampled.Add();
+    else dropped.Add();
+} // end Offer
@@ -0,0 +1,193 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <chrono>
+#include "connection/wire_capture.h"
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief the steady clock in nanoseconds; the same one query stages are stamped
+ *  with
+ */
+static s64 Steady_Ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+} // end Steady_Ns
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief destructor; flushes and closes the file if open
+ */
+WireCapture::~WireCapture()
+{
+    Close();
+} // end destructor
+
+
+/**
+ * @brief starts capturing into path, truncating it; a capture already open is
+ *  closed first.
+ *
+ * @param path the capture file
+ *
+ * @return LB_OK on success, alas LB_FAIL with the errno of opening path
+ */
+LBStatus WireCapture::Open(const std::string& path)
+{
+    Close();
+
+    std::lock_guard<std::mutex> guard(lock);
+    file = fopen(path.c_str(), "wb");
+    if (!file)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+    setvbuf(file, nullptr, _IOFBF, CAPTURE_BUFFER);
+
+    CaptureHeader header{};
+    memcpy(header.magic, CAPTURE_MAGIC, sizeof(header.magic));
+    header.start_ns = start_ns = Steady_Ns();
+    bytes = fwrite(&header, 1, sizeof(header), file);
+
+    on.store(true, std::memory_order_release);
+    return LB_Make();
+} // end Open
+
+
+/**
+ * @brief stops capturing; what's buffered is written out
+ */
+void WireCapture::Close()
+{
+    on.store(false, std::memory_order_release);
+
+    std::lock_guard<std::mutex> guard(lock);
+    if (file) fclose(file);
+    file = nullptr;
+} // end Close
+
+
+/**
+ * @brief true while capturing
+ */
+bool WireCapture::Is_Open() const
+{
+    return on.load(std::memory_order_acquire);
+} // end Is_Open
+
+
+/**
+ * @brief bytes written to the file so far, headers and all
+ */
+u64 WireCapture::Bytes() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return bytes;
+} // end Bytes
+
+
+/**
+ * @brief writes a frame header and its bytes; the lock keeps the two threads'
+ *  frames whole. A write failing, i.e. on a full disk, ends the capture.
+ */
+void WireCapture::Write_Frame(const WireDir dir, const u8* data, const size_t len)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if (!file) return;
+
+    CaptureFrame frame{};
+    frame.ns = Steady_Ns() - start_ns;
+    frame.len = u32(len);
+    frame.dir = dir;
+
+    if (fwrite(&frame, sizeof(frame), 1, file) != 1 || fwrite(data, 1, len, file) != len)
+    {
+        on.store(false, std::memory_order_relaxed);
+        fclose(file);
+        file = nullptr;
+        return;
+    } // end if write failed
+
+    bytes += sizeof(frame) + len;
+} // end Write_Frame
+
+
+/**
+ * @brief destructor
+ */
+CaptureReader::~CaptureReader()
+{
+    if (file) fclose(file);
+} // end destructor
+
+
+/**
+ * @brief opens a capture and checks its header
+ *
+ * @return LB_OK on success, LB_FAIL with the errno on opening, or LB_CODE_PROTO
+ *  for a file that's not a capture
+ */
+LBStatus CaptureReader::Open(const std::string& path)
+{
+    if (file) fclose(file);
+    file = fopen(path.c_str(), "rb");
+    if (!file)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+    setvbuf(file, nullptr, _IOFBF, CAPTURE_BUFFER);
+
+    CaptureHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, CAPTURE_MAGIC, sizeof(header.magic)))
+    {
+        fclose(file);
+        file = nullptr;
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_BOLT, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_PROTO);
+    } // end if not a capture
+
+    return LB_Make();
+} // end Open
+
+
+/**
+ * @brief reads the next frame and its bytes into data
+ *
+ * @return false at the end of the capture, or a frame cut short by it
+ */
+bool CaptureReader::Next(CaptureFrame& frame, std::vector<u8>& data)
+{
+    if (!file || fread(&frame, sizeof(frame), 1, file) != 1)
+        return false;
+
+    data.resize(frame.len);
+    return fread(data.data(), 1, frame.len, file) == frame.len;
+} // end Next
+
+
+/**
+ * @brief back to the first frame
+ */
+void CaptureReader::Rewind()
+{
+    if (file) fseek(file, sizeof(CaptureHeader), SEEK_SET);
+} // end Rewind
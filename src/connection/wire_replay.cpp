@@ -0,0 +1,271 @@
+/**
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <sys/socket.h>
+#include <fcntl.h>
+#include "connection/wire_replay.h"
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief calls on_tag with the tag of every whole message at the front of
+ *  pending and drops them, leaving whatever's cut short for the next call.
+ *  NOOPs, lone 00 00 chunks, are dropped without a call.
+ */
+template<typename F>
+static void Split_Messages(std::vector<u8>& pending, F&& on_tag)
+{
+    size_t at = 0;          // start of the message being walked
+    size_t pos = 0;
+    int tag = -1;
+
+    while (pos + 2 <= pending.size())
+    {
+        u16 size = ntohs(*(u16*)(pending.data() + pos));
+        if (size == 0)
+        {
+            pos += 2;
+            if (tag >= 0) on_tag(u8(tag));
+            at = pos;
+            tag = -1;
+            continue;
+        } // end if end of message
+
+        if (pos + 2 + size > pending.size()) break;
+        if (tag < 0 && size >= 2) tag = pending[pos + 3];  // [size][B?][tag]
+        pos += 2 + size;
+    } // end while
+
+    pending.erase(pending.begin(), pending.begin() + at);
+} // end Split_Messages
+
+
+/**
+ * @brief the state a request's task is queued in, as the connection queues it
+ *  when sending one; false for those answered on the task of another, i.e. a
+ *  PULL or DISCARD on their RUN's
+ */
+static bool Task_For(const u8 tag, TaskState& state)
+{
+    switch (tag)
+    {
+    case BOLT_HELLO:        state = TaskState::Hello; return true;
+    case BOLT_LOGON:        state = TaskState::Logon; return true;
+    case BOLT_LOGOFF:
+    case BOLT_GOODBYE:      state = TaskState::Logoff; return true;
+    case BOLT_RUN:          state = TaskState::Run; return true;
+    case BOLT_BEGIN:        state = TaskState::Begin; return true;
+    case BOLT_COMMIT:       state = TaskState::Commit; return true;
+    case BOLT_ROLLBACK:     state = TaskState::Rollback; return true;
+    case BOLT_RESET:        state = TaskState::Reset; return true;
+    case BOLT_ROUTE:        state = TaskState::Route; return true;
+    case BOLT_TELEMETRY:    state = TaskState::Telemetry; return true;
+    case BOLT_ACK_FAILURE:  state = TaskState::Ack_Failure; return true;
+    default:                return false;
+    } // end switch
+} // end Task_For
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief constructor; the connection gets one end of a socket pair for a socket
+ *  and no server version, so HELLO's SUCCESS completes it without a LOGON
+ *  following; the captured LOGON gets a task of its own.
+ */
+WireReplay::WireReplay()
+    : connection("", nullptr, nullptr)
+{
+    iZero(&connection.supported_version, sizeof(connection.supported_version));
+
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0)
+    {
+        connection.fd = fds[0];
+        peer_fd = fds[1];
+        fcntl(peer_fd, F_SETFL, fcntl(peer_fd, F_GETFL) | O_NONBLOCK);
+    } // end if paired
+} // end WireReplay
+
+
+/**
+ * @brief destructor; the connection closes its end
+ */
+WireReplay::~WireReplay()
+{
+    if (peer_fd >= 0) close(peer_fd);
+} // end destructor
+
+
+/**
+ * @brief replays the capture from where the reader is to its end. Sends queue
+ *  their tasks, recvs are written into the read buffer and decoded, and results
+ *  taken as they complete.
+ *
+ * @param reader an open capture
+ * @param stats where the counts and timings go; added to
+ *
+ * @return LB_OK on success, alas the status of a decode that failed
+ */
+LBStatus WireReplay::Run(CaptureReader& reader, ReplayStats& stats)
+{
+    CaptureFrame frame;
+    std::vector<u8> data;
+    const s64 start = StageStamps::Now();
+
+    while (reader.Next(frame, data))
+    {
+        stats.captured_ns = frame.ns;
+        if (frame.dir == WireDir::Out)
+        {
+            stats.frames_out++;
+            stats.bytes_out += frame.len;
+            Queue_Requests(data.data(), data.size(), stats);
+            if (connection.read_buf.Empty()) continue;
+        } // end if sent
+        else
+        {
+            stats.frames_in++;
+            stats.bytes_in += frame.len;
+        } // end else received
+
+        const s64 t0 = StageStamps::Now();
+        if (frame.dir == WireDir::In)
+        {
+            if (!connection.read_buf.Write(data.data(), data.size()))
+                return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_MEMORY,
+                    LBStage::LB_STAGE_DECODE, LBCode::LB_CODE_STATE_MEM);
+            connection.last_recv_ns = t0;
+            connection.decode_counters.bytes_in.Add(data.size());
+        } // end if received
+
+        LBStatus rc = Decode();
+        if (!LB_OK(rc)) return rc;
+        Take_Results(stats);
+        Collect_Self_Sent();
+        stats.frame_decode.Record_Latency(std::chrono::nanoseconds(StageStamps::Now() - t0));
+    } // end while
+
+    stats.unmatched += connection.read_buf.Size();
+    stats.replay_ns += StageStamps::Now() - start;
+    return LB_Make();
+} // end Run
+
+
+/**
+ * @brief parses the requests out of captured sends and queues a task for each
+ *  as the connection did when sending it; unless the connection has already
+ *  sent and queued the same of its own accord during the replay.
+ */
+void WireReplay::Queue_Requests(const u8* data, const size_t len, ReplayStats& stats)
+{
+    sent.insert(sent.end(), data, data + len);
+    Split_Messages(sent, [&](const u8 tag) {
+        if (!self_tags.empty() && self_tags.front() == tag)
+        {
+            self_tags.pop_front();
+            return;
+        } // end if sent by the connection itself
+
+        TaskState state;
+        if (!Task_For(tag, state)) return;
+        connection.tasks.Enqueue(DecoderTask(state));
+        stats.requests++;
+    });
+} // end Queue_Requests
+
+
+/**
+ * @brief reads what the connection sent of its own accord while decoding from
+ *  the socket pair, keeping the tags of its messages to match off the capture
+ */
+void WireReplay::Collect_Self_Sent()
+{
+    u8 buf[4096];
+    ssize_t n;
+    while (peer_fd >= 0 && (n = recv(peer_fd, buf, sizeof(buf), 0)) > 0)
+        self_sent.insert(self_sent.end(), buf, buf + n);
+
+    Split_Messages(self_sent, [&](const u8 tag) { self_tags.push_back(tag); });
+} // end Collect_Self_Sent
+
+
+/**
+ * @brief decodes every whole message in the read buffer against the task at the
+ *  front, as NeoCell::Decode_Response() does. Bytes with no task to answer wait
+ *  for the send queuing it; i.e. a response captured a hair before its request.
+ *
+ * @return LB_OK on success, alas LB_FAIL on a malformed message
+ */
+LBStatus WireReplay::Decode()
+{
+    BoltBuf& buf = connection.read_buf;
+    u8* ptr = buf.Read_Ptr();
+    const size_t total = buf.Size();
+    size_t decoded = 0;
+
+    while (decoded < total)
+    {
+        auto task = connection.tasks.Front();
+        if (!task.has_value()) break;
+
+        task->get().view.cursor = ptr;
+        task->get().view.size = total - decoded;
+
+        LBStatus rc = connection.Can_Decode(ptr, total - decoded);
+        if (LBAction(LB_Action(rc)) == LBAction::LB_HASMORE) break;
+        if (!LB_OK(rc)) return rc;
+
+        rc = connection.Decode_One(task->get());
+        decoded += LB_Aux(rc);
+        ptr += LB_Aux(rc);
+    } // end while
+
+    // a RESET's SUCCESS empties the buffer under us; as it does the driver's
+    if (buf.Get_Write_Offset() < buf.Get_Read_Offset() + decoded) buf.Reset();
+    else buf.Consume(decoded);
+    return LB_Make();
+} // end Decode
+
+
+/**
+ * @brief takes the results done or failed off the front and decodes their
+ *  records, as a caller of Fetch() would; once none is left in the making the
+ *  read buffer is compacted or emptied for the next recv.
+ */
+void WireReplay::Take_Results(ReplayStats& stats)
+{
+    for (auto front = connection.results.Front(); front.has_value() &&
+        (front->get().done || front->get().error); front = connection.results.Front())
+    {
+        BoltResult result = std::move(*connection.results.Dequeue());
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+
+        for (auto it = result.begin(); it != result.end(); ++it)
+            if (!result.error) stats.records++;
+
+        Release_Pool<BoltValue>(offset);
+        stats.results++;
+        stats.failures += result.error;
+    } // end for
+
+    if (!connection.results.Is_Empty()) return;
+    if (connection.read_buf.Empty()) connection.read_buf.Reset();
+    else connection.read_buf.Compact();
+} // end Take_Results
@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 10th of December 2025, Wednesday
- * @date @date updated 27th of Feburary 2026, Friday
+ * @date updated 16th of October 2026, Friday.
  */
 
 
@@ -22,9 +22,11 @@
  * @brief constructor
  *
  * @param con_string the connection string to connect to neo4j server
+ * @param pslab optional shared slab the connection buffers borrow from
  */
-NeoCell::NeoCell(int epfd_, const std::string& urls, BoltValue* pauth, BoltValue* pextras)
-	: connection(urls, pauth, pextras), epfd(epfd_), max_retries(12)
+NeoCell::NeoCell(int epfd_, const std::string& urls, BoltValue* pauth, BoltValue* pextras,
+	BufferSlab* pslab)
+	: connection(urls, pauth, pextras, pslab), epfd(epfd_), max_retries(12)
 {
 	retry_count = 0;
 	leftover_bytes = 0;
@@ -91,7 +93,19 @@ LBStatus NeoCell::Start_Session(const int id)
 } // end Start_Session
 
 
-LBStatus NeoCell::Run_Async(std::function<void(BoltResult&)> cb, 
+/**
+ * @brief runs a query; cb, if given, gets the result once it completes,
+ *	otherwise it's left for Fetch().
+ *
+ * @param cb optional completion callback
+ * @param query the cypher query
+ * @param param parameters for cypher query above
+ * @param extra info for cypher like r/w, db name, bookmarks etc.
+ *
+ * @return LB_OK once sent, alas the status it failed with; cb is never called
+ *	for a query that wasn't sent.
+ */
+LBStatus NeoCell::Run_Async(ResultCallback cb, 
 	const char* query, BoltValue&& param, BoltValue&& extra)
 {
 	// queue the request as a command structure before running it;
@@ -101,13 +115,14 @@ LBStatus NeoCell::Run_Async(std::function<void(BoltResult&)> cb,
 	cmd.cypher = query;
 	cmd.param = std::move(param);
 	cmd.extra = std::move(extra);
-	cmd.cb = cb;
+	cmd.cb = std::move(cb);
 
+	LB_PROBE2(query_submit, connection.client_id, query);
 	LBStatus rc = Execute_Command(cmd);
 	if (!LB_OK(rc))
-		rc = LB_Handle_Status(rc, this);
+		LB_Handle_Status(rc, this);		// recovers the cell; the query is still lost
 
-	return LB_Make();
+	return rc;
 } // end run
 
 
@@ -117,26 +132,167 @@ LBStatus NeoCell::Run(const char* query, BoltValue&& param, BoltValue&& extra)
 } // end run
 
 
+/**
+ * @brief runs a query whose records are decoded as they arrive and handed to
+ *	visitor on the polling thread, rather than kept in the read buffer. The
+ *	result fetched or given to cb has the field names, summary and number of
+ *	records but none of the records themselves.
+ *
+ * @param visitor receives the records; must outlive the query
+ * @param cb optional completion callback
+ * @param query the cypher query
+ * @param param parameters for cypher query above
+ * @param extra info for cypher like r/w, db name, bookmarks etc.
+ *
+ * @return LB_OK on success, alas LB_FAIL.
+ */
+LBStatus NeoCell::Run_Streamed(BoltVisitor* visitor, ResultCallback cb,
+	const char* query, BoltValue&& param, BoltValue&& extra)
+{
+	CellCommand cmd;
+	cmd.type = CellCmdType::Run;
+	cmd.cypher = query;
+	cmd.param = std::move(param);
+	cmd.extra = std::move(extra);
+	cmd.cb = std::move(cb);
+	cmd.visitor = visitor;
+
+	LBStatus rc = Execute_Command(cmd);
+	if (!LB_OK(rc))
+		LB_Handle_Status(rc, this);		// recovers the cell; the query is still lost
+
+	return rc;
+} // end Run_Streamed
+
+
 
-LBStatus NeoCell::Fetch(BoltResult& results)
+/**
+ * @brief runs a query pulling n records at a time; cb gets every batch as it
+ *	completes, with result.meta.has_more set on all but the last. The next batch
+ *	is only pulled once asked for via Pull_Next() (or the rest dropped through
+ *	Discard_Rest()), so a slow consumer holds the server back rather than piling
+ *	records up in the receive buffer. A batch stays valid until the next is
+ *	asked for. Every batch, the last included, is handed over where the cell's
+ *	callbacks run; off the decoding thread a batch carries a copy of its bytes.
+ *
+ * @note the cell refuses any other query until the last batch is in; the
+ *	pending PULLs would be answered behind whatever was queued after.
+ *
+ * @param cb gets each batch; required
+ * @param query the cypher query
+ * @param n records per batch, > 0
+ * @param param parameters for cypher query above
+ * @param extra info for cypher like r/w, db name, bookmarks etc.
+ *
+ * @return LB_OK on success, alas LB_FAIL.
+ */
+LBStatus NeoCell::Run_Batched(ResultCallback cb, const char* query, const int n,
+	BoltValue&& param, BoltValue&& extra)
 {
-	do
-	{
-		// wait for at least one full message
-		connection.Wait_Task();
+	if (!cb || n <= 0)
+		return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE, LBStage::LB_STAGE_QUERY);
+
+	CellCommand cmd;
+	cmd.type = CellCmdType::Run;
+	cmd.cypher = query;
+	cmd.n = n;
+	cmd.param = std::move(param);
+	cmd.extra = std::move(extra);
+	cmd.cb = std::move(cb);
+
+	LBStatus rc = Execute_Command(cmd);
+	if (!LB_OK(rc))
+		LB_Handle_Status(rc, this);		// recovers the cell; the query is still lost
+
+	return rc;
+} // end Run_Batched
+
+
+/**
+ * @brief pulls the next n records of a Run_Batched() query, once the batch
+ *	before has been handed over with has_more set; once per batch.
+ *
+ * @return LB_OK on success, alas LB_FAIL with no batch to follow up on, or
+ *	LB_FAIL/LB_RETRY from sending.
+ */
+LBStatus NeoCell::Pull_Next(const int n)
+{
+	return connection.Request_More(n, false);
+} // end Pull_Next
+
+
+/**
+ * @brief drops what's left of a Run_Batched() query; its callback then gets a
+ *	last batch with no records and the final summary. In place of a Pull_Next().
+ *
+ * @return LB_OK on success, alas LB_FAIL with no batch to follow up on, or
+ *	LB_FAIL/LB_RETRY from sending.
+ */
+LBStatus NeoCell::Discard_Rest()
+{
+	return connection.Request_More(-1, true);
+} // end Discard_Rest
+
 
-		requests.Dequeue();		// remove the request on response to user, its done!
-		auto result = connection.results.Dequeue();
-		if (!result.has_value())
-			return LB_Make();
+/**
+ * @brief waits for the next result of a query run without a callback and moves
+ *	it into result; results come in the order their queries were run, one per
+ *	call, none skipped however many completed since the last call.
+ *
+ * @param result receives the result
+ * @param timeout how long to wait at most; forever by default
+ *
+ * @return LB_OK on success, LB_WAIT when nothing completed in time
+ */
+LBStatus NeoCell::Fetch(BoltResult& result, const CompletionSignal::duration timeout)
+{
+	if (!connection.Wait_Task(timeout))
+		return LB_Make(LBAction::LB_WAIT, LBDomain::LB_DOM_STATE, LBStage::LB_STAGE_QUERY);
 
-		results = std::move(result.value());
-	} while (!connection.results.Is_Empty());
+	requests.Dequeue();		// remove the request on response to user, its done!
+	auto ready = connection.results.Dequeue();
+	if (ready.has_value())
+	{
+		result = std::move(ready.value());
+		fetched.store(true, std::memory_order_release);
+	} // end if ready
 
 	return LB_Make();
 } // end Fetch
 
 
+/**
+ * @brief takes every result that is ready, up to out.size(), in one call; waits
+ *	up to timeout for the first should none be ready yet.
+ *
+ * @param out receives the results in the order their queries were run
+ * @param timeout how long to wait for the first at most; forever by default
+ *
+ * @return LB_OK_INFO with the number of results moved into out, LB_WAIT when
+ *	nothing completed in time
+ */
+LBStatus NeoCell::Fetch_Many(std::span<BoltResult> out, const CompletionSignal::duration timeout)
+{
+	u32 n = connection.done.Take(static_cast<u32>(std::min<size_t>(out.size(), UINT32_MAX)), timeout);
+	if (!n)
+		return LB_Make(LBAction::LB_WAIT, LBDomain::LB_DOM_STATE, LBStage::LB_STAGE_QUERY);
+
+	u32 taken = 0;
+	for (u32 i = 0; i < n; i++)
+	{
+		requests.Dequeue();
+		auto ready = connection.results.Dequeue();
+		if (ready.has_value())
+			out[taken++] = std::move(ready.value());
+	} // end for
+
+	if (taken)
+		fetched.store(true, std::memory_order_release);
+
+	return LBOK_INFO(taken);
+} // end Fetch_Many
+
+
 /**
  * @brief returns the underlying socket descriptorconnection.read_buf.Reset();
  */
@@ -174,9 +330,10 @@ int NeoCell::Get_ClientID() const
 
 
 /**
- * @brief returns the p-th percentile latency in milliseconds, aproximately. 
- *	The latency is calculated based on the time it takes for the connection to 
- *	encode + send + receive + decode a full response for a request. 
+ * @brief returns the p-th percentile latency in whole milliseconds, truncated;
+ *	see Percentile_Us() for anything under a few milliseconds. The latency is
+ *	calculated based on the time it takes for the connection to encode + send +
+ *	receive + decode a full response for a request.
  *
  * @param p the percentile to compute in [0.0, 1.0]
  * 
@@ -189,6 +346,116 @@ u64 NeoCell::Percentile(double p) const
 } // end Percentile
 
 
+/**
+ * @brief returns the p-th percentile latency in microseconds, fractions kept;
+ *	within 1% of the recorded latency.
+ *
+ * @param p the percentile to compute in [0.0, 1.0]
+ */
+double NeoCell::Percentile_Us(double p) const
+{
+	return connection.latencies.Percentile_Us(p);
+} // end Percentile_Us
+
+
+/**
+ * @brief a copy of the latency histogram; i.e. to Merge() with other cells' or
+ *	Serialize() for comparing across deployments
+ */
+LatencyHistogram NeoCell::Latencies() const
+{
+	LatencyHistogram copy;
+	copy.Merge(connection.latencies);	// the decoding thread may be recording meanwhile
+	return copy;
+} // end Latencies
+
+
+/**
+ * @brief a copy of the per stage latency histograms; where the time of queries
+ *	went, from being submitted to their callbacks returning. See QueryStage.
+ */
+StageLatencies NeoCell::Stage_Latencies()
+{
+	return connection.Stage_Snapshot();
+} // end Stage_Latencies
+
+
+/**
+ * @brief a snapshot of this cell's counters and histograms; see NeoMetrics
+ */
+NeoMetrics NeoCell::Metrics()
+{
+	NeoMetrics m;
+	Collect_Metrics(m);
+	return m;
+} // end Metrics
+
+
+/**
+ * @brief where the cell stands right now; buffer sizes and queue depths as
+ *	written by the threads running it, so a moment stale under load
+ */
+CellGauges NeoCell::Gauges()
+{
+	CellGauges g;
+	g.client_id = connection.client_id;
+	g.connected = connection.Is_Open();
+	g.recv_paused = connection.recv_paused.load(std::memory_order_relaxed);
+	g.read_capacity = connection.read_buf.Is_Parked() ? 0 : connection.read_buf.Capacity();
+	g.read_bytes = connection.read_buf.Size();
+	g.write_capacity = connection.write_buf.Is_Parked() ? 0 : connection.write_buf.Capacity();
+	g.read_high = connection.read_buf.Stats().capacity_high.Get();
+	g.write_high = connection.write_buf.Stats().capacity_high.Get();
+	g.tasks = connection.tasks.Size();
+	g.results = connection.results.Size();
+	g.requests = requests.Size();
+	g.queue_capacity = LockFreeQueue<DecoderTask>::MAX_ITEMS;
+	return g;
+} // end Gauges
+
+
+/**
+ * @brief adds this cell's counters and histograms to into. Nothing is locked
+ *	on the way in; the counters are written by one thread each and read here as
+ *	they stand, so a snapshot taken under load can be a few events behind. Only
+ *	the callback stages are read under their lock.
+ *
+ * @param into where to merge them
+ */
+void NeoCell::Collect_Metrics(NeoMetrics& into)
+{
+	const SubmitCounters& sc = connection.submit_counters;
+	const DecodeCounters& dc = connection.decode_counters;
+	const BufferStats& rs = connection.read_buf.Stats();
+	const BufferStats& ws = connection.write_buf.Stats();
+
+	into.cells++;
+	into.queries += sc.queries.Get();
+	into.failures += dc.failures.Get();
+	into.retries += retries.Get();
+	into.bytes_in += dc.bytes_in.Get();
+	into.bytes_out += sc.bytes_out.Get();
+	into.buffer_grows += rs.grows.Get() + ws.grows.Get();
+	into.buffer_shrinks += rs.shrinks.Get() + ws.shrinks.Get();
+	into.buffer_compactions += rs.compactions.Get() + ws.compactions.Get();
+	into.buffer_bytes_moved += rs.bytes_moved.Get() + ws.bytes_moved.Get();
+	into.recv_pauses += dc.recv_pauses.Get();
+	into.samples += connection.sampler.Sampled();
+	into.samples_dropped += connection.sampler.Dropped();
+	into.tasks_high = std::max(into.tasks_high, sc.tasks_high.Get());
+	into.results_high = std::max(into.results_high, dc.results_high.Get());
+	into.requests_high = std::max(into.requests_high, sc.requests_high.Get());
+	into.buffer_high = std::max({ into.buffer_high, rs.capacity_high.Get(), ws.capacity_high.Get() });
+
+	into.latency.Merge(connection.latencies);
+	into.stages.Merge(connection.stages);
+
+	std::lock_guard<std::mutex> guard(connection.callbacks.lock);
+	into.callback_wait.Merge(connection.callbacks.wait);
+	into.callback_run.Merge(connection.callbacks.run);
+} // end Collect_Metrics
+
+
 /**
  * @brief returns the average latency in milliseconds, aproximately. The latency 
  *	is calculated based on the time it takes for the connection to encode + 
@@ -226,6 +493,7 @@ std::string NeoCell::Get_Last_Error() const
  */
 bool NeoCell::Can_Retry()
 {
+	retries.Add_Shared();
 	if (++retry_count > max_retries)
 	{
 		retry_count = 0;		// reset it
@@ -270,11 +538,11 @@ void NeoCell::Stop()
 		Execute_Command(cmd);
 	} // end if ver 5.1
 
-	// drain all requrests before terminating
-	do {
-		connection.Wait_Task();
-		connection.tasks.Dequeue();
-	} while (!connection.tasks.Is_Empty());
+	// let whatever is in flight drain before terminating; bounded, so a peer
+	//	gone quiet can't hold the shutdown
+	auto deadline = std::chrono::steady_clock::now() + STOP_DRAIN;
+	while (!connection.tasks.Is_Empty() && std::chrono::steady_clock::now() < deadline)
+		connection.Wait_Task(std::chrono::milliseconds(10));
 
 	epoll_ctl(epfd, EPOLL_CTL_DEL, Get_Socket(), nullptr);
 	connection.Terminate();
@@ -288,6 +556,11 @@ void NeoCell::Stop()
 void NeoCell::Clear_Histo()
 {
 	connection.latencies.Clear();
+	connection.stages.Clear();
+
+	std::lock_guard<std::mutex> guard(connection.callbacks.lock);
+	connection.callbacks.wait.Clear();
+	connection.callbacks.run.Clear();
 } // end Clear_Histo
 
 
@@ -315,6 +588,101 @@ void NeoCell::Reset_Read_Buffer()
 } // end Reset_Read_Buffer
 
 
+/**
+ * @brief hands the connection buffers back to the slab when the cell is idle;
+ *	i.e. no requests in flight and every result fetched. Must only be called from
+ *	the polling thread as it owns the read buffer. The write buffer is parked
+ *	unless a submitter is encoding into it just now. Results handed to Fetch()
+ *	point into the read buffer and there's no telling when the user is done with
+ *	them, so a cell that had any keeps its read buffer unless asked to release.
+ *
+ * @param release true when the user asked (Release_Idle_Buffers); results fetched
+ *	earlier from this cell are no longer iterable afterwards
+ *
+ * @return true if the read buffer got parked
+ */
+bool NeoCell::Park_Idle_Buffers(const bool release)
+{
+	if (!connection.tasks.Is_Empty() || !connection.results.Is_Empty())
+		return false;
+
+	connection.Park_Write();
+	if (!release && fetched.load(std::memory_order_acquire))
+		return false;
+
+	if (!connection.read_buf.Park())	// refuses if anything is left unconsumed
+		return false;
+
+	fetched.store(false, std::memory_order_release);
+	return true;
+} // end Park_Idle_Buffers
+
+
+/**
+ * @brief starts capturing every byte the connection sends and receives into
+ *	path, with when and which way, for replaying offline; an empty path stops
+ *	it. Requests already in flight have their responses captured without them,
+ *	so set it before running queries.
+ *
+ * @param path the capture file, truncated
+ *
+ * @return LB_OK on success, alas LB_FAIL with the errno of opening path
+ */
+LBStatus NeoCell::Set_Capture(const std::string& path)
+{
+	if (path.empty())
+	{
+		connection.capture.Close();
+		return LB_Make();
+	} // end if stopping
+
+	return connection.capture.Open(path);
+} // end Set_Capture
+
+
+/**
+ * @brief bytes written to the capture file so far, 0 if never captured
+ */
+u64 NeoCell::Capture_Bytes() const
+{
+	return connection.capture.Bytes();
+} // end Capture_Bytes
+
+
+/**
+ * @brief samples the connection's queries by policy from the next one run on; a
+ *	policy of zeros stops it.
+ *
+ * @param policy the latency threshold and one in n to sample by
+ */
+void NeoCell::Set_Sampler(const SamplePolicy& policy)
+{
+	connection.sampler.Set_Policy(policy);
+} // end Set_Sampler
+
+
+/**
+ * @brief moves the samples taken so far onto the end of out; for one reader at a
+ *	time.
+ *
+ * @return the number of samples taken
+ */
+size_t NeoCell::Take_Samples(std::vector<QuerySample>& out)
+{
+	return connection.sampler.Take(out);
+} // end Take_Samples
+
+
+/**
+ * @brief sets the executor async callbacks are handed to; from the driver,
+ *	before any query runs on the cell.
+ */
+void NeoCell::Set_Executor(CompletionExecutor* pexec)
+{
+	connection.pexec = pexec;
+} // end Set_Executor
+
+
 /**
  * @brief returns a pointer to the current read position in the read buffer.
  *  This is usually called by the decoder loop when it is ready to decode
@@ -385,6 +753,45 @@ LBStatus NeoCell::Poll_Read()
 } // end Poll_Read
 
 
+/**
+ * @brief receives whatever the socket has and decodes every complete message in
+ *	it, until the socket would block or something fails; what's left of a message
+ *	waits for the next readiness. Runs on the thread owning the cell's read
+ *	buffer, the polling thread or the decode worker it's pinned to.
+ *
+ * @return the status that ended it; LB_WAIT/LB_RETRY on a drained socket
+ */
+LBStatus NeoCell::Read_Responses()
+{
+	LBStatus rc = 0;
+	do
+	{
+		rc = Poll_Read();
+		if (!LB_OK(rc))
+			break;	// fail, retry or wait for the next event
+
+		// now begin decoding, if we have a full message
+		rc = Decode_Response(Get_Read_Buffer_Read_Ptr(), LB_Aux(rc));
+		if (!LB_OK(rc))
+		{
+			if (LBAction(LB_Action(rc)) == LBAction::LB_FAIL)
+				break;
+			else if (LBAction(LB_Action(rc)) == LBAction::LB_HASMORE)
+			{
+				Consume_Read_Buffer(LB_Aux(rc));
+				rc = LB_Make();
+				continue;	// keep polling if we have more to decode
+			} // end else if more
+		} // end if decode error
+
+		Consume_Read_Buffer(LB_Aux(rc));
+	} while (LB_OK(rc));
+
+	connection.Flush_Completions();		// one hand over for everything this read completed
+	return rc;
+} // end Read_Responses
+
+
 /**
  * @brief the encoder loop encodes or calls the connection functions based on
  *	the command type info given by CellCommand structure. Once all the rquest_queue
@@ -394,10 +801,12 @@ LBStatus NeoCell::Poll_Read()
 LBStatus NeoCell::Execute_Command(CellCommand& cmd)
 {
 	LBStatus rc = 0;
+	const bool kept = !cmd.cb;	// only Fetch() takes requests off; callbacks never come for theirs
 	switch (cmd.type)
 	{
 	case CellCmdType::Run:
-		rc = connection.Run(cmd.cypher, cmd.param, cmd.extra, cmd.n);
+		rc = connection.Run(cmd.cypher, cmd.param, cmd.extra, cmd.n, std::move(cmd.cb),
+			cmd.visitor);
 		break;
 
 	case CellCmdType::Begin:
@@ -421,7 +830,8 @@ LBStatus NeoCell::Execute_Command(CellCommand& cmd)
 		return LB_Make(LBAction::LB_FAIL);
 	} // end switch
 
-	if (LB_OK(rc)) requests.Enqueue(std::move(cmd));
+	if (LB_OK(rc) && kept && requests.Enqueue(std::move(cmd)))
+		connection.submit_counters.requests_high.Max(requests.Size());
 	return rc;
 } // end Write_Loop
 
@@ -457,9 +867,31 @@ LBStatus NeoCell::Decode_Response(u8* ptr, const size_t bytes)
 		if (!task.has_value())
 			return LBOK_INFO(total_decode);		// treat as done.
 
+		if (!task->get().stamps[QueryStage::First_Byte])	// its response starts in this recv
+			task->get().stamps.Stamp(QueryStage::First_Byte, connection.last_recv_ns);
+
 		task->get().view.cursor = ptr;			// set the cursor to the start of the buffer
 		task->get().view.size = total_decode;	// set the size to the number of bytes received
 
+		if (task->get().visitor && (task->get().state == TaskState::Pull ||
+			task->get().state == TaskState::Record))
+		{
+			// records go to the visitor as they come, whole or not
+			rc = connection.Decode_Stream(task->get(), ptr, total_decode - decoded);
+			if (LBAction(LB_Action(rc)) == LBAction::LB_HASMORE)
+			{
+				decoded += LB_Aux(rc);
+				leftover_bytes = total_decode - decoded;
+				return LB_Make(LBAction::LB_HASMORE, LBDomain::LB_DOM_BOLT,
+					LBStage::LB_STAGE_DECODEING_TASK, LBCode::LB_CODE_NONE, decoded);
+			} // end if all fed
+			if (!LB_OK(rc)) return rc;
+
+			decoded += LB_Aux(rc);	// stopped in front of the summary or a failure
+			ptr += LB_Aux(rc);
+			task->get().view.cursor = ptr;
+		} // end if streaming
+
 		rc = connection.Can_Decode(ptr, total_decode - decoded);
 		if (!LB_OK(rc))
 		{
@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 17th of January 2026, Saturday.
- * @date @date updated 4th of March 2026, Wednesday.
+ * @date updated 16th of October 2026, Friday.
  */
 
 
@@ -26,9 +26,16 @@
 //===============================================================================|
 /**
  * @brief constructor
+ *
+ * @param urls the connection string
+ * @param auth authentication token
+ * @param extras extra connection parameters
+ * @param pool_size_ the number of connections
+ * @param decode_workers_ threads connections are received and decoded on, each
+ *	pinned to one of them; 0 to do it all on the polling thread
  */
 NeoDriver::NeoDriver(const std::string& urls, BoltValue auth, BoltValue extras,
-	const int pool_size_)
+	const int pool_size_, const int decode_workers_)
 	: _urls(urls), _auth(std::move(auth)), pool(nullptr),
 	pool_size(pool_size_ <= 0 ? POOL_SIZE : pool_size_)
 {
@@ -46,7 +53,10 @@ NeoDriver::NeoDriver(const std::string& urls, BoltValue auth, BoltValue extras,
 
 	// create epoll instance for polling
 	epfd = epoll_create1(0);	// no flags, no checks
-	pool = new NeoCellPool(epfd, pool_size, _urls, &_auth, &_extras);
+	pool = new NeoCellPool(epfd, pool_size, _urls, &_auth, &_extras, &slab);
+	decoders.Start(std::min(decode_workers_, pool_size), pool->Workers(), &slab);
+	for (auto& w : pool->Workers())
+		w->Set_Executor(&completions);
 
 	// start the polling thread
 	looping.store(true, std::memory_order_release);
@@ -84,7 +94,7 @@ NeoDriver::~NeoDriver()
  * 
  * @return LB_OK on success, alas LB_FAIL.
  */
-LBStatus NeoDriver::Execute_Async(std::function<void(BoltResult&)> cb, const char* query, 
+LBStatus NeoDriver::Execute_Async(ResultCallback cb, const char* query, 
 	BoltValue&& params, BoltValue&& extra)
 {
 	// get the next instance from the pool, and execute on that
@@ -96,11 +106,14 @@ LBStatus NeoDriver::Execute_Async(std::function<void(BoltResult&)> cb, const cha
 	);
 
 	// make sure its connected first, if not connect
-	LBStatus rc = pcell->Start_Session(++next_client_id);
-	if (!LB_OK(rc)) return rc;
+	if (!pcell->Is_Connected())
+	{
+		LBStatus rc = pcell->Start_Session(++next_client_id);
+		if (!LB_OK(rc)) return rc;
+	} // end if not connected
 
 	// just pass to pool
-	return pcell->Run_Async(cb, query, std::move(params), std::move(extra));
+	return pcell->Run_Async(std::move(cb), query, std::move(params), std::move(extra));
 } // end Execute_Async
 
 
@@ -123,8 +136,44 @@ LBStatus NeoDriver::Execute(const char* query, BoltValue&& params,
 } // end Execute
 
 
+/**
+ * @brief executes a query whose records are handed to visitor as they are being
+ *	received (on the polling thread) instead of being buffered for Fetch(); for
+ *	results too large to hold, or records of many MiB. Completion is as with
+ *	Execute_Async(), the result carrying the record count and summary only.
+ *
+ * @param visitor receives the records; must outlive the query
+ * @param cb optional callback on completion; Fetch() otherwise
+ * @param query the query to execute.
+ * @param params parameters for cypher query above
+ * @param extra info for cypher like r/w, db name, bookmarks etc.
+ *
+ * @return LB_OK on success, alas LB_FAIL.
+ */
+LBStatus NeoDriver::Execute_Streamed(BoltVisitor* visitor, ResultCallback cb,
+	const char* query, BoltValue&& params, BoltValue&& extra)
+{
+	NeoCell* pcell = pool->Acquire();
+	if (!pcell) return LB_Make(
+		LBAction::LB_FAIL,
+		LBDomain::LB_DOM_STATE,
+		LBStage::LB_STAGE_QUERY
+	);
+
+	if (!pcell->Is_Connected())
+	{
+		LBStatus rc = pcell->Start_Session(++next_client_id);
+		if (!LB_OK(rc)) return rc;
+	} // end if not connected
+
+	return pcell->Run_Streamed(visitor, std::move(cb), query, std::move(params), std::move(extra));
+} // end Execute_Streamed
+
+
 void NeoDriver::Close()
 {
+	exporter.Stop();	// it reads the cells
+
 	u64 my_exit = 1;
 	exit_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 
@@ -137,6 +186,8 @@ void NeoDriver::Close()
 	pool->Stop();
 	write(exit_fd, &my_exit, sizeof(my_exit));
 	if (poll_thread.joinable()) poll_thread.join();
+	decoders.Stop();	// after the cells, they need them to log off
+	completions.Stop();	// runs callbacks still queued
 
 	CLOSE(exit_fd);
 	CLOSE(epfd);
@@ -155,6 +206,16 @@ int NeoDriver::Get_Pool_Size() const
 } // end Get_Pool_Size
 
 
+/**
+ * @brief the number of decode workers running; 0 when the polling thread
+ *	decodes everything itself
+ */
+int NeoDriver::Get_Decode_Workers() const
+{
+	return decoders.Size();
+} // end Get_Decode_Workers
+
+
 std::string NeoDriver::Get_Last_Error() const
 {
 	LBDomain domain = LBDomain(LB_Domain(last_rc));
@@ -192,11 +253,327 @@ NeoCellPool* NeoDriver::Get_Pool()
 } // end Get_Pool
 
 
+/**
+ * @brief returns a snapshot of the buffer slab counters; bytes reserved, in use,
+ *	idle, the high water mark and borrow/return/reject counts.
+ */
+SlabStats NeoDriver::Buffer_Stats() const
+{
+	return slab.Stats();
+} // end Buffer_Stats
+
+
+/**
+ * @brief caps the total bytes all connection buffers together may hold. Buffers
+ *	that can't borrow under the cap fail their request with an LB_DOM_MEMORY
+ *	status instead of growing the process.
+ *
+ * @param bytes the new cap
+ */
+void NeoDriver::Set_Buffer_Cap(const size_t bytes)
+{
+	slab.Set_Cap(bytes);
+} // end Set_Buffer_Cap
+
+
+/**
+ * @brief soft limits, as opposed to the cap nothing is refused past them. With
+ *	more than buffer_bytes lent out to connection buffers, the polling thread
+ *	parks idle cells' buffers every TRIM_INTERVAL_NS and trims the slab, and
+ *	buffers parked meanwhile drop back to their smallest size. Read buffers of
+ *	cells results were fetched from are left alone, those results pointing into
+ *	them; only Release_Idle_Buffers() parks those. A thread's BoltPool
+ *	holding more than pool_bytes trims itself the next time a query it encoded
+ *	releases its values; the pools being thread-local that goes for every thread
+ *	in the process, not this driver's alone. 0 for no limit.
+ *
+ * @param buffer_bytes limit on the bytes all connection buffers hold
+ * @param pool_bytes limit on the bytes any one thread's BoltPool holds
+ */
+void NeoDriver::Set_Memory_Limit(const size_t buffer_bytes, const size_t pool_bytes)
+{
+	slab.Set_Limit(buffer_bytes);
+	BoltPool<BoltValue>::Set_Limit(pool_bytes);
+} // end Set_Memory_Limit
+
+
+/**
+ * @brief sets how buffer blocks get their pages from here on; heap, first-touch
+ *	mappings or huge pages. A policy without a node is bound to the node the poll
+ *	thread (the reactor decoding all responses) runs on, if known, so receive
+ *	buffers stay local to the decoder. Pin the process (i.e. numactl) for that
+ *	node to stay meaningful.
+ *
+ * @param policy the page policy and optional NUMA node
+ */
+void NeoDriver::Set_Memory_Policy(MemPolicy policy)
+{
+	if (policy.pages != PagePolicy::Heap && policy.node < 0)
+		policy.node = reactor_node.load(std::memory_order_acquire);
+
+	slab.Set_Policy(policy);
+} // end Set_Memory_Policy
+
+
+/**
+ * @brief asks the polling thread to hand the read buffers of idle connections back
+ *	to the slab and release idle slab blocks to the system. Done at the next poll
+ *	wake (within a second); results fetched earlier from idle connections are no
+ *	longer iterable afterwards.
+ */
+void NeoDriver::Release_Idle_Buffers()
+{
+	park_idle.store(true, std::memory_order_release);
+} // end Release_Idle_Buffers
+
+
+/**
+ * @brief sets where Execute_Async callbacks run; inline on the thread decoding
+ *	the connection (the default), on a pool of threads of the driver's own, or
+ *	handed to a submit function of the user's (i.e. an event loop). The latter two
+ *	get callbacks in batches, one per read. A pool of more than one thread may run
+ *	callbacks of the same connection out of order. Set it before running queries.
+ *
+ * @param policy the mode with the pool size or submit function
+ */
+void NeoDriver::Set_Executor(ExecPolicy policy)
+{
+	completions.Set_Policy(std::move(policy));
+} // end Set_Executor
+
+
+/**
+ * @brief a snapshot of how long callbacks waited for the executor, from their
+ *	result being complete to the callback starting; empty when inline.
+ */
+LatencyHistogram NeoDriver::Callback_Delay() const
+{
+	return completions.Delay();
+} // end Callback_Delay
+
+
+/**
+ * @brief a driver wide snapshot; every cell's counters summed, their queue
+ *	high-water marks maxed and their latency histograms merged, on the calling
+ *	thread. Cells write their own counters without locks; see
+ *	NeoCell::Collect_Metrics(). Empty once closed.
+ */
+NeoMetrics NeoDriver::Metrics()
+{
+	NeoMetrics m;
+	if (!pool) return m;
+
+	for (auto& w : pool->Workers())
+		w->Collect_Metrics(m);
+	return m;
+} // end Metrics
+
+
+/**
+ * @brief the driver's metrics in the OpenMetrics text format; Metrics() along
+ *	with every cell's gauges, the buffer slab's and the callback delay. Served
+ *	by the exporter, see Set_Exporter(), or for the caller to ship elsewhere.
+ */
+std::string NeoDriver::OpenMetrics()
+{
+	NeoMetrics m = Metrics();
+	SlabStats slab_stats = slab.Stats();
+	OpenMetricsWriter w;
+
+	w.Counter("lightningbolt_queries", "RUN messages queued.", m.queries);
+	w.Counter("lightningbolt_failures", "FAILURE responses received.", m.failures);
+	w.Counter("lightningbolt_retries", "Reconnects and resends tried.", m.retries);
+	w.Counter("lightningbolt_received_bytes", "Bytes received from the server.", m.bytes_in, "bytes");
+	w.Counter("lightningbolt_sent_bytes", "Bytes sent to the server.", m.bytes_out, "bytes");
+	w.Counter("lightningbolt_buffer_grows", "Connection buffers grown.", m.buffer_grows);
+	w.Counter("lightningbolt_buffer_shrinks", "Connection buffers shrunk.", m.buffer_shrinks);
+	w.Counter("lightningbolt_buffer_compactions", "Connection buffers compacted.", m.buffer_compactions);
+	w.Counter("lightningbolt_buffer_moved_bytes", "Bytes copied growing, shrinking and compacting buffers.",
+		m.buffer_bytes_moved, "bytes");
+	w.Counter("lightningbolt_recv_pauses", "Times recv stopped on a full read buffer.", m.recv_pauses);
+	w.Counter("lightningbolt_query_samples", "Queries sampled by the slow query sampler.", m.samples);
+	w.Counter("lightningbolt_query_samples_dropped", "Query samples dropped on a full ring.", m.samples_dropped);
+	w.Counter("lightningbolt_slab_cap_rejects", "Buffer borrows refused by the slab cap.",
+		slab_stats.cap_rejects);
+
+	w.Gauge("lightningbolt_queue_high_water", "Deepest any cell's queue got, by queue.");
+	w.Sample("lightningbolt_queue_high_water", "queue=\"tasks\"", double(m.tasks_high));
+	w.Sample("lightningbolt_queue_high_water", "queue=\"results\"", double(m.results_high));
+	w.Sample("lightningbolt_queue_high_water", "queue=\"requests\"", double(m.requests_high));
+
+	w.Gauge("lightningbolt_slab_bytes", "Bytes of the buffer slab, by state.", "bytes");
+	w.Sample("lightningbolt_slab_bytes", "state=\"cap\"", double(slab_stats.cap_bytes));
+	w.Sample("lightningbolt_slab_bytes", "state=\"limit\"", double(slab_stats.limit_bytes));
+	w.Sample("lightningbolt_slab_bytes", "state=\"reserved\"", double(slab_stats.reserved_bytes));
+	w.Sample("lightningbolt_slab_bytes", "state=\"in_use\"", double(slab_stats.in_use_bytes));
+	w.Sample("lightningbolt_slab_bytes", "state=\"high_water\"", double(slab_stats.high_water_bytes));
+
+	// per cell; where a stall or a saturated queue shows before latency does
+	std::vector<CellGauges> cells;
+	if (pool)
+		for (auto& c : pool->Workers())
+			cells.push_back(c->Gauges());
+
+	auto per_cell = [&](const char* name, const char* help, const char* unit, auto value) {
+		w.Gauge(name, help, unit);
+		for (auto& g : cells)
+			w.Sample(name, "cell=\"" + std::to_string(g.client_id) + "\"", double(value(g)));
+	};
+	per_cell("lightningbolt_cell_connected", "1 while the cell's connection is open.", nullptr,
+		[](const CellGauges& g) { return g.connected; });
+	per_cell("lightningbolt_cell_recv_paused", "1 while recv is stopped on a full read buffer.", nullptr,
+		[](const CellGauges& g) { return g.recv_paused; });
+	per_cell("lightningbolt_cell_read_buffer_capacity_bytes", "Read buffer storage, 0 while parked.", "bytes",
+		[](const CellGauges& g) { return g.read_capacity; });
+	per_cell("lightningbolt_cell_read_buffer_used_bytes", "Received bytes not yet consumed.", "bytes",
+		[](const CellGauges& g) { return g.read_bytes; });
+	per_cell("lightningbolt_cell_write_buffer_capacity_bytes", "Write buffer storage, 0 while parked.", "bytes",
+		[](const CellGauges& g) { return g.write_capacity; });
+	per_cell("lightningbolt_cell_read_buffer_high_water_bytes", "The most read buffer storage held.", "bytes",
+		[](const CellGauges& g) { return g.read_high; });
+	per_cell("lightningbolt_cell_write_buffer_high_water_bytes", "The most write buffer storage held.", "bytes",
+		[](const CellGauges& g) { return g.write_high; });
+	per_cell("lightningbolt_cell_tasks", "Pipelined tasks awaiting responses.", nullptr,
+		[](const CellGauges& g) { return g.tasks; });
+	per_cell("lightningbolt_cell_results", "Results awaiting Fetch().", nullptr,
+		[](const CellGauges& g) { return g.results; });
+	per_cell("lightningbolt_cell_queue_capacity", "Most a cell's task or result queue holds.", nullptr,
+		[](const CellGauges& g) { return g.queue_capacity; });
+
+	w.Histogram("lightningbolt_query_latency_seconds", "Submit to final SUCCESS.");
+	w.Buckets("lightningbolt_query_latency_seconds", "", m.latency);
+
+	w.Histogram("lightningbolt_query_stage_seconds", "Time from the stage before to this one.");
+	for (int i = 1; i < QUERY_STAGE_COUNT; i++)
+		w.Buckets("lightningbolt_query_stage_seconds",
+			"stage=\"" + std::string(StageLatencies::Name(QueryStage(i))) + "\"", m.stages.stage[i]);
+	w.Buckets("lightningbolt_query_stage_seconds", "stage=\"callback_wait\"", m.callback_wait);
+	w.Buckets("lightningbolt_query_stage_seconds", "stage=\"callback_run\"", m.callback_run);
+
+	w.Histogram("lightningbolt_callback_delay_seconds", "Result complete to an executor running its callback.");
+	w.Buckets("lightningbolt_callback_delay_seconds", "", completions.Delay());
+
+	return w.Finish();
+} // end OpenMetrics
+
+
+/**
+ * @brief starts exporting OpenMetrics() as the policy says; on a local Unix
+ *	socket, a loopback HTTP endpoint or into a file every period, from the
+ *	exporter's own thread. ExportMode::None stops it.
+ *
+ * @param policy where to and how often
+ *
+ * @return LB_OK on success, alas LB_FAIL with the socket's or file's errno
+ */
+LBStatus NeoDriver::Set_Exporter(ExportPolicy policy)
+{
+	return exporter.Start(std::move(policy), [this] { return OpenMetrics(); });
+} // end Set_Exporter
+
+
+/**
+ * @brief the port the HTTP exporter listens on, 0 if none
+ */
+u16 NeoDriver::Exporter_Port() const
+{
+	return exporter.Port();
+} // end Exporter_Port
+
+
+/**
+ * @brief captures every cell's traffic into a file of its own, prefix.<cell>.lbwire,
+ *	for replaying offline with lbreplay; an empty prefix stops capturing. Set it
+ *	before running queries, as with Set_Executor().
+ *
+ * @param prefix path the cells' files start with
+ *
+ * @return LB_OK on success, alas the status of the first file that failed to open
+ */
+LBStatus NeoDriver::Set_Capture(const std::string& prefix)
+{
+	if (!pool) return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE);
+
+	const auto& cells = pool->Workers();
+	for (size_t i = 0; i < cells.size(); i++)
+	{
+		LBStatus rc = cells[i]->Set_Capture(prefix.empty() ? prefix :
+			prefix + "." + std::to_string(i) + ".lbwire");
+		if (!LB_OK(rc)) return rc;
+	} // end for
+
+	return LB_Make();
+} // end Set_Capture
+
+
+/**
+ * @brief samples queries slower than policy.threshold, submit to final SUCCESS,
+ *	and one in every policy.one_in besides, on every cell; their text, parameter
+ *	and result sizes, the server's t_first and t_last and stage stamps are kept
+ *	for Take_Samples(). Zeros stop it. Set it before running queries, as with
+ *	Set_Executor().
+ *
+ * @param policy the threshold and one in n to sample by
+ */
+void NeoDriver::Set_Sampler(SamplePolicy policy)
+{
+	if (!pool) return;
+	for (const auto& cell : pool->Workers())
+		cell->Set_Sampler(policy);
+} // end Set_Sampler
+
+
+/**
+ * @brief moves the samples every cell took so far onto the end of out; each
+ *	cell holds SAMPLE_RING_SIZE at most, those past it are dropped and counted
+ *	so take them often enough.
+ *
+ * @return the number of samples taken
+ */
+size_t NeoDriver::Take_Samples(std::vector<QuerySample>& out)
+{
+	if (!pool) return 0;
+
+	std::lock_guard<std::mutex> guard(sample_lock);
+	size_t n = 0;
+	for (const auto& cell : pool->Workers())
+		n += cell->Take_Samples(out);
+	return n;
+} // end Take_Samples
+
+
+/**
+ * @brief parks the buffers of every idle cell and trims the slab; runs on the
+ *	polling thread as that's the one owning read buffers, or passes it on to the
+ *	decode workers when they do.
+ *
+ * @param release true when the user asked; read buffers results were fetched
+ *	from get parked too
+ */
+void NeoDriver::Park_Idle(const bool release)
+{
+	if (decoders.Size())
+	{
+		decoders.Park_Idle(release);	// the workers own the read buffers
+		return;
+	} // end if decode workers
+
+	for (auto& w : pool->Workers())
+		w->Park_Idle_Buffers(release);
+
+	slab.Trim();
+} // end Park_Idle
+
+
 void NeoDriver::Poll_Read()
 {
+	reactor_node.store(PageAlloc::Current_Node(), std::memory_order_release);
+	s64 next_trim = 0;		// when next to park for being over the memory limit
 	while (looping.load(std::memory_order_acquire))
 	{
 		int nfds = epoll_wait(epfd, events, MAX_EVENTS, 1000); // 1 second timeout
+		if (park_idle.exchange(false, std::memory_order_acq_rel))
+			Park_Idle(true);
 		for (int n = 0; n < nfds; ++n)
 		{
 			NeoCell* pcell = static_cast<NeoCell*>(events[n].data.ptr);
@@ -210,44 +587,23 @@ void NeoDriver::Poll_Read()
 					break;
 				}
 
-				// ready to read, read it in and push task to decoder
-				LBStatus rc = 0;
-				do
-				{
-					rc = pcell->Poll_Read();
-					if (!LB_OK(rc))
-					{
-						if (LBAction(LB_Action(rc)) == LBAction::LB_FAIL)
-						{
-							break;
-						} // end if fail
-						else if (LBAction(LB_Action(rc)) == LBAction::LB_RETRY)
-						{
-							break;
-						} // end else
-						else break; // LB_WAIT or other non-fatal, non-retryable errors, just wait for next event
-					} // end if error
-
-
-					// now begin decoding, if we have a full message
-					rc = pcell->Decode_Response(pcell->Get_Read_Buffer_Read_Ptr(), LB_Aux(rc));
-					if (!LB_OK(rc))
-					{
-						if (LBAction(LB_Action(rc)) == LBAction::LB_FAIL)
-						{
-							break;
-						} // end if fail
-						else if (LBAction(LB_Action(rc)) == LBAction::LB_HASMORE)
-						{
-							pcell->Consume_Read_Buffer(LB_Aux(rc));
-							rc = LB_Make();
-							continue;	// keep polling if we have more to decode
-						} // end else
-					} // end if decode error
-
-					pcell->Consume_Read_Buffer(LB_Aux(rc));
-				} while (LB_OK(rc));
+				// hand it to its decode worker, alas read and decode it here
+				if (decoders.Size())
+					decoders.Post(pcell);
+				else
+					pcell->Read_Responses();
 			} // end if readable
 		} // end for nfds
+
+		// over the soft limit; whoever went idle just now gives its buffers back
+		if (slab.Over_Limit() && looping.load(std::memory_order_relaxed))
+		{
+			const s64 now = StageStamps::Now();
+			if (now >= next_trim)
+			{
+				next_trim = now + TRIM_INTERVAL_NS;
+				Park_Idle(false);	// leaves be what Fetch() handed out
+			} // end if due
+		} // end if over limit
 	} // end while looping
 } // end Poll_Read
\ No newline at end of file
@@ -69,6 +69,8 @@ LBStatus LB_Handle_Status(LBStatus status, NeoCell* pcell)
 		break;
 	case LBAction::LB_FAIL:
 		pcell->err_desc = LB_Error_String(status);
+		if (domain == LBDomain::LB_DOM_STATE && code == u16(LBCode::LB_CODE_TASKSTATE))
+			break;	// a call out of turn, e.g. mid batched query; the cell is fine
 		pcell->Stop();
 		break;
 	default:
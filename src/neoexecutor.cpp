@@ -0,0 +1,200 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neoexecutor.h"
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief runs whatever is still queued and joins the pool threads
+ */
+CompletionExecutor::~CompletionExecutor()
+{
+	Stop();
+} // end destructor
+
+
+/**
+ * @brief switches where callbacks run from here on; a pool being replaced is
+ *	drained first. Meant to be set before queries are in flight.
+ *
+ * @param policy the mode, pool threads or submit function
+ */
+void CompletionExecutor::Set_Policy(ExecPolicy policy)
+{
+	Stop();
+
+	if (policy.mode == ExecMode::Submit && !policy.submit)
+		policy.mode = ExecMode::Inline;		// nothing to submit to
+
+	submit = std::move(policy.submit);
+	if (policy.mode == ExecMode::Pool)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = false;
+		for (int i = 0; i < std::max(policy.threads, 1); i++)
+			threads.emplace_back(&CompletionExecutor::Pool_Loop, this);
+	} // end if pool
+
+	mode.store(policy.mode, std::memory_order_release);
+} // end Set_Policy
+
+
+/**
+ * @brief the current mode; connections check it on every completion
+ */
+ExecMode CompletionExecutor::Mode() const
+{
+	return mode.load(std::memory_order_acquire);
+} // end Mode
+
+
+/**
+ * @brief hands a batch of completions over; to a pool thread, the user's submit
+ *	or, inline, runs it right here.
+ *
+ * @param batch the callbacks with their results; moved from
+ */
+void CompletionExecutor::Submit(CompletionBatch&& batch)
+{
+	if (batch.empty()) return;
+
+	switch (mode.load(std::memory_order_acquire))
+	{
+	case ExecMode::Pool:
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		if (!stopping && !threads.empty())
+		{
+			batches.push_back(std::move(batch));
+			guard.unlock();
+			ready.notify_one();
+			return;
+		} // end if running
+		break;	// stopped; run it here
+	} // end case pool
+
+	case ExecMode::Submit:
+		submit([this, b = std::move(batch)]() mutable { Run(b); });
+		return;
+
+	default:
+		break;
+	} // end switch
+
+	Run(batch);
+} // end Submit
+
+
+/**
+ * @brief runs the batches still queued and joins the pool threads; callbacks
+ *	from here on run inline until a policy is set again.
+ */
+void CompletionExecutor::Stop()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	ready.notify_all();
+
+	for (auto& t : threads)
+		if (t.joinable()) t.join();
+	threads.clear();
+
+	mode.store(ExecMode::Inline, std::memory_order_release);
+} // end Stop
+
+
+/**
+ * @brief a snapshot of the queueing delay; from a result being complete to its
+ *	callback starting
+ */
+LatencyHistogram CompletionExecutor::Delay() const
+{
+	std::lock_guard<std::mutex> guard(stats_lock);
+	return delay;
+} // end Delay
+
+
+/**
+ * @brief clears the queueing delay histogram
+ */
+void CompletionExecutor::Clear_Delay()
+{
+	std::lock_guard<std::mutex> guard(stats_lock);
+	delay.Clear();
+} // end Clear_Delay
+
+
+/**
+ * @brief runs every callback in the batch in the order they completed; the
+ *	delays are recorded under one lock for the whole batch, and so are the
+ *	callback stages of the connection it came from.
+ */
+void CompletionExecutor::Run(CompletionBatch& batch)
+{
+	LatencyHistogram::duration waited[COMPLETION_BATCH];
+	s64 done[COMPLETION_BATCH], started[COMPLETION_BATCH], ended[COMPLETION_BATCH];
+	size_t n = 0;
+
+	for (auto& c : batch)
+	{
+		if (n < COMPLETION_BATCH)
+		{
+			waited[n] = LatencyHistogram::clock::now() - c.queued;
+			done[n] = c.done_ns;
+			started[n] = StageStamps::Now();
+		} // end if room
+
+		LB_PROBE3(callback, c.result.client_id, c.result.message_count, c.done_ns);
+		c.cb(c.result);
+		if (n < COMPLETION_BATCH) ended[n++] = StageStamps::Now();
+	} // end for
+
+	// a batch is one connection's; its stages recorded in runs to be sure
+	for (size_t i = 0, j = 0; i < n; i = j)
+	{
+		for (j = i + 1; j < n && batch[j].stages == batch[i].stages; j++);
+		if (batch[i].stages)
+			batch[i].stages->Record(done + i, started + i, ended + i, j - i);
+	} // end for
+
+	std::lock_guard<std::mutex> guard(stats_lock);
+	for (size_t i = 0; i < n; i++)
+		delay.Record_Latency(waited[i]);
+} // end Run
+
+
+/**
+ * @brief a pool thread; takes a whole batch at a time until stopped and
+ *	nothing is left
+ */
+void CompletionExecutor::Pool_Loop()
+{
+	while (true)
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		ready.wait(guard, [this] { return stopping || !batches.empty(); });
+		if (batches.empty()) return;	// stopping and drained
+
+		CompletionBatch batch = std::move(batches.front());
+		batches.pop_front();
+		guard.unlock();
+
+		Run(batch);
+	} // end while
+} // end Pool_Loop
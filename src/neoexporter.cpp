@@ -0,0 +1,499 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "neoexporter.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+// histogram bucket bounds in nanoseconds; 10 us to 10 s, 1-2.5-5 steps
+constexpr u64 BUCKET_BOUNDS_NS[] = {
+    10'000, 25'000, 50'000, 100'000, 250'000, 500'000,
+    1'000'000, 2'500'000, 5'000'000, 10'000'000, 25'000'000, 50'000'000,
+    100'000'000, 250'000'000, 500'000'000, 1'000'000'000, 2'500'000'000, 5'000'000'000,
+    10'000'000'000
+};
+constexpr size_t BUCKET_COUNT = sizeof(BUCKET_BOUNDS_NS) / sizeof(BUCKET_BOUNDS_NS[0]);
+
+constexpr int REQUEST_WAIT_MS = 1'000;      // a scraper gets this long to send its request
+constexpr size_t MAX_REQUEST = 8'192;
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief writes a counter family and its one sample
+ *
+ * @param name the family name, without _total
+ * @param help a line on what it counts
+ * @param value the count
+ * @param unit optional unit the name ends in, i.e. bytes
+ */
+void OpenMetricsWriter::Counter(const char* name, const char* help, const u64 value, const char* unit)
+{
+    Family(name, "counter", help, unit);
+    out += name;
+    out += "_total ";
+    out += std::to_string(value);
+    out += '\n';
+} // end Counter
+
+
+/**
+ * @brief starts a gauge family; its samples follow via Sample()
+ */
+void OpenMetricsWriter::Gauge(const char* name, const char* help, const char* unit)
+{
+    Family(name, "gauge", help, unit);
+} // end Gauge
+
+
+/**
+ * @brief writes a sample of the family just started
+ *
+ * @param name the sample name
+ * @param labels the labels without braces, i.e. cell="3"; empty for none
+ * @param value the value
+ */
+void OpenMetricsWriter::Sample(const char* name, const std::string& labels, const double value)
+{
+    char num[32];
+    snprintf(num, sizeof(num), "%.9g", value);
+
+    out += name;
+    if (!labels.empty())
+    {
+        out += '{';
+        out += labels;
+        out += '}';
+    } // end if labeled
+    out += ' ';
+    out += num;
+    out += '\n';
+} // end Sample
+
+
+/**
+ * @brief starts a histogram family in seconds; its histograms follow via
+ *  Buckets()
+ */
+void OpenMetricsWriter::Histogram(const char* name, const char* help)
+{
+    Family(name, "histogram", help, "seconds");
+} // end Histogram
+
+
+/**
+ * @brief writes a LatencyHistogram as cumulative buckets over BUCKET_BOUNDS_NS,
+ *  +Inf, _sum and _count
+ *
+ * @param name the family name
+ * @param labels its labels besides le; empty for none
+ * @param h the histogram
+ */
+void OpenMetricsWriter::Buckets(const char* name, const std::string& labels, const LatencyHistogram& h)
+{
+    u64 counts[BUCKET_COUNT];
+    h.Cumulative(BUCKET_BOUNDS_NS, BUCKET_COUNT, counts);
+    Buckets(name, labels, counts, h.samples, h.total_latency.count() / 1e9);
+} // end Buckets
+
+
+/**
+ * @brief likewise for a StageHistogram
+ */
+void OpenMetricsWriter::Buckets(const char* name, const std::string& labels, const StageHistogram& h)
+{
+    u64 counts[BUCKET_COUNT];
+    h.Cumulative(BUCKET_BOUNDS_NS, BUCKET_COUNT, counts);
+    Buckets(name, labels, counts, h.samples, h.total_latency.count() / 1e9);
+} // end Buckets
+
+
+/**
+ * @brief writes the cumulative counts over BUCKET_BOUNDS_NS, +Inf, _sum and
+ *  _count of either histogram
+ *
+ * @param counts BUCKET_COUNT of them
+ * @param samples all of them, for +Inf and _count
+ * @param sum of the samples, in seconds
+ */
+void OpenMetricsWriter::Buckets(const char* name, const std::string& labels, const u64* counts,
+    const u64 samples, const double sum)
+{
+    std::string bucket = std::string(name) + "_bucket";
+    std::string sep = labels.empty() ? "" : labels + ",";
+    char le[32];
+    for (size_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        snprintf(le, sizeof(le), "%g", BUCKET_BOUNDS_NS[i] / 1e9);
+        Sample(bucket.c_str(), sep + "le=\"" + le + "\"", double(counts[i]));
+    } // end for
+    Sample(bucket.c_str(), sep + "le=\"+Inf\"", double(samples));
+
+    Sample((std::string(name) + "_sum").c_str(), labels, sum);
+    Sample((std::string(name) + "_count").c_str(), labels, double(samples));
+} // end Buckets
+
+
+/**
+ * @brief ends the text and hands it over; the writer is empty again
+ */
+std::string OpenMetricsWriter::Finish()
+{
+    out += "# EOF\n";
+    return std::move(out);
+} // end Finish
+
+
+/**
+ * @brief the TYPE, UNIT and HELP lines starting a family
+ */
+void OpenMetricsWriter::Family(const char* name, const char* type, const char* help, const char* unit)
+{
+    out += "# TYPE ";
+    out += name;
+    out += ' ';
+    out += type;
+    out += '\n';
+
+    if (unit)
+    {
+        out += "# UNIT ";
+        out += name;
+        out += ' ';
+        out += unit;
+        out += '\n';
+    } // end if unit
+
+    out += "# HELP ";
+    out += name;
+    out += ' ';
+    out += help;
+    out += '\n';
+} // end Family
+
+
+
+//===============================================================================|
+/**
+ * @brief stops serving
+ */
+MetricsExporter::~MetricsExporter()
+{
+    Stop();
+} // end destructor
+
+
+/**
+ * @brief starts exporting as the policy says, replacing whatever was before;
+ *  the listener is set up here so a bad path or a taken port is known at once.
+ *  A file gets its first dump right away.
+ *
+ * @param policy where to and how often
+ * @param render makes the text to serve
+ *
+ * @return LB_OK on success, LB_FAIL with LB_DOM_STATE on a policy without a
+ *  path, or LB_DOM_SYS with errno when the socket or file can't be had
+ */
+LBStatus MetricsExporter::Start(ExportPolicy new_policy, RenderFn new_render)
+{
+    Stop();
+    policy = std::move(new_policy);
+    render = std::move(new_render);
+    if (policy.mode == ExportMode::None || !render)
+        return LB_Make();
+
+    if ((policy.mode == ExportMode::Unix_Socket || policy.mode == ExportMode::File) && policy.path.empty())
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE);
+
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd < 0)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+
+    LBStatus rc = LB_Make();
+    switch (policy.mode)
+    {
+    case ExportMode::Unix_Socket:
+        rc = Listen_Unix();
+        break;
+
+    case ExportMode::Http:
+        rc = Listen_Http();
+        break;
+
+    default:
+        if (!Dump_File())
+            rc = LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+                LBCode::LB_CODE_NONE, errno);
+        break;
+    } // end switch
+
+    if (!LB_OK(rc))
+    {
+        Stop();
+        return rc;
+    } // end if no listener
+
+    thread = policy.mode == ExportMode::File ? std::thread(&MetricsExporter::File_Loop, this)
+        : std::thread(&MetricsExporter::Serve_Loop, this);
+    return rc;
+} // end Start
+
+
+/**
+ * @brief wakes the thread, joins it and closes the listener; a Unix socket's
+ *  path is removed
+ */
+void MetricsExporter::Stop()
+{
+    if (thread.joinable())
+    {
+        u64 one = 1;
+        write(wake_fd, &one, sizeof(one));
+        thread.join();
+    } // end if running
+
+    if (listen_fd >= 0)
+    {
+        CLOSE(listen_fd);
+        listen_fd = -1;
+        if (policy.mode == ExportMode::Unix_Socket)
+            unlink(policy.path.c_str());
+    } // end if listening
+
+    if (wake_fd >= 0)
+    {
+        CLOSE(wake_fd);
+        wake_fd = -1;
+    } // end if wake
+    bound_port = 0;
+} // end Stop
+
+
+/**
+ * @brief where metrics are going
+ */
+ExportMode MetricsExporter::Mode() const
+{
+    return wake_fd < 0 ? ExportMode::None : policy.mode;
+} // end Mode
+
+
+/**
+ * @brief the HTTP port listened on; the one picked when asked for 0
+ */
+u16 MetricsExporter::Port() const
+{
+    return bound_port;
+} // end Port
+
+
+/**
+ * @brief listens on a Unix stream socket at the policy's path; a stale one
+ *  left behind by an earlier process is replaced
+ */
+LBStatus MetricsExporter::Listen_Unix()
+{
+    sockaddr_un addr{};
+    if (policy.path.size() >= sizeof(addr.sun_path))
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE);
+
+    listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, policy.path.c_str(), policy.path.size());
+    unlink(policy.path.c_str());
+
+    if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 8) < 0)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+
+    return LB_Make();
+} // end Listen_Unix
+
+
+/**
+ * @brief listens on 127.0.0.1 at the policy's port; loopback only, the metrics
+ *  aren't meant to leave the host without something in front of them
+ */
+LBStatus MetricsExporter::Listen_Http()
+{
+    listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+
+    int yes = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(policy.port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    socklen_t len = sizeof(addr);
+    if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listen_fd, 8) < 0 ||
+        getsockname(listen_fd, (sockaddr*)&addr, &len) < 0)
+        return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_SYS, LBStage::LB_STAGE_NONE,
+            LBCode::LB_CODE_NONE, errno);
+
+    bound_port = ntohs(addr.sin_port);
+    return LB_Make();
+} // end Listen_Http
+
+
+/**
+ * @brief accepts and serves one client at a time until woken by Stop()
+ */
+void MetricsExporter::Serve_Loop()
+{
+    pollfd fds[2] = { { listen_fd, POLLIN, 0 }, { wake_fd, POLLIN, 0 } };
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            return;
+        } // end if poll error
+
+        if (fds[1].revents) return;     // stopping
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        int fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) continue;
+
+        Serve(fd);
+        CLOSE(fd);
+    } // end while
+} // end Serve_Loop
+
+
+/**
+ * @brief dumps the file every period until woken by Stop()
+ */
+void MetricsExporter::File_Loop()
+{
+    pollfd wake = { wake_fd, POLLIN, 0 };
+    while (true)
+    {
+        int rc = poll(&wake, 1, int(policy.period.count()));
+        if (rc > 0) return;     // stopping
+        if (rc < 0 && errno != EINTR) return;
+
+        Dump_File();
+    } // end while
+} // end File_Loop
+
+
+/**
+ * @brief serves one client; a Unix socket client gets the text as soon as it
+ *  connects, an HTTP one once its request is in, GET only
+ *
+ * @param fd the accepted client
+ */
+void MetricsExporter::Serve(const int fd)
+{
+    if (policy.mode == ExportMode::Unix_Socket)
+    {
+        Write_All(fd, render());
+        return;
+    } // end if socket
+
+    // read up to the end of the headers; the body of a GET, if any, is ignored
+    std::string request;
+    char buf[1024];
+    pollfd pfd = { fd, POLLIN, 0 };
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST)
+    {
+        if (poll(&pfd, 1, REQUEST_WAIT_MS) <= 0) return;
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) return;
+        request.append(buf, size_t(n));
+    } // end while
+
+    if (request.compare(0, 4, "GET ") != 0)
+    {
+        Write_All(fd, "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\nContent-Length: 0\r\n"
+            "Connection: close\r\n\r\n");
+        return;
+    } // end if not a GET
+
+    std::string body = render();
+    std::string head = "HTTP/1.1 200 OK\r\nContent-Type: " + std::string(OPENMETRICS_TYPE) +
+        "\r\nContent-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n";
+    if (Write_All(fd, head))
+        Write_All(fd, body);
+} // end Serve
+
+
+/**
+ * @brief writes the text to path.tmp and renames it over path, so a reader
+ *  never sees half a dump
+ *
+ * @return false with errno set on failure
+ */
+bool MetricsExporter::Dump_File()
+{
+    std::string tmp = policy.path + ".tmp";
+    int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+
+    bool ok = Write_All(fd, render());
+    CLOSE(fd);
+    if (ok && rename(tmp.c_str(), policy.path.c_str()) == 0)
+        return true;
+
+    int err = errno;
+    unlink(tmp.c_str());
+    errno = err;
+    return false;
+} // end Dump_File
+
+
+/**
+ * @brief writes all of data, riding out partial writes
+ */
+bool MetricsExporter::Write_All(const int fd, const std::string& data)
+{
+    size_t sent = 0;
+    while (sent < data.size())
+    {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == ENOTSOCK)
+            n = write(fd, data.data() + sent, data.size() - sent);
+        if (n < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        } // end if error
+
+        sent += size_t(n);
+    } // end while
+
+    return true;
+} // end Write_All
@@ -0,0 +1,182 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neoload.h"
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr s64 SPIN_NS = 200'000;        // the last stretch before a start is yielded through
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief completed queries per second over measure as it ran
+ */
+double LoadReport::Achieved_Rate() const
+{
+    return measure_ns > 0 ? completed / (measure_ns / 1e9) : 0.0;
+} // end Achieved_Rate
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief constructor
+ *
+ * @param driver_ the driver loaded; connected or not, the warmup connects it
+ */
+LoadGenerator::LoadGenerator(NeoDriver& driver_)
+	: driver(driver_)
+{
+} // end constructor
+
+
+/**
+ * @brief runs spec's load to the end of its measure and waits up to its drain
+ *  for the queries still out. The schedule is kept regardless of how the sends
+ *  go; a sender that fell behind sends the late ones back to back, their
+ *  latency counted from when they should have gone. With max_inflight the
+ *  sender waits for a slot, and the wait counts as well.
+ *
+ * @param spec the load
+ * @param report filled in with what it did
+ *
+ * @return LB_OK on success, alas LB_FAIL for an empty mix or no rate
+ */
+LBStatus LoadGenerator::Run(const LoadSpec& spec, LoadReport& report)
+{
+	u64 total_weight = 0;
+	for (auto& q : spec.mix) total_weight += q.weight;
+	if (!total_weight || spec.rate <= 0)
+		return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE);
+
+	// one shard per connection; queries go round the pool as Acquire() hands
+	//	cells out, so a shard is mostly written from the one thread
+	auto state = std::make_shared<State>();
+	state->mix = spec.mix;
+	state->shard_count = size_t(std::max(driver.Get_Pool_Size(), 1));
+	state->shards = std::make_unique<Shard[]>(state->shard_count);
+	for (size_t i = 0; i < state->shard_count; i++)
+		state->shards[i].per_query.resize(spec.mix.size());
+
+	std::vector<double> weights;
+	for (auto& q : spec.mix) weights.push_back(double(q.weight));
+	std::mt19937_64 rng(spec.seed);
+	std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+	std::exponential_distribution<double> gap(spec.rate / 1e9);    // in ns
+	const s64 interval = std::max<s64>(s64(1e9 / spec.rate), 1);
+
+	report = LoadReport{};
+	report.per_query.resize(spec.mix.size());
+
+	const s64 start = StageStamps::Now();
+	const s64 measure_from = start + spec.warmup.count();
+	const s64 measure_to = measure_from + spec.measure.count();
+	const s64 give_up = measure_to + spec.drain.count();
+	s64 at = start;
+
+	for (u64 i = 0; at < measure_to; i++)
+	{
+		Wait_Until(at);
+		while (spec.max_inflight && state->inflight.load(std::memory_order_acquire) >= spec.max_inflight &&
+			StageStamps::Now() < give_up)
+			std::this_thread::yield();
+		if (StageStamps::Now() >= give_up) break;
+
+		const bool measured = at >= measure_from;
+		const u32 q = u32(pick(rng));
+		const u32 shard = u32(i % state->shard_count);
+		const s64 scheduled = at;
+		const s64 sent = StageStamps::Now();
+
+		state->inflight.fetch_add(1, std::memory_order_relaxed);
+		LBStatus rc = driver.Execute_Async([state, scheduled, sent, q, shard, measured](BoltResult& r) {
+			if (measured)
+			{
+				const s64 now = StageStamps::Now();
+				Shard& s = state->shards[shard];
+				std::lock_guard<std::mutex> guard(s.lock);
+				s.completed++;
+				s.failed += r.error;
+				s.records += r.error ? 0 : r.message_count;
+				s.last_done = std::max(s.last_done, now);
+				s.latency.Record_Latency(std::chrono::nanoseconds(now - scheduled));
+				s.service.Record_Latency(std::chrono::nanoseconds(now - sent));
+				s.per_query[q].Record_Latency(std::chrono::nanoseconds(now - scheduled));
+			} // end if measured
+
+			state->inflight.fetch_sub(1, std::memory_order_release);
+		}, state->mix[q].cypher.c_str());
+
+		if (measured)
+		{
+			report.scheduled++;
+			report.send_lag.Record_Latency(std::chrono::nanoseconds(sent - scheduled));
+		} // end if measured
+
+		if (!LB_OK(rc))
+		{
+			state->inflight.fetch_sub(1, std::memory_order_relaxed);
+			report.send_errors += measured;
+		} // end if not sent
+
+		at += spec.arrival == Arrival::Uniform ? interval : std::max<s64>(s64(gap(rng)), 1);
+	} // end for schedule
+
+	while (state->inflight.load(std::memory_order_acquire) && StageStamps::Now() < give_up)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	s64 last_done = measure_to;
+	for (size_t i = 0; i < state->shard_count; i++)
+	{
+		Shard& s = state->shards[i];
+		std::lock_guard<std::mutex> guard(s.lock);
+		report.completed += s.completed;
+		report.failed += s.failed;
+		report.records += s.records;
+		last_done = std::max(last_done, s.last_done);
+		report.latency.Merge(s.latency);
+		report.service.Merge(s.service);
+		for (size_t q = 0; q < spec.mix.size(); q++)
+			report.per_query[q].Merge(s.per_query[q]);
+	} // end for shards
+
+	report.timed_out = report.scheduled - report.completed - report.send_errors;
+	report.measure_ns = last_done - measure_from;
+	return LB_Make();
+} // end Run
+
+
+/**
+ * @brief sleeps most of the way to at and yields through the rest, so a start
+ *  is missed by a few microseconds rather than a scheduler tick
+ */
+void LoadGenerator::Wait_Until(const s64 at)
+{
+	for (s64 now = StageStamps::Now(); now < at; now = StageStamps::Now())
+	{
+		if (at - now > SPIN_NS)
+			std::this_thread::sleep_for(std::chrono::nanoseconds(at - now - SPIN_NS / 2));
+		else std::this_thread::yield();
+	} // end for
+} // end Wait_Until
@@ -3,7 +3,7 @@
  *
  * @version 1.0
  * @date created 18th of January 2026, Sunday
- * @date updated 18th of January 2026, Sunday
+ * @date updated 16th of October 2026, Friday.
  */
 
 
@@ -27,12 +27,14 @@
 //===============================================================================|
 /**
  * @brief constructor
+ *
+ * @param pslab optional slab shared by all connection buffers in the pool
  */
 NeoCellPool::NeoCellPool(int epfd, size_t nworkers, std::string& urls, BoltValue* pauth,
-	BoltValue* pextras)
+	BoltValue* pextras, BufferSlab* pslab)
 {
 	for (size_t i = 0; i < nworkers; ++i)
-		workers.emplace_back(new NeoCell(epfd, urls, pauth, pextras));
+		workers.emplace_back(new NeoCell(epfd, urls, pauth, pextras, pslab));
 } // end constructor
 
 
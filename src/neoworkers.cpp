@@ -0,0 +1,168 @@
+/**
+  @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @version 1.0
+ * @date created 16th of October 2026, Friday.
+ * @date updated 16th of October 2026, Friday.
+ */
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neoworkers.h"
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief stops and joins the workers if still running
+ */
+DecodeWorkers::~DecodeWorkers()
+{
+	Stop();
+} // end destructor
+
+
+/**
+ * @brief starts n workers and pins the cells to them round-robin; cell i goes
+ *	to worker i % n. Does nothing for n <= 0, the polling thread decoding itself.
+ *
+ * @param n the number of workers
+ * @param cells the cells of the pool, pinned for good
+ * @param pslab the slab buffers are parked to, trimmed after parking
+ */
+void DecodeWorkers::Start(const int n, const std::vector<std::unique_ptr<NeoCell>>& cells,
+	BufferSlab* pslab)
+{
+	if (n <= 0 || running.load(std::memory_order_acquire)) return;
+
+	slab = pslab;
+	for (int i = 0; i < n; i++)
+		workers.emplace_back(new Worker());
+
+	for (size_t i = 0; i < cells.size(); i++)
+	{
+		cells[i]->decode_worker = static_cast<int>(i % n);
+		workers[i % n]->cells.push_back(cells[i].get());
+	} // end for pin
+
+	running.store(true, std::memory_order_release);
+	for (auto& w : workers)
+		w->thread = std::thread(&DecodeWorkers::Run, this, w.get());
+} // end Start
+
+
+/**
+ * @brief stops the workers once they've drained what was posted and joins them;
+ *	the cells are unpinned, back to being decoded by the polling thread.
+ */
+void DecodeWorkers::Stop()
+{
+	if (!running.exchange(false, std::memory_order_acq_rel)) return;
+
+	for (auto& w : workers)
+	{
+		Wake(w.get());
+		if (w->thread.joinable()) w->thread.join();
+		for (NeoCell* pcell : w->cells)
+			pcell->decode_worker = -1;
+	} // end for
+
+	workers.clear();
+} // end Stop
+
+
+/**
+ * @brief hands a readable cell to the worker it's pinned to; called from the
+ *	polling thread, the only producer. A cell already posted and not yet picked
+ *	up isn't posted twice.
+ *
+ * @param pcell the readable cell
+ */
+void DecodeWorkers::Post(NeoCell* pcell)
+{
+	if (pcell->read_posted.exchange(true, std::memory_order_acq_rel))
+		return;		// its worker has yet to get to it
+
+	Worker* w = workers[pcell->decode_worker].get();
+	while (!w->ready.Enqueue(pcell))
+		std::this_thread::yield();	// only when more cells than slots are pinned
+
+	Wake(w);
+} // end Post
+
+
+/**
+ * @brief asks every worker to park the buffers of its idle cells and trim the
+ *	slab, the workers being the ones owning read buffers now.
+ *
+ * @param release true to park read buffers results were fetched from too
+ */
+void DecodeWorkers::Park_Idle(const bool release)
+{
+	for (auto& w : workers)
+	{
+		if (release)
+			w->release.store(true, std::memory_order_release);
+		w->park.store(true, std::memory_order_release);
+		Wake(w.get());
+	} // end for
+} // end Park_Idle
+
+
+/**
+ * @brief the number of workers running; 0 when decoding on the polling thread
+ */
+int DecodeWorkers::Size() const
+{
+	return running.load(std::memory_order_acquire) ? static_cast<int>(workers.size()) : 0;
+} // end Size
+
+
+/**
+ * @brief a worker's loop; receives and decodes every cell posted to it, oldest
+ *	first, then sleeps on its signal until the next post.
+ *
+ * @param w the worker
+ */
+void DecodeWorkers::Run(Worker* w)
+{
+	while (true)
+	{
+		u32 seen = w->signal.load(std::memory_order_acquire);
+
+		while (auto pcell = w->ready.Dequeue())
+		{
+			// cleared before reading, so readiness from here on posts it again
+			(*pcell)->read_posted.store(false, std::memory_order_seq_cst);
+			(*pcell)->Read_Responses();
+		} // end while posted
+
+		if (w->park.exchange(false, std::memory_order_acq_rel))
+		{
+			const bool release = w->release.exchange(false, std::memory_order_acq_rel);
+			for (NeoCell* pcell : w->cells)
+				pcell->Park_Idle_Buffers(release);
+			if (slab) slab->Trim();
+		} // end if park
+
+		if (!running.load(std::memory_order_acquire) && w->ready.Is_Empty())
+			break;
+
+		w->signal.wait(seen, std::memory_order_acquire);
+	} // end while
+} // end Run
+
+
+/**
+ * @brief bumps a worker's signal and wakes it if sleeping
+ */
+void DecodeWorkers::Wake(Worker* w)
+{
+	w->signal.fetch_add(1, std::memory_order_release);
+	w->signal.notify_one();
+} // end Wake
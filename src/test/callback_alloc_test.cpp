@@ -0,0 +1,204 @@
+/**
+ * @file callback_alloc_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief counts heap allocations made while carrying async completion callbacks
+ *  through the request and task queues. Async queries with capturing callbacks
+ *  go through Execute_Async against the local Bolt stand-in and the test fails
+ *  should a single malloc show up per query once warmed up, or a query be kept
+ *  for a Fetch() that never comes; a std::function
+ *  round trip is measured along side for reference. Given "live" as the first
+ *  argument the same queries run against bolt://localhost:7687, held to the
+ *  same. Debug builds only report the counts, as the decoder prints and dumps
+ *  every response there.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <cstdlib>
+#include <functional>
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr int ROUNDS = 10'000;
+constexpr int WARMUP = 200;
+constexpr int QUERIES = 2'000;
+constexpr u32 ROWS = 100;
+
+#ifdef _DEBUG
+constexpr bool HELD = false;    // Decode_Response's prints allocate per response
+#else
+constexpr bool HELD = true;     // to no allocations per query
+#endif
+
+static std::atomic<u64> allocs{ 0 };
+static std::atomic<int> completed{ 0 };
+static std::atomic<u64> records{ 0 };
+
+
+
+
+//===============================================================================|
+//          ALLOCATION HOOKS
+//===============================================================================|
+void* operator new(size_t n)
+{
+    allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+} // end new
+
+void* operator new[](size_t n) { return operator new(n); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a capture list the size of what a web handler typically carries;
+ *  a couple of pointers, an id and a timestamp.
+ */
+struct Capture
+{
+    std::atomic<int>* done;
+    std::atomic<u64>* rows;
+    u64 request_id;
+    u64 start_ns;
+    void* user;
+};
+
+
+/**
+ * @brief a callback carried through a queue in a std::function and invoked,
+ *  for comparison
+ */
+double Offline_StdFunction()
+{
+    static LockFreeQueue<std::function<void(BoltResult&)>, 64> tasks;
+    std::atomic<int> done{ 0 };
+    std::atomic<u64> rows{ 0 };
+
+    BoltResult result;
+    result.message_count = 100;
+
+    u64 before = 0;
+    for (int i = 0; i < ROUNDS + WARMUP; i++)
+    {
+        if (i == WARMUP) before = allocs.load(std::memory_order_relaxed);
+
+        Capture c{ &done, &rows, static_cast<u64>(i), 0, nullptr };
+        std::function<void(BoltResult&)> cb = [c](BoltResult& res) {
+            c.rows->fetch_add(res.message_count, std::memory_order_relaxed);
+            c.done->fetch_add(1, std::memory_order_relaxed);
+        };
+
+        tasks.Enqueue(std::move(cb));
+        auto fn = tasks.Dequeue();
+        (*fn)(result);
+    } // end for
+
+    return double(allocs.load(std::memory_order_relaxed) - before) / ROUNDS;
+} // end Offline_StdFunction
+
+
+/**
+ * @brief async queries through Execute_Async; one connection, a query in flight
+ *  at a time so every query goes through the same warmed up buffers.
+ *
+ * @param url the server's
+ *
+ * @return allocations per query once warmed up
+ */
+double Queries(const std::string& url)
+{
+    NeoDriver driver(url, Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+    completed.store(0);
+    records.store(0);
+
+    u64 before = 0;
+    for (int i = 0; i < QUERIES + WARMUP; i++)
+    {
+        if (i == WARMUP) before = allocs.load(std::memory_order_relaxed);
+
+        Capture c{ &completed, &records, static_cast<u64>(i), 0, nullptr };
+        LBStatus rc = driver.Execute_Async([c](BoltResult& res) {
+                c.rows->fetch_add(res.message_count, std::memory_order_relaxed);
+                c.done->fetch_add(1, std::memory_order_release);
+            }, "UNWIND range(1,100) AS n RETURN n");
+        if (!LB_OK(rc)) Fatal("%s", driver.Get_Last_Error().c_str());
+
+        while (completed.load(std::memory_order_acquire) <= i)
+            std::this_thread::yield();
+    } // end for
+
+    u64 after = allocs.load(std::memory_order_relaxed);
+    const size_t kept = driver.Get_Pool()->Workers()[0]->Gauges().requests;
+    driver.Close();
+
+    // no Fetch() ever comes for them; kept, they'd fill the request queue
+    if (kept) Fatal("%zu callback queries kept for Fetch()", kept);
+
+    if (records.load() != u64(QUERIES + WARMUP) * ROWS)
+        Fatal("%llu records back", static_cast<unsigned long long>(records.load()));
+    Utils::Print("%s: %d queries, %llu records", url.c_str(), QUERIES + WARMUP,
+        static_cast<unsigned long long>(records.load()));
+    return double(after - before) / QUERIES;
+} // end Queries
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    static_assert(sizeof(Capture) <= SMALL_FN_CAPACITY, "capture must fit inline");
+
+    // the stand-in answers from a thread of its own with responses made up
+    // front; it allocates nothing per query to muddle the count
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("stand-in: listen");
+    double small = Queries(standin.Url());
+    standin.Stop();
+
+    double stdfn = Offline_StdFunction();
+
+    Utils::Print("Allocations per query (%d queries)", QUERIES);
+    Utils::Print("  Execute_Async: %.2f", small);
+    Utils::Print("  std::function: %.2f per callback round trip, for reference", stdfn);
+    if (!HELD) Utils::Print("  debug build; counts reported, not held to");
+    if (HELD && small != 0.0) Fatal("Execute_Async allocated on the steady state path");
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+    {
+        double live = Queries("bolt://localhost:7687");
+        Utils::Print("  Execute_Async: %.2f per query against localhost", live);
+        if (HELD && live != 0.0) Fatal("Execute_Async allocated against localhost");
+    } // end if live
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
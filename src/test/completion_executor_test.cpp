@@ -0,0 +1,300 @@
+/**
+ * @file completion_executor_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief batches of callbacks handed to a CompletionExecutor from a couple of
+ *  threads, the way connections do; with a pool every callback must run once,
+ *  off the submitting threads and in order within a batch, and with a user
+ *  submit on whichever thread runs the jobs. The queueing delay must have a
+ *  sample per callback. Results handed to a pool must hold on to their records
+ *  while the connection's read buffer is parked and shrunk from under them, in
+ *  the callback and after it. Given "live" as the first argument it also runs single
+ *  row queries against bolt://localhost:7687 next to queries whose callbacks
+ *  take milliseconds, inline and with a pool, and reports the small ones'
+ *  round trip along with the callback delay.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <algorithm>
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::steady_clock;
+
+constexpr int PRODUCERS = 2;
+constexpr int BATCHES = 2'000;          // per producer
+constexpr int POOL = 4;
+constexpr int SLOW_QUERIES = 40;
+constexpr auto SLOW_CALLBACK = std::chrono::milliseconds(5);
+constexpr u32 HELD_ROWS = 2'000;        // well past the read buffer's smallest
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a batch of n callbacks; each checks it runs after the one before it
+ *  in the batch and, when off is set, not on the producer's thread. The last
+ *  one frees the batch's bookkeeping.
+ */
+CompletionBatch Make_Batch(const u32 n, std::atomic<u64>& ran, std::atomic<bool>& broken,
+    const bool off)
+{
+    struct Order { u32 next = 0; std::thread::id producer = std::this_thread::get_id(); };
+    Order* po = new Order();
+
+    CompletionBatch batch;
+    for (u32 i = 0; i < n; i++)
+    {
+        batch.push_back({ [po, i, n, off, &ran, &broken](BoltResult&) {
+                if (po->next++ != i || (off && std::this_thread::get_id() == po->producer))
+                    broken.store(true, std::memory_order_relaxed);
+                ran.fetch_add(1, std::memory_order_relaxed);
+                if (i + 1 == n) delete po;
+            }, BoltResult(), Clock::now() });
+    } // end for
+
+    return batch;
+} // end Make_Batch
+
+
+/**
+ * @brief PRODUCERS threads hand BATCHES batches each to exec
+ *
+ * @return callbacks handed over
+ */
+u64 Produce(CompletionExecutor& exec, std::atomic<u64>& ran, std::atomic<bool>& broken, const bool off)
+{
+    std::vector<std::thread> producers;
+    std::atomic<u64> handed{ 0 };
+    for (int t = 0; t < PRODUCERS; t++)
+        producers.emplace_back([&, t] {
+            for (int b = 0; b < BATCHES; b++)
+            {
+                u32 n = 1 + (b * 7 + t) % COMPLETION_BATCH;
+                exec.Submit(Make_Batch(n, ran, broken, off));
+                handed.fetch_add(n, std::memory_order_relaxed);
+            } // end for
+        });
+
+    for (auto& p : producers) p.join();
+    return handed.load();
+} // end Produce
+
+
+/**
+ * @brief a pool, then a user submit drained on this thread
+ */
+void Offline()
+{
+    CompletionExecutor exec;
+    std::atomic<u64> ran{ 0 };
+    std::atomic<bool> broken{ false };
+
+    exec.Set_Policy({ ExecMode::Pool, 3 });
+    u64 handed = Produce(exec, ran, broken, true);
+    exec.Stop();
+    if (ran.load() != handed || broken.load()) Fatal("pool: ran %llu of %llu callbacks, order %s",
+        (unsigned long long)ran.load(), (unsigned long long)handed, broken.load() ? "broken" : "kept");
+    if (exec.Delay().samples != handed) Fatal("pool: %llu delay samples", (unsigned long long)exec.Delay().samples);
+    Utils::Print("pool: %llu callbacks in %d batches, delay p50 %lld ns, p99 %lld ns",
+        (unsigned long long)handed, PRODUCERS * BATCHES,
+        (long long)exec.Delay().Percentile(0.50).count(), (long long)exec.Delay().Percentile(0.99).count());
+
+    // user submit; jobs queued here and run on this thread
+    std::mutex jobs_lock;
+    std::deque<SmallFn<void()>> jobs;
+    ran = 0;
+    exec.Clear_Delay();
+    exec.Set_Policy({ ExecMode::Submit, 0, [&](SmallFn<void()>&& job) {
+            std::lock_guard<std::mutex> guard(jobs_lock);
+            jobs.push_back(std::move(job));
+        } });
+    handed = Produce(exec, ran, broken, false);
+    if (ran.load() != 0) Fatal("submit: callbacks ran before their jobs");
+    if (jobs.size() != size_t(PRODUCERS * BATCHES)) Fatal("submit: %zu jobs for %d batches", jobs.size(), PRODUCERS * BATCHES);
+    for (auto& job : jobs) job();
+    if (ran.load() != handed || broken.load() || exec.Delay().samples != handed)
+        Fatal("submit: ran %llu of %llu callbacks", (unsigned long long)ran.load(), (unsigned long long)handed);
+    Utils::Print("submit: %zu jobs run on the caller", jobs.size());
+
+    // a submit policy without a function falls back to inline
+    exec.Set_Policy({ ExecMode::Submit });
+    if (exec.Mode() != ExecMode::Inline) Fatal("empty submit not inline");
+} // end Offline
+
+
+/**
+ * @brief the stand-in's records, field names and summary, read from a result
+ */
+bool Intact(BoltResult& res)
+{
+    std::vector<std::tuple<std::string, s64>> rows;     // as the stand-in lays them out
+    std::vector<std::string_view> keys;
+    if (res.error || !LB_OK(res.Fetch_As(rows)) || rows.size() != HELD_ROWS) return false;
+
+    for (size_t i = 0; i < rows.size(); i++)
+        if (std::get<0>(rows[i]) != "standin" || std::get<1>(rows[i]) != s64(i + 1))
+            return false;
+
+    return LB_OK(res.Keys(keys)) && keys.size() == 2 && keys[0] == "n" && keys[1] == "name" &&
+        res.summary.ToString().find("neo4j") != std::string::npos;
+} // end Intact
+
+
+/**
+ * @brief a result handed to a pool, read only once the connection's read buffer
+ *  has been parked back at its smallest; in the callback, then again from the
+ *  result it moved out, with the buffer parked once more.
+ */
+void Held()
+{
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = HELD_ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("held: stand-in listen");
+
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+    driver.Set_Executor({ ExecMode::Pool, 1 });
+    driver.Set_Memory_Limit(1);     // always over; parked buffers drop to their smallest
+    NeoCell* pcell = driver.Get_Pool()->Workers()[0].get();
+
+    struct State
+    {
+        std::atomic<int> step{ 0 };     // 1 in the callback, 2 buffer parked, 3 read
+        bool intact = false;
+        BoltResult kept;
+    } st;
+
+    auto wait_parked = [pcell] {
+        auto until = Clock::now() + std::chrono::seconds(5);
+        while (pcell->Gauges().read_capacity != 0)
+        {
+            if (Clock::now() > until) Fatal("held: read buffer never parked");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } // end while
+    };
+
+    LBStatus rc = driver.Execute_Async([&st](BoltResult& res) {
+            st.step.store(1, std::memory_order_release);
+            while (st.step.load(std::memory_order_acquire) < 2)
+                std::this_thread::yield();
+
+            st.intact = Intact(res);
+            st.kept = std::move(res);
+            st.step.store(3, std::memory_order_release);
+        }, "UNWIND range(1, 2000) AS n RETURN n, 'standin' AS name");
+    if (!LB_OK(rc)) Fatal("held: %s", driver.Get_Last_Error().c_str());
+
+    while (st.step.load(std::memory_order_acquire) < 1)
+        std::this_thread::yield();
+    if (pcell->Gauges().read_high <= 8192) Fatal("held: read buffer never grew");
+    driver.Release_Idle_Buffers();
+    wait_parked();
+
+    st.step.store(2, std::memory_order_release);
+    while (st.step.load(std::memory_order_acquire) < 3)
+        std::this_thread::yield();
+    if (!st.intact) Fatal("held: records lost in the callback");
+
+    driver.Release_Idle_Buffers();
+    wait_parked();
+    if (!Intact(st.kept)) Fatal("held: records lost after the callback");
+
+    size_t high = pcell->Gauges().read_high;
+    driver.Close();
+    standin.Stop();
+    Utils::Print("held: %u records read back with the read buffer (%zu bytes at most) parked",
+        HELD_ROWS, high);
+} // end Held
+
+
+/**
+ * @brief single row queries on the other connections while the first runs
+ *  queries with slow callbacks
+ *
+ * @return round trips of the single row queries, sorted, in µs
+ */
+std::vector<double> Live(ExecPolicy policy, LatencyHistogram& delay)
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(), POOL);
+    driver.Set_Executor(std::move(policy));
+    auto& cells = driver.Get_Pool()->Workers();
+
+    std::atomic<int> slow_done{ 0 };
+    for (int i = 0; i < SLOW_QUERIES; i++)
+        cells[0]->Run_Async([&slow_done](BoltResult&) {
+                std::this_thread::sleep_for(SLOW_CALLBACK);
+                slow_done.fetch_add(1, std::memory_order_release);
+            }, "RETURN 1");
+
+    std::vector<double> lat;
+    for (int k = 0; slow_done.load(std::memory_order_acquire) < SLOW_QUERIES; k++)
+    {
+        std::atomic<bool> done{ false };
+        auto t0 = Clock::now();
+        cells[1 + k % (POOL - 1)]->Run_Async([&done](BoltResult&) {
+                done.store(true, std::memory_order_release);
+            }, "RETURN 1");
+        while (!done.load(std::memory_order_acquire))
+            std::this_thread::yield();
+        lat.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+    } // end for
+
+    delay = driver.Callback_Delay();
+    driver.Close();
+    std::sort(lat.begin(), lat.end());
+    return lat;
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    Offline();
+    Held();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+    {
+        Utils::Print("%d queries with %lld ms callbacks on one connection, single row ones on %d others",
+            SLOW_QUERIES, (long long)SLOW_CALLBACK.count(), POOL - 1);
+        Utils::Print("%-10s %8s %10s %10s %14s", "", "queries", "p50 us", "p99 us", "cb delay p99");
+
+        const std::pair<const char*, ExecPolicy> modes[] = {
+            { "inline", { ExecMode::Inline } },
+            { "pool", { ExecMode::Pool, 2 } },
+        };
+        for (auto& [name, policy] : modes)
+        {
+            LatencyHistogram delay;
+            std::vector<double> lat = Live(policy, delay);
+            if (lat.empty()) continue;
+            Utils::Print("%-10s %8zu %10.1f %10.1f %11lld us", name, lat.size(), lat[lat.size() / 2],
+                lat[lat.size() * 99 / 100], (long long)delay.Percentile(0.99).count() / 1000);
+        } // end for
+    } // end if live
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,246 @@
+/**
+ * @file completion_signal_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief completions posted in bursts by one thread and taken by another, the
+ *  way the decoding thread and Fetch() share them. Every post must be taken
+ *  exactly once whether waited on one at a time or drained with Take(); a done
+ *  flag reset after each wakeup, as Wait_Task used to, is run along side to show
+ *  how many it coalesces. Timed waits must give up close to their timeout.
+ *  Queries left for Fetch() on the Bolt stand-in, one failing mid stream behind
+ *  one done but not yet fetched, must come back one result each, in order and
+ *  with nothing left over. Given "live" as the first argument it also pipelines queries on one cell
+ *  against bolt://localhost:7687 and drains them with Fetch_Many().
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::steady_clock;
+
+constexpr u32 POSTS = 1'000'000;
+constexpr u32 LIVE_QUERIES = 64;
+constexpr u32 STANDIN_ROWS = 1'000;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief POSTS completions in bursts of 1 to 8
+ */
+template<typename PostFn>
+void Producer(PostFn post)
+{
+    for (u32 sent = 0; sent < POSTS; )
+    {
+        u32 burst = std::min<u32>(1 + sent % 8, POSTS - sent);
+        for (u32 i = 0; i < burst; i++) post();
+        sent += burst;
+        if (sent % 4096 == 0) std::this_thread::yield();
+    } // end for
+} // end Producer
+
+
+/**
+ * @brief three queries pipelined on one cell and fetched only once all are in;
+ *  the middle one fails half way through its records, the stand-in's doing
+ */
+void Failed_Fetch()
+{
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = STANDIN_ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("fetch: stand-in listen");
+
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+    NeoCell* pcell = driver.Get_Pool()->Workers()[0].get();
+    const char* queries[] = { "UNWIND range(1, 1000) AS n RETURN 'standin', n",
+        "FAIL UNWIND range(1, 1000) AS n RETURN 'standin', 1/(n-501)",
+        "UNWIND range(1, 1000) AS n RETURN 'standin', n" };
+    for (const char* q : queries)
+        if (!LB_OK(pcell->Run(q))) Fatal("fetch: %s", driver.Get_Last_Error().c_str());
+
+    auto until = Clock::now() + std::chrono::seconds(5);
+    while (standin.Queries() < std::size(queries) || pcell->Gauges().tasks)
+    {
+        if (Clock::now() > until) Fatal("fetch: queries never completed");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } // end while
+
+    for (size_t i = 0; i < std::size(queries); i++)
+    {
+        BoltResult r;
+        if (!LB_OK(pcell->Fetch(r, std::chrono::seconds(1)))) Fatal("fetch: result %zu never came", i);
+        const bool failing = i == 1;
+        if (r.error != failing || (!failing && r.message_count != STANDIN_ROWS))
+            Fatal("fetch: result %zu has %u records, error %d", i, r.message_count, r.error);
+    } // end for
+
+    BoltResult extra;
+    if (LB_OK(pcell->Fetch(extra, std::chrono::milliseconds(20))))
+        Fatal("fetch: a result too many, %u records", extra.message_count);
+
+    driver.Close();
+    standin.Stop();
+    Utils::Print("fetch: %zu queries, one failing mid stream, one result each", std::size(queries));
+} // end Failed_Fetch
+
+
+/**
+ * @brief the done flag as Wait_Task had it; wakeups between two waits are one
+ *
+ * @return wakeups seen for POSTS posts
+ */
+u64 Flag_Wakeups()
+{
+    std::atomic<bool> is_done{ false };
+    std::atomic<bool> finished{ false };
+    std::thread producer([&] {
+        Producer([&] { is_done.store(true, std::memory_order_release); is_done.notify_one(); });
+        finished.store(true, std::memory_order_release);
+        is_done.store(true, std::memory_order_release);
+        is_done.notify_one();
+    });
+
+    u64 seen = 0;
+    while (!finished.load(std::memory_order_acquire))
+    {
+        is_done.wait(false, std::memory_order_acquire);
+        is_done.store(false, std::memory_order_release);
+        seen++;
+    } // end while
+
+    producer.join();
+    return seen;
+} // end Flag_Wakeups
+
+
+/**
+ * @brief every post taken once, singly or in batches of up to batch
+ */
+void Counted(const u32 batch)
+{
+    CompletionSignal signal;
+    std::thread producer([&] { Producer([&] { signal.Post(); }); });
+
+    u64 taken = 0, calls = 0;
+    auto t0 = Clock::now();
+    while (taken < POSTS)
+    {
+        u32 n = batch == 1 ? (signal.Wait() ? 1 : 0) : signal.Take(batch);
+        if (!n || n > batch) Fatal("take of %u returned %u", batch, n);
+        taken += n;
+        calls++;
+    } // end while
+    auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    producer.join();
+    if (taken != POSTS || signal.Pending()) Fatal("took %llu of %u, %u left", (unsigned long long)taken,
+        POSTS, signal.Pending());
+    Utils::Print("take(%2u): %u posts in %llu calls, %.1f ms", batch, POSTS, (unsigned long long)calls, elapsed);
+} // end Counted
+
+
+/**
+ * @brief a wait on nothing gives up near its timeout; one already posted is
+ *  taken without waiting
+ */
+void Timed()
+{
+    CompletionSignal signal;
+    for (auto timeout : { std::chrono::milliseconds(1), std::chrono::milliseconds(20) })
+    {
+        auto t0 = Clock::now();
+        if (signal.Wait(timeout)) Fatal("nothing posted, yet waited");
+        auto waited = Clock::now() - t0;
+        if (waited < timeout || waited > timeout + std::chrono::milliseconds(50))
+            Fatal("%lld ms timeout took %lld us", (long long)timeout.count(),
+                (long long)std::chrono::duration_cast<std::chrono::microseconds>(waited).count());
+    } // end for
+
+    signal.Post(3);
+    if (signal.Take(2, std::chrono::nanoseconds(0)) != 2 || !signal.Wait(std::chrono::nanoseconds(0))
+        || signal.Wait(std::chrono::nanoseconds(0)))
+        Fatal("zero timeout takes");
+
+    // a waiter woken by a post from another thread
+    std::thread late([&] { std::this_thread::sleep_for(std::chrono::milliseconds(5)); signal.Post(); });
+    if (!signal.Wait(std::chrono::seconds(2))) Fatal("post from another thread not seen");
+    late.join();
+    Utils::Print("timed waits: ok");
+} // end Timed
+
+
+/**
+ * @brief LIVE_QUERIES pipelined on one cell, drained in as few calls as ready
+ */
+void Live()
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""));
+    NeoCell* pcell = driver.Get_Session();
+    if (!pcell) Fatal("%s", driver.Get_Last_Error().c_str());
+
+    for (u32 i = 0; i < LIVE_QUERIES; i++)
+        pcell->Run("RETURN 1 AS n");
+
+    std::vector<BoltResult> results(LIVE_QUERIES);
+    u32 got = 0, calls = 0;
+    while (got < LIVE_QUERIES)
+    {
+        LBStatus rc = pcell->Fetch_Many(std::span<BoltResult>(results).subspan(got), std::chrono::seconds(5));
+        if (!LB_OK(rc)) Fatal("Fetch_Many timed out after %u of %u", got, LIVE_QUERIES);
+        got += LB_Aux(rc);
+        calls++;
+    } // end while
+
+    for (auto& r : results)
+        if (r.error || r.message_count != 1) Fatal("bad result");
+
+    BoltResult none;
+    if (LB_OK(pcell->Fetch(none, std::chrono::milliseconds(10)))) Fatal("fetched with nothing run");
+    Utils::Print("live: %u pipelined results in %u Fetch_Many calls", LIVE_QUERIES, calls);
+    driver.Close();
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+
+    u64 seen = Flag_Wakeups();
+    Utils::Print("done flag: %llu wakeups for %u posts (%llu coalesced)", (unsigned long long)seen, POSTS,
+        (unsigned long long)(POSTS - std::min<u64>(seen, POSTS)));
+    Counted(1);
+    Counted(64);
+    Timed();
+    Failed_Fetch();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
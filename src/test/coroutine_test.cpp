@@ -0,0 +1,500 @@
+/**
+ * @file coroutine_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief co_await on queries. The offline part suspends many coroutines at once
+ *  on QueryAwaiters whose launch parks the callback, the way a connection holds
+ *  on to it, and completes them from another thread; every coroutine must be
+ *  resumed once per query with its own result, on the completing thread or, via
+ *  On(), on whoever drains the submitted jobs. A launch that fails must carry on
+ *  without suspending, and so must a query the driver refuses to send; the Bolt
+ *  stand-in's cell starved of buffer storage under the slab's cap. A ResultStream
+ *  over the stand-in must be resumed into on one thread for every batch, the last
+ *  included, inline and through a pool, with each batch carrying on where the one
+ *  before left off, and cancel cleanly; the cell refusing other queries and stray
+ *  pulls meanwhile. A query failing half way through its records must resume its
+ *  coroutine with the error, a stream on one end with it, and the cell take the
+ *  next query. Given "live" as the first argument it also runs thousands
+ *  of concurrent coroutines through driver.Run() against bolt://localhost:7687 and
+ *  walks a large result a batch at a time through a ResultStream.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <deque>
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::steady_clock;
+
+constexpr int COROUTINES = 20'000;
+constexpr int QUERIES_EACH = 3;
+constexpr int LIVE_COROUTINES = 10'000;
+constexpr int STREAM_ROWS = 100'000;
+constexpr int STREAM_BATCH = 1'000;
+constexpr u32 STANDIN_ROWS = 1'000;
+constexpr int STANDIN_BATCH = 64;
+
+
+
+
+//===============================================================================|
+//          TYPES
+//===============================================================================|
+/**
+ * @brief stands in for the connections; launches park their callbacks here and
+ *  a completer thread hands each a result tagged with the query's id
+ */
+struct FakeServer
+{
+    struct Pending { ResultCallback cb; size_t id; };
+
+    std::mutex lock;
+    std::deque<Pending> pending;
+    std::atomic<bool> running{ true };
+    std::thread::id completer;
+
+
+    LBStatus Launch(ResultCallback&& cb, const size_t id)
+    {
+        if (id == 0)
+            return LB_Make(LBAction::LB_FAIL, LBDomain::LB_DOM_STATE, LBStage::LB_STAGE_QUERY);
+
+        std::lock_guard<std::mutex> guard(lock);
+        pending.push_back({ std::move(cb), id });
+        return LB_Make();
+    } // end Launch
+
+
+    void Complete_Loop()
+    {
+        completer = std::this_thread::get_id();
+        while (running.load(std::memory_order_acquire))
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            if (pending.empty())
+            {
+                guard.unlock();
+                std::this_thread::yield();
+                continue;
+            } // end if nothing
+
+            Pending p = std::move(pending.front());
+            pending.pop_front();
+            guard.unlock();
+
+            BoltResult r;
+            r.done = true;
+            r.message_count = p.id;
+            p.cb(r);
+        } // end while
+    } // end Complete_Loop
+};
+
+
+/**
+ * @brief an awaiter over the fake server, as NeoDriver::Run() makes them
+ */
+auto Fake_Run(FakeServer& server, const size_t id)
+{
+    return QueryAwaiter([&server, id](ResultCallback&& cb) {
+            return server.Launch(std::move(cb), id);
+        });
+} // end Fake_Run
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief QUERIES_EACH queries one after another; checks each result is its own
+ *  and where it got resumed
+ */
+NeoTask Querier(FakeServer& server, const size_t base, const SubmitFn* post,
+    std::atomic<int>& done, std::atomic<bool>& broken)
+{
+    for (size_t q = 0; q < QUERIES_EACH; q++)
+    {
+        size_t id = base * QUERIES_EACH + q + 1;
+        BoltResult r = post ? co_await Fake_Run(server, id).On(*post)
+            : co_await Fake_Run(server, id);
+
+        bool on_completer = std::this_thread::get_id() == server.completer;
+        if (r.message_count != id || r.error || on_completer == (post != nullptr))
+            broken.store(true, std::memory_order_relaxed);
+    } // end for
+
+    done.fetch_add(1, std::memory_order_release);
+} // end Querier
+
+
+/**
+ * @brief a launch that fails must resume right away with an error result
+ */
+NeoTask Failing(FakeServer& server, bool& resumed)
+{
+    BoltResult r = co_await Fake_Run(server, 0);
+    resumed = r.error && r.done;
+} // end Failing
+
+
+/**
+ * @brief a query through driver.Run() that can't be sent
+ */
+NeoTask Refused_Query(NeoDriver& driver, int& resumed)
+{
+    BoltResult r = co_await driver.Run("RETURN 1 AS n");
+    resumed += r.error && r.done ? 1 : 100;
+} // end Refused_Query
+
+
+/**
+ * @brief the stand-in's cell with its buffers parked and the slab capped below
+ *  a block; the RUN can't be encoded, so the coroutine must resume right away
+ *  with an error rather than wait on a callback that never comes
+ */
+void Refused()
+{
+    BoltStandin standin;
+    if (!LB_OK(standin.Start(StandinSpec{}))) Fatal("refused: stand-in listen");
+
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+    NeoCell* pcell = driver.Get_Pool()->Workers()[0].get();
+    BoltResult first;
+    if (!LB_OK(driver.Execute("RETURN 1 AS n")) || !LB_OK(pcell->Fetch(first)))
+        Fatal("refused: %s", driver.Get_Last_Error().c_str());
+
+    driver.Release_Idle_Buffers();
+    auto until = Clock::now() + std::chrono::seconds(5);
+    while (pcell->Gauges().read_capacity || pcell->Gauges().write_capacity)
+    {
+        if (Clock::now() > until) Fatal("refused: buffers never parked");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } // end while
+    driver.Set_Buffer_Cap(1);
+
+    int resumed = 0;
+    Refused_Query(driver, resumed);
+    if (resumed != 1) Fatal("refused: coroutine %s", resumed ? "resumed without an error" : "left suspended");
+
+    driver.Close();
+    standin.Stop();
+    Utils::Print("refused: unsendable query resumed at once with an error");
+} // end Refused
+
+
+/**
+ * @brief what a stream over the stand-in saw
+ */
+struct Streamed
+{
+    std::atomic<int> done{ 0 };
+    std::atomic<bool> broken{ false };
+    std::thread::id thread;     // the first batch was resumed into on
+    size_t batches = 0;
+};
+
+
+/**
+ * @brief walks the stand-in's result STANDIN_BATCH at a time, checking every
+ *  batch, the last included, is resumed into on the thread the first was and
+ *  picks up at the record after the batch before; then cancels a second one
+ *  after its first batch. Another query must be refused while a stream is open,
+ *  as must a pull with no batch to follow up on, and taken once it's closed.
+ */
+NeoTask Standin_Stream(NeoCell* pcell, Streamed& st)
+{
+    auto same_thread = [&st] {
+        if (st.thread == std::thread::id()) st.thread = std::this_thread::get_id();
+        if (st.thread != std::this_thread::get_id()) st.broken.store(true);
+    };
+
+    ResultStream stream(pcell, "UNWIND range(1, 1000) AS n RETURN 'standin', n", STANDIN_BATCH);
+    s64 next = 1;
+    while (co_await stream.Next())
+    {
+        same_thread();
+        std::vector<std::tuple<std::string, s64>> rows;    // as the stand-in lays them out
+        BoltResult& batch = stream.Batch();
+        if (batch.error || !LB_OK(batch.Fetch_As(rows)) || rows.size() > STANDIN_BATCH)
+            st.broken.store(true);
+        for (auto& row : rows)
+            if (std::get<1>(row) != next++) st.broken.store(true);
+        if (batch.meta.has_more != (next <= s64(STANDIN_ROWS))) st.broken.store(true);
+        st.batches++;
+    } // end while
+    if (next != s64(STANDIN_ROWS) + 1) st.broken.store(true);
+
+    ResultStream dropped(pcell, "UNWIND range(1, 1000) AS n RETURN 'standin', n", STANDIN_BATCH);
+    if (!co_await dropped.Next() || !dropped.Batch().meta.has_more) st.broken.store(true);
+    same_thread();
+    if (LB_OK(pcell->Run_Async([&st](BoltResult&) { st.broken.store(true); }, "RETURN 1")))
+        st.broken.store(true);
+    co_await dropped.Cancel();
+    same_thread();
+    if (co_await dropped.Next() || LB_OK(pcell->Pull_Next(STANDIN_BATCH))) st.broken.store(true);
+
+    LBStatus rc = pcell->Run_Async([&st](BoltResult& r) {
+            if (r.error || r.message_count != STANDIN_ROWS) st.broken.store(true);
+            st.done.store(1, std::memory_order_release);
+        }, "UNWIND range(1, 1000) AS n RETURN 'standin', n");
+    if (!LB_OK(rc))
+    {
+        st.broken.store(true);
+        st.done.store(1, std::memory_order_release);
+    } // end if refused
+} // end Standin_Stream
+
+
+/**
+ * @brief a ResultStream over the stand-in, its batches handed over inline and
+ *  through a pool
+ */
+void Stream()
+{
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = STANDIN_ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("stream: stand-in listen");
+
+    for (ExecMode exec : { ExecMode::Inline, ExecMode::Pool })
+    {
+        const char* mode = exec == ExecMode::Inline ? "inline" : "pool";
+        NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+        driver.Set_Executor({ exec, 1 });
+
+        Streamed st;
+        Standin_Stream(driver.Get_Pool()->Workers()[0].get(), st);
+        auto until = Clock::now() + std::chrono::seconds(10);
+        while (!st.done.load(std::memory_order_acquire))
+        {
+            if (Clock::now() > until) Fatal("stream %s: never finished", mode);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } // end while
+
+        driver.Close();
+        if (st.broken.load()) Fatal("stream %s: batches out of order, on another thread or the cell shared", mode);
+        Utils::Print("stream %s: %u rows in %zu batches, all on one thread", mode, STANDIN_ROWS, st.batches);
+    } // end for
+
+    standin.Stop();
+} // end Stream
+
+
+/**
+ * @brief a query failing half way through its records, awaited whole and then
+ *  a batch at a time; both must end in the error, and the cell carry on
+ */
+NeoTask Failing_Stream(NeoDriver& driver, NeoCell* pcell, Streamed& st)
+{
+    BoltResult whole = co_await driver.Run("FAIL UNWIND range(1, 1000) AS n RETURN 'standin', 1/(n-501)");
+    if (!whole.error) st.broken.store(true);
+
+    ResultStream stream(pcell, "FAIL UNWIND range(1, 1000) AS n RETURN 'standin', 1/(n-501)", STANDIN_BATCH);
+    size_t rows = 0;
+    bool failed = false;
+    while (co_await stream.Next())
+    {
+        if (failed) st.broken.store(true);  // nothing after the error
+        failed = stream.Batch().error;
+        if (!failed) rows += stream.Batch().message_count;
+        st.batches++;
+    } // end while
+    // the batch the failure cut short comes as the error, without its records
+    if (!failed || rows != STANDIN_ROWS / 2 / STANDIN_BATCH * STANDIN_BATCH) st.broken.store(true);
+
+    LBStatus rc = pcell->Run_Async([&st](BoltResult& r) {
+            if (r.error || r.message_count != STANDIN_ROWS) st.broken.store(true);
+            st.done.store(1, std::memory_order_release);
+        }, "UNWIND range(1, 1000) AS n RETURN 'standin', n");
+    if (!LB_OK(rc))
+    {
+        st.broken.store(true);
+        st.done.store(1, std::memory_order_release);
+    } // end if refused
+} // end Failing_Stream
+
+
+/**
+ * @brief failures mid stream against the stand-in, handed over inline and
+ *  through a pool
+ */
+void Failed()
+{
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = STANDIN_ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("failed: stand-in listen");
+
+    for (ExecMode exec : { ExecMode::Inline, ExecMode::Pool })
+    {
+        const char* mode = exec == ExecMode::Inline ? "inline" : "pool";
+        NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+        driver.Set_Executor({ exec, 1 });
+
+        Streamed st;
+        Failing_Stream(driver, driver.Get_Pool()->Workers()[0].get(), st);
+        auto until = Clock::now() + std::chrono::seconds(10);
+        while (!st.done.load(std::memory_order_acquire))
+        {
+            if (Clock::now() > until) Fatal("failed %s: a coroutine was left suspended", mode);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } // end while
+
+        driver.Close();
+        if (st.broken.load()) Fatal("failed %s: the error wasn't handed over, or the cell stuck", mode);
+        Utils::Print("failed %s: error handed over after %zu batches, cell taken again", mode, st.batches);
+    } // end for
+
+    standin.Stop();
+} // end Failed
+
+
+/**
+ * @brief COROUTINES coroutines suspended at once, resumed by the completer or by
+ *  this thread draining submitted jobs
+ */
+void Offline()
+{
+    bool resumed = false;
+    FakeServer failing;
+    Failing(failing, resumed);
+    if (!resumed) Fatal("failed launch did not resume with an error");
+
+    for (bool posted : { false, true })
+    {
+        FakeServer server;
+        std::thread completer(&FakeServer::Complete_Loop, &server);
+        while (server.completer == std::thread::id()) std::this_thread::yield();
+
+        std::mutex jobs_lock;
+        std::deque<SmallFn<void()>> jobs;
+        SubmitFn post = [&](SmallFn<void()>&& job) {
+            std::lock_guard<std::mutex> guard(jobs_lock);
+            jobs.push_back(std::move(job));
+        };
+
+        std::atomic<int> done{ 0 };
+        std::atomic<bool> broken{ false };
+        auto t0 = Clock::now();
+        for (int c = 0; c < COROUTINES; c++)
+            Querier(server, c, posted ? &post : nullptr, done, broken);
+
+        while (done.load(std::memory_order_acquire) < COROUTINES)
+        {
+            std::unique_lock<std::mutex> guard(jobs_lock);
+            if (jobs.empty()) { guard.unlock(); std::this_thread::yield(); continue; }
+            SmallFn<void()> job = std::move(jobs.front());
+            jobs.pop_front();
+            guard.unlock();
+            job();
+        } // end while
+        auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+        server.running.store(false, std::memory_order_release);
+        completer.join();
+        if (broken.load()) Fatal("%s: a coroutine got the wrong result or thread", posted ? "posted" : "inline");
+        Utils::Print("%-8s %d coroutines x %d queries resumed in %.1f ms", posted ? "posted" : "inline",
+            COROUTINES, QUERIES_EACH, elapsed);
+    } // end for
+} // end Offline
+
+
+/**
+ * @brief one coroutine per query, all in flight at once
+ */
+NeoTask Live_Query(NeoDriver& driver, std::atomic<int>& done, std::atomic<int>& failed)
+{
+    BoltResult r = co_await driver.Run("RETURN 1 AS n");
+    if (r.error || r.message_count != 1) failed.fetch_add(1, std::memory_order_relaxed);
+    done.fetch_add(1, std::memory_order_release);
+} // end Live_Query
+
+
+/**
+ * @brief walks a STREAM_ROWS result STREAM_BATCH at a time, then cancels a
+ *  second one after its first batch
+ */
+NeoTask Live_Stream(NeoCell* pcell, std::atomic<int>& done, std::atomic<bool>& broken)
+{
+    ResultStream stream(pcell, "UNWIND range(1, 100000) AS r RETURN r", STREAM_BATCH);
+    size_t rows = 0, batches = 0;
+    while (co_await stream.Next())
+    {
+        if (stream.Batch().error || stream.Batch().message_count > STREAM_BATCH)
+            broken.store(true);
+        rows += stream.Batch().message_count;
+        batches++;
+    } // end while
+    if (rows != STREAM_ROWS) broken.store(true);
+    Utils::Print("stream: %zu rows in %zu batches", rows, batches);
+
+    ResultStream dropped(pcell, "UNWIND range(1, 100000) AS r RETURN r", STREAM_BATCH);
+    if (!co_await dropped.Next() || !dropped.Batch().meta.has_more) broken.store(true);
+    co_await dropped.Cancel();
+    if (co_await dropped.Next()) broken.store(true);
+
+    done.store(1, std::memory_order_release);
+} // end Live_Stream
+
+
+void Live()
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 4);
+    NeoCellPool* pool = driver.Get_Pool();
+
+    std::atomic<int> done{ 0 }, failed{ 0 };
+    auto t0 = Clock::now();
+    for (int i = 0; i < LIVE_COROUTINES; i++)
+        Live_Query(driver, done, failed);
+    while (done.load(std::memory_order_acquire) < LIVE_COROUTINES)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    if (failed.load()) Fatal("%d of %d queries failed", failed.load(), LIVE_COROUTINES);
+    Utils::Print("live: %d concurrent coroutines done in %.1f ms", LIVE_COROUTINES, elapsed);
+
+    std::atomic<int> streamed{ 0 };
+    std::atomic<bool> broken{ false };
+    Live_Stream(pool->Workers()[0].get(), streamed, broken);
+    while (!streamed.load(std::memory_order_acquire))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (broken.load()) Fatal("stream: wrong batches");
+
+    driver.Close();
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    Offline();
+    Refused();
+    Stream();
+    Failed();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
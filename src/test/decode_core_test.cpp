@@ -0,0 +1,213 @@
+/**
+ * @file decode_core_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the threaded decoder core (computed goto and switch) against the jump
+ *  table of function pointers, over the record shapes queries mostly return:
+ *  flat rows of scalars, nodes with labels and properties, paths, and wide
+ *  lists of numbers. All three must land on the same values and the same end
+ *  for every record, then each is timed per record.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <deque>
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_decoder.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int RECORDS = 10'000;
+constexpr int ROUNDS = 20;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a node struct; id, labels, 8 properties and element id. BoltValue
+ *  strings only point at their text, so the element id is kept in keep.
+ */
+BoltValue Make_Node(const int i, std::deque<std::string>& keep)
+{
+    return BoltValue(0x4E, {
+        BoltValue::Make_Int(i),
+        BoltValue({ "Person", "Customer" }),
+        BoltValue({
+            mp("id", BoltValue::Make_Int(i)),
+            mp("name", BoltValue("Lightning Bolt Person")),
+            mp("created", BoltValue::Make_Int(1700000000000ll + i)),
+            mp("age", BoltValue::Make_Int(20 + i % 60)),
+            mp("score", BoltValue::Make_Float(i * 0.5)),
+            mp("city", BoltValue("Addis Ababa")),
+            mp("email", BoltValue("someone@example.com")),
+            mp("active", BoltValue::Make_Bool(i & 1)) }),
+        BoltValue(keep.emplace_back("4:b6a1:" + std::to_string(i))) });
+} // end Make_Node
+
+
+/**
+ * @brief encodes RECORDS records of the given shape into buf
+ */
+void Fill(BoltBuf& buf, const int shape)
+{
+    BoltEncoder encoder(buf);
+    for (int i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        std::deque<std::string> keep;
+        BoltValue row;
+        switch (shape)
+        {
+        case 0:     // flat row
+            row = BoltValue({ i, "Lightning Bolt", i * 0.25, (i & 1) == 0,
+                BoltValue::Make_Null(), s64(i) * 100000 });
+            break;
+
+        case 1:     // node
+            row = BoltValue({ Make_Node(i, keep) });
+            break;
+
+        case 2:     // path of three nodes
+        {
+            BoltValue rel(0x72, { BoltValue::Make_Int(i), BoltValue("KNOWS"), BoltValue::Make_Map() });
+            BoltValue path(0x50, {
+                BoltValue({ Make_Node(i, keep), Make_Node(i + 1, keep), Make_Node(i + 2, keep) }),
+                BoltValue({ rel, rel }),
+                BoltValue({ 1, 1, 2, 2 }) });
+            row = BoltValue({ path });
+            break;
+        } // end path
+
+        default:    // 300 numbers, a LIST16
+        {
+            BoltValue wide = BoltValue::Make_List();
+            for (int k = 0; k < 300; k++)
+                wide.Insert_List(BoltValue::Make_Int(k % 3 ? k : k * 1000));
+            row = BoltValue({ i, wide });
+            break;
+        } // end wide
+        } // end switch
+
+        BoltMessage rec(BoltValue(BOLT_RECORD, { row }));
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+} // end Fill
+
+
+/**
+ * @brief decodes every record's top level struct through fn
+ *
+ * @return ns per record
+ */
+double Time_Core(BoltBuf& buf, DecodeFn fn)
+{
+    auto t0 = Clock::now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        u8* cursor = buf.Data();
+        u8* end = cursor + buf.Size();
+        BoltValue v;
+        v.buf = &buf;
+        while (cursor < end)
+        {
+            u8* pos = cursor + 2;
+            if (!fn(pos, v)) Fatal("decode failed");
+            cursor = pos + 2;       // single chunk records; skip the 00 00
+        } // end while
+    } // end for rounds
+
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() /
+        (double(RECORDS) * ROUNDS);
+} // end Time_Core
+
+
+/**
+ * @brief the same record through all three cores must end at the same place and
+ *  read back the same
+ */
+void Check(BoltBuf& buf)
+{
+    const DecodeFn cores[] = { &Decode_Threaded, &Decode_Switched };
+    u8* cursor = buf.Data();
+    u8* end = cursor + buf.Size();
+
+    while (cursor < end)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltValue ref;
+        ref.buf = &buf;
+        u8* ref_pos = cursor + 2;
+        if (!jump_table[*ref_pos](ref_pos, ref)) Fatal("jump table failed");
+        const std::string text = ref.ToString();
+
+        for (DecodeFn fn : cores)
+        {
+            BoltValue v;
+            v.buf = &buf;
+            u8* pos = cursor + 2;
+            if (!fn(pos, v) || pos != ref_pos || v.ToString() != text)
+                Fatal("cores disagree at offset %td", cursor - buf.Data());
+        } // end for cores
+
+        Release_Pool<BoltValue>(offset);
+        cursor = ref_pos + 2;
+    } // end while
+} // end Check
+
+
+int main()
+{
+    Utils::Print_Title();
+    const char* shapes[] = { "flat row", "node", "path", "300 ints" };
+
+    // reserved markers fail the same everywhere, nested or not
+    u8 bad[] = { 0x92, 0x01, 0xC7 };
+    for (DecodeFn fn : { DecodeFn(&Decode_Threaded), DecodeFn(&Decode_Switched), jump_table[0x92] })
+    {
+        BoltBuf scratch;
+        BoltValue v;
+        v.buf = &scratch;
+        u8* pos = bad;
+        if (fn(pos, v)) Fatal("reserved marker went through");
+    } // end for
+
+    Utils::Print("%d records x %d rounds, ns/record (computed goto %s)", RECORDS, ROUNDS,
+        LB_COMPUTED_GOTO ? "on" : "off");
+    Utils::Print("  %-10s %12s %12s %12s", "shape", "jump table", "goto", "switch");
+    for (int shape = 0; shape < 4; shape++)
+    {
+        BoltBuf buf(RECORDS * 2048);
+        Fill(buf, shape);
+        Check(buf);
+
+        double table = Time_Core(buf, [](u8*& pos, BoltValue& v) { return jump_table[*pos](pos, v); });
+        double threaded = Time_Core(buf, &Decode_Threaded);
+        double switched = Time_Core(buf, &Decode_Switched);
+        Utils::Print("  %-10s %12.1f %12.1f %12.1f", shapes[shape], table, threaded, switched);
+    } // end for shapes
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
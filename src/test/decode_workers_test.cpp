@@ -0,0 +1,171 @@
+/**
+ * @file decode_workers_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief small queries on some connections while another streams a large
+ *  result through a slow visitor, against bolt://localhost:7687. Run once with
+ *  everything decoded on the polling thread and once with a decode worker per
+ *  connection; the small queries should stall behind the stream in the first
+ *  and not in the second. Pipelined queries on one connection must complete in
+ *  the order sent either way.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <algorithm>
+#include <deque>
+#include "neodriver.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int POOL = 4;
+constexpr int HEAVY_ROWS = 200'000;
+constexpr int PIPELINED = 16;
+constexpr auto RECORD_COST = std::chrono::microseconds(2);   // visitor's work per record
+
+
+
+
+//===============================================================================|
+//          ENUM & TYPES
+//===============================================================================|
+/**
+ * @brief a visitor that takes its time over every record, the way one
+ *  transforming rows into something else would
+ */
+class Slow_Visitor : public BoltVisitor
+{
+public:
+
+    std::atomic<int> rows{ 0 };
+
+    void On_Record_End() override
+    {
+        auto until = Clock::now() + RECORD_COST;
+        while (Clock::now() < until);
+        rows.fetch_add(1, std::memory_order_relaxed);
+    } // end On_Record_End
+};
+
+
+/**
+ * @brief latencies of the small queries made while the stream was on, in µs
+ */
+struct Probe_Stats
+{
+    size_t count;
+    double p50;
+    double p99;
+    double max;
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief pipelines PIPELINED queries on one connection, the i'th returning i
+ *  rows, and checks they complete in the order sent
+ */
+void Check_Order(NeoCell* pcell)
+{
+    static std::deque<std::string> queries;
+    std::atomic<int> next{ 1 };
+    std::atomic<bool> broken{ false };
+
+    for (int i = 1; i <= PIPELINED; i++)
+    {
+        const std::string& q = queries.emplace_back("UNWIND range(1, " + std::to_string(i) + ") AS n RETURN n");
+        pcell->Run_Async([&next, &broken, i](BoltResult& res) {
+                if (res.message_count != u32(i) || next.load(std::memory_order_acquire) != i)
+                    broken.store(true, std::memory_order_relaxed);
+                next.fetch_add(1, std::memory_order_release);
+            }, q.c_str());
+    } // end for
+
+    while (next.load(std::memory_order_acquire) <= PIPELINED)
+        std::this_thread::yield();
+    if (broken.load()) Fatal("pipelined results completed out of order");
+} // end Check_Order
+
+
+/**
+ * @brief streams HEAVY_ROWS records on the first connection and round trips
+ *  single row queries on the others until it's done
+ */
+Probe_Stats Run_Mode(const int workers)
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(),
+        POOL, workers);
+    auto& cells = driver.Get_Pool()->Workers();
+    if (driver.Get_Decode_Workers() != workers) Fatal("%d decode workers running", driver.Get_Decode_Workers());
+
+    Check_Order(cells[1].get());
+
+    static const std::string heavy = "UNWIND range(1, " + std::to_string(HEAVY_ROWS) + ") AS n RETURN n";
+    Slow_Visitor visitor;
+    std::atomic<bool> streamed{ false };
+    cells[0]->Run_Streamed(&visitor, [&streamed](BoltResult&) {
+            streamed.store(true, std::memory_order_release);
+        }, heavy.c_str());
+
+    std::vector<double> lat;
+    for (int k = 0; !streamed.load(std::memory_order_acquire); k++)
+    {
+        std::atomic<bool> done{ false };
+        auto t0 = Clock::now();
+        cells[1 + k % (POOL - 1)]->Run_Async([&done](BoltResult&) {
+                done.store(true, std::memory_order_release);
+            }, "RETURN 1");
+        while (!done.load(std::memory_order_acquire))
+            std::this_thread::yield();
+        lat.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+    } // end for
+
+    if (visitor.rows.load() != HEAVY_ROWS) Fatal("streamed %d rows of %d", visitor.rows.load(), HEAVY_ROWS);
+    driver.Close();
+
+    std::sort(lat.begin(), lat.end());
+    if (lat.empty()) return { 0, 0, 0, 0 };
+    return { lat.size(), lat[lat.size() / 2], lat[lat.size() * 99 / 100], lat.back() };
+} // end Run_Mode
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    Utils::Print("%d connections, %d records streamed on one at %lld us each",
+        POOL, HEAVY_ROWS, static_cast<long long>(RECORD_COST.count()));
+    Utils::Print("%-22s %8s %10s %10s %10s", "", "queries", "p50 us", "p99 us", "max us");
+
+    for (int workers : { 0, POOL })
+    {
+        Probe_Stats s = Run_Mode(workers);
+        Utils::Print("%-22s %8zu %10.1f %10.1f %10.1f",
+            workers ? "decode workers" : "polling thread", s.count, s.p50, s.p99, s.max);
+    } // end for
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -30,7 +30,7 @@ int main()
     
 	BoltResult result;
     driver.Execute_Async(
-        [](BoltResult& result)
+        [&driver](BoltResult& result)
         {
             if (result.error) Fatal("%s", driver.Get_Last_Error().c_str());
 
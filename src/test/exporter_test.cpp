@@ -0,0 +1,263 @@
+/**
+ * @file exporter_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the OpenMetrics exporter. Offline, the text written must follow the
+ *  format; counters end in _total, histogram buckets are cumulative and end at
+ *  +Inf with the count, and the text ends in # EOF. The exporter must serve it
+ *  to a Unix socket client, answer a GET on its loopback port and refuse other
+ *  methods, and dump it into a file every period without leaving a partial one.
+ *  Given "live" as the first argument it also scrapes a driver connected to
+ *  bolt://localhost:7687 over HTTP after running some queries.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "neodriver.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr const char* SOCKET_PATH = "/tmp/lightningbolt_exporter_test.sock";
+constexpr const char* FILE_PATH = "/tmp/lightningbolt_exporter_test.prom";
+constexpr int LIVE_QUERIES = 500;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief some text in the format, from a histogram of known samples
+ */
+std::string Sample_Text(const u64 scrape)
+{
+    LatencyHistogram h;
+    for (u64 us : { 5, 40, 40, 300, 2'000, 70'000 })
+        h.Record_Latency(std::chrono::microseconds(us));
+
+    OpenMetricsWriter w;
+    w.Counter("test_scrapes", "Scrapes served.", scrape);
+    w.Counter("test_received_bytes", "Bytes in.", 1024, "bytes");
+    w.Gauge("test_depth", "Queue depth.");
+    w.Sample("test_depth", "cell=\"0\"", 3);
+    w.Sample("test_depth", "cell=\"1\"", 0);
+    w.Histogram("test_latency_seconds", "Latency.");
+    w.Buckets("test_latency_seconds", "stage=\"all\"", h);
+    return w.Finish();
+} // end Sample_Text
+
+
+/**
+ * @brief the value of the sample line starting with prefix, -1 if none
+ */
+double Value_Of(const std::string& text, const std::string& prefix)
+{
+    size_t at = text.find("\n" + prefix + " ");
+    if (at == std::string::npos) return -1;
+    return atof(text.c_str() + at + prefix.size() + 2);
+} // end Value_Of
+
+
+/**
+ * @brief the format of what the writer puts out
+ */
+void Format()
+{
+    std::string text = Sample_Text(7);
+
+    if (text.size() < 6 || text.substr(text.size() - 6) != "# EOF\n") Fatal("no # EOF at the end");
+    if (Value_Of(text, "test_scrapes_total") != 7 || Value_Of(text, "test_received_bytes_total") != 1024)
+        Fatal("counter samples");
+    if (text.find("# UNIT test_received_bytes bytes") == std::string::npos ||
+        text.find("# TYPE test_latency_seconds histogram") == std::string::npos)
+        Fatal("family lines");
+    if (Value_Of(text, "test_depth{cell=\"0\"}") != 3) Fatal("gauge sample");
+
+    // 5 and 40 us are under 50 us, 300 us under 500 us, all but the 70 ms under 25 ms
+    const char* b = "test_latency_seconds_bucket{stage=\"all\",le=";
+    if (Value_Of(text, std::string(b) + "\"1e-05\"}") != 1 || Value_Of(text, std::string(b) + "\"5e-05\"}") != 3 ||
+        Value_Of(text, std::string(b) + "\"0.0005\"}") != 4 || Value_Of(text, std::string(b) + "\"0.025\"}") != 5 ||
+        Value_Of(text, std::string(b) + "\"+Inf\"}") != 6 ||
+        Value_Of(text, "test_latency_seconds_count{stage=\"all\"}") != 6)
+        Fatal("histogram buckets:\n%s", text.c_str());
+
+    double sum = Value_Of(text, "test_latency_seconds_sum{stage=\"all\"}");
+    if (std::abs(sum - 0.072385) > 1e-6) Fatal("histogram sum %f", sum);
+    Utils::Print("format: %zu bytes, counters, gauges and cumulative buckets as expected", text.size());
+} // end Format
+
+
+/**
+ * @brief reads until the peer closes
+ */
+std::string Read_All(const int fd)
+{
+    std::string out;
+    char buf[4096];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0)
+        out.append(buf, size_t(n));
+    return out;
+} // end Read_All
+
+
+/**
+ * @brief a Unix socket client gets the text on connecting
+ */
+void Unix_Socket()
+{
+    std::atomic<u64> scrapes{ 0 };
+    MetricsExporter exporter;
+    LBStatus rc = exporter.Start({ ExportMode::Unix_Socket, SOCKET_PATH }, [&] { return Sample_Text(++scrapes); });
+    if (!LB_OK(rc)) Fatal("unix listen: errno %u", LB_Aux(rc));
+
+    for (u64 i = 1; i <= 3; i++)
+    {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, SOCKET_PATH);
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) Fatal("unix connect");
+
+        std::string text = Read_All(fd);
+        close(fd);
+        if (Value_Of(text, "test_scrapes_total") != double(i)) Fatal("unix scrape %llu", (unsigned long long)i);
+    } // end for
+
+    exporter.Stop();
+    if (access(SOCKET_PATH, F_OK) == 0) Fatal("socket left behind");
+    Utils::Print("unix socket: 3 scrapes served, path removed on stop");
+} // end Unix_Socket
+
+
+/**
+ * @brief sends a request to 127.0.0.1:port and returns the whole response
+ */
+std::string Http(const u16 port, const std::string& request)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) Fatal("http connect");
+
+    send(fd, request.data(), request.size(), 0);
+    std::string response = Read_All(fd);
+    close(fd);
+    return response;
+} // end Http
+
+
+/**
+ * @brief GETs served, anything else refused
+ */
+void Http_Endpoint()
+{
+    MetricsExporter exporter;
+    LBStatus rc = exporter.Start({ ExportMode::Http, "", 0 }, [] { return Sample_Text(1); });
+    if (!LB_OK(rc) || !exporter.Port()) Fatal("http listen: errno %u", LB_Aux(rc));
+
+    std::string ok = Http(exporter.Port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    size_t body = ok.find("\r\n\r\n");
+    if (ok.compare(0, 15, "HTTP/1.1 200 OK") || ok.find(OPENMETRICS_TYPE) == std::string::npos ||
+        body == std::string::npos || ok.substr(body + 4) != Sample_Text(1))
+        Fatal("GET:\n%s", ok.c_str());
+
+    std::string refused = Http(exporter.Port(), "POST /metrics HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+    if (refused.compare(0, 12, "HTTP/1.1 405")) Fatal("POST:\n%s", refused.c_str());
+
+    u16 port = exporter.Port();
+    exporter.Stop();
+    if (exporter.Mode() != ExportMode::None) Fatal("still exporting after stop");
+    Utils::Print("http: GET served on 127.0.0.1:%u, POST refused", port);
+} // end Http_Endpoint
+
+
+/**
+ * @brief the file dumped at start and every period after
+ */
+void File_Dump()
+{
+    std::atomic<u64> dumps{ 0 };
+    MetricsExporter exporter;
+    LBStatus rc = exporter.Start({ ExportMode::File, FILE_PATH, 0, std::chrono::milliseconds(20) },
+        [&] { return Sample_Text(++dumps); });
+    if (!LB_OK(rc)) Fatal("file dump: errno %u", LB_Aux(rc));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    exporter.Stop();
+
+    std::ifstream in(FILE_PATH);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (dumps.load() < 3 || Value_Of(text, "test_scrapes_total") != double(dumps.load()))
+        Fatal("file: %llu dumps, file has %.0f", (unsigned long long)dumps.load(), Value_Of(text, "test_scrapes_total"));
+    if (access((std::string(FILE_PATH) + ".tmp").c_str(), F_OK) == 0) Fatal("partial dump left behind");
+    unlink(FILE_PATH);
+
+    MetricsExporter bad;
+    if (LB_OK(bad.Start({ ExportMode::File, "/nonexistent/dir/metrics.prom" }, [] { return std::string(); })))
+        Fatal("dump into a missing directory started");
+    Utils::Print("file: %llu dumps, the last one whole", (unsigned long long)dumps.load());
+} // end File_Dump
+
+
+/**
+ * @brief a live driver scraped over HTTP
+ */
+void Live()
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 2);
+    if (!LB_OK(driver.Set_Exporter({ ExportMode::Http, "", 0 }))) Fatal("live: exporter");
+
+    std::atomic<int> done{ 0 };
+    for (int i = 0; i < LIVE_QUERIES; i++)
+        driver.Execute_Async([&done](BoltResult&) { done.fetch_add(1, std::memory_order_release); },
+            "RETURN 1 AS n");
+    while (done.load(std::memory_order_acquire) < LIVE_QUERIES)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    std::string text = Http(driver.Exporter_Port(), "GET /metrics HTTP/1.1\r\n\r\n");
+    if (Value_Of(text, "lightningbolt_queries_total") < LIVE_QUERIES ||
+        text.find("lightningbolt_cell_recv_paused{cell=") == std::string::npos ||
+        text.find("lightningbolt_query_stage_seconds_bucket{stage=\"first_byte\"") == std::string::npos)
+        Fatal("live scrape:\n%s", text.c_str());
+    Utils::Print("live: %zu bytes scraped, %.0f queries", text.size(), Value_Of(text, "lightningbolt_queries_total"));
+    driver.Close();
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    Format();
+    Unix_Socket();
+    Http_Endpoint();
+    File_Dump();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
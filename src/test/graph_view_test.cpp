@@ -0,0 +1,266 @@
+/**
+ * @file graph_view_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief records of [node, relationship, path, optional node, collected nodes]
+ *  read through NodeView, RelView and PathView with Fetch_As and off decoded
+ *  BoltValues. The path goes a -KNOWS-> b <-LIKES- c so the second hop must come
+ *  back pointing the other way. Then times pulling a few fields out of each
+ *  against walking the same BoltValues by index.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <deque>
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_result.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int RECORDS = 20'000;
+constexpr int ROUNDS = 10;
+
+using Graph_Row = std::tuple<NodeView, RelView, PathView, std::optional<NodeView>,
+    std::vector<NodeView>>;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief Node{id, labels, {name, age}, element_id}; BoltValue strings only point
+ *  at their text, so it's kept in keep until encoded.
+ */
+BoltValue Make_Node(const s64 id, std::deque<std::string>& keep)
+{
+    const std::string& name = keep.emplace_back("person " + std::to_string(id));
+    const std::string& element_id = keep.emplace_back("4:db:" + std::to_string(id));
+
+    return BoltValue(BOLT_NODE, {
+        BoltValue::Make_Int(id),
+        BoltValue({ "Person", "Customer" }),
+        BoltValue({
+            mp("name", BoltValue(name)),
+            mp("age", BoltValue::Make_Int(20 + id % 60)) }),
+        BoltValue(element_id) });
+} // end Make_Node
+
+
+/**
+ * @brief an unbound relationship; {since: id}
+ */
+BoltValue Make_Unbound(const s64 id, const char* type, std::deque<std::string>& keep)
+{
+    return BoltValue(BOLT_UNBOUND_REL, {
+        BoltValue::Make_Int(id),
+        BoltValue(type),
+        BoltValue({ mp("since", BoltValue::Make_Int(2000 + id % 20)) }),
+        BoltValue(keep.emplace_back("5:db:" + std::to_string(id))) });
+} // end Make_Unbound
+
+
+/**
+ * @brief fills buf with the records; row i is about node 3i, 3i + 1 and 3i + 2
+ */
+void Fill_Records(BoltBuf& buf)
+{
+    BoltEncoder encoder(buf);
+    for (int i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        const s64 a = 3 * i, b = a + 1, c = a + 2;
+        std::deque<std::string> keep;
+
+        BoltValue rel(BOLT_RELATIONSHIP, {
+            BoltValue::Make_Int(i), BoltValue::Make_Int(a), BoltValue::Make_Int(b),
+            BoltValue("KNOWS"), BoltValue({ mp("since", BoltValue::Make_Int(2001)) }),
+            BoltValue(keep.emplace_back("5:db:" + std::to_string(i))),
+            BoltValue(keep.emplace_back("4:db:" + std::to_string(a))),
+            BoltValue(keep.emplace_back("4:db:" + std::to_string(b))) });
+
+        // a -[KNOWS]-> b <-[LIKES]- c
+        BoltValue path(BOLT_PATH, {
+            BoltValue({ Make_Node(a, keep), Make_Node(b, keep), Make_Node(c, keep) }),
+            BoltValue({ Make_Unbound(i, "KNOWS", keep), Make_Unbound(i + 1, "LIKES", keep) }),
+            BoltValue({ 1, 1, -2, 2 }) });
+
+        BoltValue maybe = i & 1 ? Make_Node(c, keep) : BoltValue::Make_Null();
+
+        BoltMessage rec(BoltValue(BOLT_RECORD, {
+            BoltValue({ Make_Node(a, keep), rel, path, maybe,
+                BoltValue({ Make_Node(b, keep), Make_Node(c, keep) }) })
+        }));
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+} // end Fill_Records
+
+
+/**
+ * @brief checks node against what Make_Node(id) wrote
+ */
+bool Node_Is(const NodeView& n, const s64 id)
+{
+    std::string_view name;
+    s64 age = 0;
+    std::vector<std::string_view> labels;
+    for (std::string_view l : n.labels) labels.push_back(l);
+
+    return n.id == id && n.element_id == "4:db:" + std::to_string(id) &&
+        labels.size() == 2 && labels[0] == "Person" && labels[1] == "Customer" &&
+        n.labels.Has("Customer") && !n.labels.Has("Admin") &&
+        n.props.size() == 2 && n.props.Get("name", name) && name == "person " + std::to_string(id) &&
+        n.props.Get("age", age) && age == 20 + id % 60 && !n.props.Get("name", age);
+} // end Node_Is
+
+
+/**
+ * @brief checks one decoded row
+ */
+void Check_Row(const Graph_Row& row, const int i)
+{
+    const auto& [node, rel, path, maybe, nodes] = row;
+    const s64 a = 3 * i, b = a + 1, c = a + 2;
+
+    if (!Node_Is(node, a)) Fatal("row %d: node", i);
+
+    s64 since = 0;
+    if (!rel.bound || rel.id != i || rel.start_id != a || rel.end_id != b || rel.type != "KNOWS" ||
+        rel.start_element_id != "4:db:" + std::to_string(a) ||
+        !rel.props.Get("since", since) || since != 2001)
+        Fatal("row %d: relationship", i);
+
+    if ((i & 1) != maybe.has_value() || (maybe && !Node_Is(*maybe, c)))
+        Fatal("row %d: optional node", i);
+    if (nodes.size() != 2 || !Node_Is(nodes[0], b) || !Node_Is(nodes[1], c))
+        Fatal("row %d: collected nodes", i);
+
+    // a -[KNOWS]-> b <-[LIKES]- c
+    NodeView n;
+    RelView r;
+    if (path.Length() != 2) Fatal("row %d: path length %zu", i, path.Length());
+    for (size_t k = 0; k <= path.Length(); k++)
+        if (!path.Node(k, n) || !Node_Is(n, a + s64(k))) Fatal("row %d: path node %zu", i, k);
+
+    if (!path.Rel(0, r) || r.bound || r.type != "KNOWS" || r.start_id != a || r.end_id != b)
+        Fatal("row %d: first hop", i);
+    if (!path.Rel(1, r) || r.type != "LIKES" || r.start_id != c || r.end_id != b ||
+        r.end_element_id != "4:db:" + std::to_string(b) || r.element_id != "5:db:" + std::to_string(i + 1))
+        Fatal("row %d: second hop", i);
+    if (path.Node(3, n) || path.Rel(2, r)) Fatal("row %d: walked off the path", i);
+} // end Check_Row
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    BoltBuf buf;
+    Fill_Records(buf);
+
+    BoltDecoder decoder(buf);
+    BoltResult result;
+    result.pdec = &decoder;
+    result.start_offset = 0;
+    result.total_bytes = buf.Size();
+    result.message_count = RECORDS;
+
+    // Fetch_As
+    std::vector<Graph_Row> rows;
+    LBStatus rc = result.Fetch_As(rows);
+    if (!LB_OK(rc) || rows.size() != RECORDS) Fatal("Fetch_As got %zu rows", rows.size());
+    for (int i = 0; i < RECORDS; i++)
+        Check_Row(rows[i], i);
+    Utils::Print("Fetch_As: %d rows of node, relationship, path, optional and list check out", RECORDS);
+
+    // a node where a relationship should be is a type error, not a misread
+    std::vector<std::tuple<RelView>> wrong;
+    rc = result.Fetch_As(wrong);
+    if (LB_Code(rc) != u8(LBCode::LB_CODE_TYPE) || LB_Aux(rc) != RECORDS)
+        Fatal("node read as a relationship");
+
+    // off decoded BoltValues
+    int i = 0;
+    for (auto rec : result)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltValue list = rec(0);
+        Graph_Row row;
+        auto& [node, rel, path, maybe, nodes] = row;
+        if (!NodeView::From(list(0), node) || !RelView::From(list(1), rel) ||
+            !PathView::From(list(2), path) || PathView::From(list(0), path))
+            Fatal("row %d: views off BoltValues", i);
+
+        // From() reads the fields in place; reuse the Fetch_As rows for the rest
+        std::get<3>(row) = std::get<3>(rows[i]);
+        std::get<4>(row) = std::get<4>(rows[i]);
+        Check_Row(row, i++);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+
+    // timing; id and name of the first node, type of the relationship, where
+    //  the path ends
+    double value_ns = 0, view_ns = 0;
+    size_t sum = 0;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        auto t0 = Clock::now();
+        for (auto rec : result)
+        {
+            size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+            BoltValue list = rec(0);
+            BoltValue node = list(0), rel = list(1), path = list(2);
+            BoltValue props = node(2);
+            BoltValue name = props["name"], type = rel(3);
+            BoltValue indices = path(2), nodes = path(0);
+            BoltValue last = nodes(indices(3).int_val);
+            sum += node(0).int_val + name.str_val.length + type.str_val.length + last(0).int_val;
+            Release_Pool<BoltValue>(offset);
+        } // end for values
+        auto t1 = Clock::now();
+
+        std::vector<std::tuple<NodeView, RelView, PathView>> views;
+        result.Fetch_As(views);
+        for (auto& [node, rel, path] : views)
+        {
+            std::string_view name;
+            NodeView last;
+            node.props.Get("name", name);
+            path.Node(path.Length(), last);
+            sum -= node.id + name.size() + rel.type.size() + last.id;
+        } // end for views
+        auto t2 = Clock::now();
+
+        value_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        view_ns += std::chrono::duration<double, std::nano>(t2 - t1).count();
+    } // end for rounds
+
+    if (sum) Fatal("views and BoltValues disagree");
+
+    Utils::Print("%d records x %d rounds", RECORDS, ROUNDS);
+    Utils::Print("  BoltValue by index: %.1f ns/row", value_ns / (double(RECORDS) * ROUNDS));
+    Utils::Print("  graph views:        %.1f ns/row", view_ns / (double(RECORDS) * ROUNDS));
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
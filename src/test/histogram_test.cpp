@@ -0,0 +1,149 @@
+/**
+ * @file histogram_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief LatencyHistogram percentiles against the exact ones of sorted samples;
+ *  uniform, log-normal and sub-microsecond latencies must read back within the
+ *  histogram's precision, where the power of two buckets it replaced could be 2x
+ *  off (shown along side). Merging two halves must give the histogram of the
+ *  whole and a serialized histogram must read back the same, refusing another
+ *  precision. Also times Record_Latency().
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <random>
+#include "neodriver.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t SAMPLES = 1'000'000;
+constexpr double PERCENTILES[] = { 0.5, 0.9, 0.99, 0.999, 0.9999 };
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief the old power of two estimate, 1 << (bucket + 1)
+ */
+u64 Pow2_Estimate(const std::vector<u64>& sorted, const double p)
+{
+    u64 v = sorted[size_t(std::ceil(p * sorted.size())) - 1] | 1;
+    return 1ULL << (64 - std::countl_zero(v));
+} // end Pow2_Estimate
+
+
+/**
+ * @brief records samples and checks every percentile is within the precision
+ *
+ * @return the histogram, for the merge and serialize checks
+ */
+LatencyHistogram Check(const char* name, std::vector<u64> samples)
+{
+    LatencyHistogram h;
+    for (u64 ns : samples)
+        h.Record_Latency(std::chrono::nanoseconds(ns));
+    std::sort(samples.begin(), samples.end());
+
+    Utils::Print("%-12s %8s %14s %14s %10s %12s", name, "p", "exact ns", "hdr ns", "hdr err", "pow2 err");
+    for (double p : PERCENTILES)
+    {
+        u64 exact = samples[size_t(std::ceil(p * samples.size())) - 1];
+        u64 got = h.Percentile_Ns(p);
+        double err = std::abs(double(got) - double(exact)) / double(exact);
+        double pow2_err = std::abs(double(Pow2_Estimate(samples, p)) - double(exact)) / double(exact);
+        Utils::Print("%-12s %8.4f %14llu %14llu %9.3f%% %11.1f%%", "", p, (unsigned long long)exact,
+            (unsigned long long)got, err * 100, pow2_err * 100);
+        if (err > 0.01) Fatal("%s p%.4f: %llu for %llu", name, p, (unsigned long long)got, (unsigned long long)exact);
+    } // end for
+
+    if (h.samples != samples.size() || u64(h.best_latency.count()) != samples.front() ||
+        u64(h.worst_latency.count()) != samples.back())
+        Fatal("%s: totals", name);
+    return h;
+} // end Check
+
+
+int main()
+{
+    Utils::Print_Title();
+    std::mt19937_64 rng(41);
+
+    std::vector<u64> uniform(SAMPLES), lognormal(SAMPLES), tiny(SAMPLES);
+    std::uniform_int_distribution<u64> u(1, 10'000'000);
+    std::lognormal_distribution<double> ln(13.0, 1.2);     // ~0.4 ms median, long tail
+    std::uniform_int_distribution<u64> t(50, 900);
+    for (size_t i = 0; i < SAMPLES; i++)
+    {
+        uniform[i] = u(rng);
+        lognormal[i] = std::max<u64>(1, u64(ln(rng)));
+        tiny[i] = t(rng);
+    } // end for
+
+    Check("uniform", uniform);
+    LatencyHistogram whole = Check("log-normal", lognormal);
+    LatencyHistogram small = Check("sub-us", tiny);
+    if (small.Percentile_Us(0.5) <= 0.0) Fatal("sub-microsecond latency read as 0");
+
+    // what the tests printing whole milliseconds lose; NeoCell::Percentile_Us() reads the same
+    Utils::Print("log-normal: p50 %.1f us, p95 %.1f us, p99 %.1f us, p99.9 %.1f us; p99 %llu ms in whole ms",
+        whole.Percentile_Us(0.50), whole.Percentile_Us(0.95), whole.Percentile_Us(0.99),
+        whole.Percentile_Us(0.999), (unsigned long long)std::chrono::duration_cast<std::chrono::milliseconds>(
+            whole.Percentile(0.99)).count());
+    Utils::Print("sub-us:     p50 %.3f us, p99 %.3f us; p99 %llu ms in whole ms", small.Percentile_Us(0.50),
+        small.Percentile_Us(0.99), (unsigned long long)std::chrono::duration_cast<std::chrono::milliseconds>(
+            small.Percentile(0.99)).count());
+
+    // halves merged give the whole
+    LatencyHistogram a, b;
+    for (size_t i = 0; i < SAMPLES; i++)
+        (i & 1 ? a : b).Record_Latency(std::chrono::nanoseconds(lognormal[i]));
+    a.Merge(b);
+    if (a.samples != whole.samples || memcmp(a.latency_hist, whole.latency_hist, sizeof(a.latency_hist)) ||
+        a.best_latency != whole.best_latency || a.worst_latency != whole.worst_latency)
+        Fatal("merge differs from the whole");
+
+    // serialized and read back
+    std::string line = whole.Serialize();
+    LatencyHistogram back;
+    if (!back.Deserialize(line) || back.Serialize() != line || back.Percentile(0.999) != whole.Percentile(0.999))
+        Fatal("serialize round trip");
+    Utils::Print("serialized: %zu bytes for %llu samples, p99.9 %.1f us both sides", line.size(),
+        (unsigned long long)whole.samples, back.Percentile_Us(0.999));
+    HdrHistogram<3> finer;
+    if (finer.Deserialize(line)) Fatal("read a histogram of another precision");
+    if (back.Deserialize("LBHDR1 2 5 1 9 20 130:4")) Fatal("read a histogram missing counts");
+
+    // cost of a record
+    LatencyHistogram h;
+    auto t0 = Clock::now();
+    for (u64 ns : lognormal)
+        h.Record_Latency(std::chrono::nanoseconds(ns));
+    double per = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / SAMPLES;
+    Utils::Print("Record_Latency: %.2f ns, %zu bytes of counts, p50 %.1f us", per, sizeof(h.latency_hist),
+        h.Percentile_Us(0.5));
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,290 @@
+/**
+ * @file json_transcode_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief PackStream to JSON without BoltValues. Strings of every length with
+ *  something to escape at every position go through the SSE2 path and must
+ *  match a byte at a time escape; records with scalars, graph structs and
+ *  temporals must come out in the documented shapes, keyed by the RUN fields,
+ *  as an array or NDJSON. Then times To_Json against ToString()'ing the
+ *  BoltValues the way the web tier does.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <deque>
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_result.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int RECORDS = 20'000;
+constexpr int ROUNDS = 10;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a byte at a time JSON escape to hold the fast one to
+ */
+std::string Slow_Escape(std::string_view s)
+{
+    std::string out = "\"";
+    char hex[8];
+    for (unsigned char c : s)
+    {
+        switch (c)
+        {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        case '\b': out += "\\b"; break;
+        case '\f': out += "\\f"; break;
+        default:
+            if (c < 0x20) { snprintf(hex, sizeof(hex), "\\u%04x", c); out += hex; }
+            else out += char(c);
+        } // end switch
+    } // end for
+
+    return out + "\"";
+} // end Slow_Escape
+
+
+/**
+ * @brief what's in out as a string, then empties it
+ */
+std::string Take(BoltBuf& out)
+{
+    std::string s(reinterpret_cast<const char*>(out.Data()), out.Size());
+    out.Reset();
+    return s;
+} // end Take
+
+
+/**
+ * @brief the JSON of the packed value in bytes
+ */
+std::string Transcode(std::initializer_list<u8> bytes)
+{
+    std::vector<u8> in(bytes);
+    BoltBuf out;
+    const u8* p = in.data();
+    if (!LB_OK(Json_Value(p, in.data() + in.size(), out)) || p != in.data() + in.size())
+        return "<failed>";
+    return Take(out);
+} // end Transcode
+
+
+/**
+ * @brief encodes a RUN SUCCESS with the field names then the records; the
+ *  first record is the one checked to the byte, the rest are for timing.
+ *
+ * @return offset of the first record
+ */
+size_t Fill(BoltBuf& buf)
+{
+    BoltEncoder encoder(buf);
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    BoltMessage run(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("t_first", BoltValue::Make_Int(1)),
+        mp("fields", BoltValue({ "id", "name", "score", "node", "rel", "path", "when", "misc" })) }) }));
+    encoder.Encode(run);
+    Release_Pool<BoltValue>(offset);
+    const size_t first = buf.Size();
+
+    for (int i = 0; i < RECORDS; i++)
+    {
+        offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        std::deque<std::string> keep;
+        const std::string& name = keep.emplace_back(i ? "person " + std::to_string(i) :
+            "Ab\"e\\be \xE1\x88\xB0\n\x01 tab\there");
+
+        auto node = [&](s64 id) {
+            return BoltValue(BOLT_NODE, { BoltValue::Make_Int(id), BoltValue({ "Person" }),
+                BoltValue({ mp("age", BoltValue::Make_Int(30)) }),
+                BoltValue(keep.emplace_back("4:x:" + std::to_string(id))) });
+        };
+
+        BoltValue rel(BOLT_RELATIONSHIP, { BoltValue::Make_Int(9), BoltValue::Make_Int(1),
+            BoltValue::Make_Int(2), BoltValue("KNOWS"), BoltValue::Make_Map(),
+            BoltValue("5:x:9"), BoltValue("4:x:1"), BoltValue("4:x:2") });
+
+        // 1 <-LIKES- 2
+        BoltValue path(BOLT_PATH, { BoltValue({ node(1), node(2) }),
+            BoltValue({ BoltValue(BOLT_UNBOUND_REL, { BoltValue::Make_Int(7), BoltValue("LIKES"),
+                BoltValue::Make_Map(), BoltValue("5:x:7") }) }),
+            BoltValue({ -1, 1 }) });
+
+        BoltValue when({
+            BoltValue(0x44, { BoltValue::Make_Int(20742) }),
+            BoltValue(0x49, { BoltValue::Make_Int(1792147530), BoltValue::Make_Int(500000000),
+                BoltValue::Make_Int(10800) }),
+            BoltValue(0x69, { BoltValue::Make_Int(1792147530), BoltValue::Make_Int(0),
+                BoltValue("Africa/Addis_Ababa") }),
+            BoltValue(0x74, { BoltValue::Make_Int(49530000000000ll) }),
+            BoltValue(0x45, { BoltValue::Make_Int(14), BoltValue::Make_Int(3),
+                BoltValue::Make_Int(7), BoltValue::Make_Int(250000000) }) });
+
+        BoltValue misc({ BoltValue::Make_Null(), true, 1e300, -0.5,
+            BoltValue(0x58, { BoltValue::Make_Int(4326), BoltValue::Make_Float(38.75),
+                BoltValue::Make_Float(9.0) }),
+            BoltValue(0x7A, { BoltValue::Make_Int(1) }) });
+
+        BoltMessage rec(BoltValue(BOLT_RECORD, {
+            BoltValue({ BoltValue::Make_Int(s64(i) << 40), BoltValue(name), i * 0.25,
+                node(1), rel, path, when, misc })
+        }));
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+
+    return first;
+} // end Fill
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    // escaping; a special byte at every position of every length up to 80
+    BoltBuf out;
+    const char specials[] = { '"', '\\', '\n', '\x01', '\x1F', 'x', '\x7F' };
+    for (size_t len = 0; len <= 80; len++)
+        for (char special : specials)
+            for (size_t at = 0; at < std::max<size_t>(len, 1); at++)
+            {
+                std::string s(len, 'a');
+                for (size_t k = 0; k < len; k++) s[k] = char(0x20 + (k * 7) % 0x5F);
+                if (len) s[at] = special;
+                if (len > 3) s[len - 2] = '\xC3';       // a stray non-ASCII byte goes through as is
+
+                Json_String(s, out);
+                if (Take(out) != Slow_Escape(s))
+                    Fatal("escape differs; length %zu, special %02x at %zu", len, u8(special), at);
+            } // end for at
+
+    // scalars
+    const std::pair<std::string, std::string> scalars[] = {
+        { Transcode({ 0xCC, 0x04, 'a', 'b', 'c', 'd' }), "\"YWJjZA==\"" },
+        { Transcode({ 0xCC, 0x02, 0xFF, 0x00 }), "\"/wA=\"" },
+        { Transcode({ 0xCC, 0x00 }), "\"\"" },
+        { Transcode({ 0xC1, 0x7F, 0xF8, 0, 0, 0, 0, 0, 0 }), "\"NaN\"" },
+        { Transcode({ 0xC1, 0xFF, 0xF0, 0, 0, 0, 0, 0, 0 }), "\"-Infinity\"" },
+        { Transcode({ 0xCB, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }), "9223372036854775807" },
+        { Transcode({ 0xA1, 0x81, 'k', 0x90 }), "{\"k\":[]}" },
+        { Transcode({ 0xB1, 0x44, 0xC9, 0x80, 0x00 }), "\"1880-04-14\"" },
+        { Transcode({ 0xB4, 0x45, 0x00, 0x00, 0xFF, 0xCA, 0x1D, 0xCD, 0x65, 0x00 }), "\"P0M0DT-0.5S\"" },
+        { Transcode({ 0xB2, 0x54, 0x00, 0xC9, 0xF1, 0xF0 }), "\"00:00:00-01:00\"" },
+        { Transcode({ 0xC7 }), "<failed>" },
+        { Transcode({ 0x92, 0x01 }), "<failed>" },
+        { Transcode({ 0xA1, 0x01, 0x01 }), "<failed>" },
+    };
+    for (auto& [got, want] : scalars)
+        if (got != want) Fatal("scalar: got %s, want %s", got.c_str(), want.c_str());
+
+    // records
+    BoltBuf buf(RECORDS * 1024);
+    const size_t first = Fill(buf);
+
+    BoltDecoder decoder(buf);
+    BoltResult result;
+    decoder.Decode(buf.Data(), result.fields);
+    result.pdec = &decoder;
+    result.start_offset = first;
+    result.total_bytes = buf.Size() - first;
+    result.message_count = RECORDS;
+
+    const std::string want =
+        "{\"id\":0,\"name\":\"Ab\\\"e\\\\be \xE1\x88\xB0\\n\\u0001 tab\\there\",\"score\":0,"
+        "\"node\":{\"id\":1,\"labels\":[\"Person\"],\"properties\":{\"age\":30},\"elementId\":\"4:x:1\"},"
+        "\"rel\":{\"id\":9,\"startNodeId\":1,\"endNodeId\":2,\"type\":\"KNOWS\",\"properties\":{},"
+        "\"elementId\":\"5:x:9\",\"startNodeElementId\":\"4:x:1\",\"endNodeElementId\":\"4:x:2\"},"
+        "\"path\":{\"nodes\":["
+        "{\"id\":1,\"labels\":[\"Person\"],\"properties\":{\"age\":30},\"elementId\":\"4:x:1\"},"
+        "{\"id\":2,\"labels\":[\"Person\"],\"properties\":{\"age\":30},\"elementId\":\"4:x:2\"}],"
+        "\"relationships\":[{\"id\":7,\"startNodeId\":2,\"endNodeId\":1,\"type\":\"LIKES\",\"properties\":{},"
+        "\"elementId\":\"5:x:7\",\"startNodeElementId\":\"4:x:2\",\"endNodeElementId\":\"4:x:1\"}]},"
+        "\"when\":[\"2026-10-16\",\"2026-10-16T13:45:30.5+03:00\","
+        "\"2026-10-16T10:45:30Z[Africa/Addis_Ababa]\",\"13:45:30\",\"P14M3DT7.25S\"],"
+        "\"misc\":[null,true,1e+300,-0.5,{\"srid\":4326,\"x\":38.75,\"y\":9},{\"tag\":122,\"fields\":[1]}]}";
+
+    LBStatus rc = result.To_Json(out);
+    std::string json = Take(out);
+    if (!LB_OK(rc) || LB_Aux(rc) != RECORDS) Fatal("To_Json wrote %u records", LB_Aux(rc));
+    if (json.compare(0, want.size() + 2, "[" + want + ",") != 0)
+        Fatal("first record:\n%s\nwanted:\n%s", json.substr(1, want.size()).c_str(), want.c_str());
+    if (json.back() != ']' || json.find("\"id\":1099511627776,") == std::string::npos)
+        Fatal("array not closed or second record missing");
+    Utils::Print("record 0: %s", want.c_str());
+
+    rc = result.To_Json(out, JsonLayout::NDJSON);
+    std::string nd = Take(out);
+    if (!LB_OK(rc) || nd.compare(0, want.size() + 1, want + "\n") != 0 ||
+        size_t(std::count(nd.begin(), nd.end(), '\n')) != RECORDS)
+        Fatal("NDJSON layout");
+
+    // without field names, records are arrays
+    BoltMessage no_fields;
+    std::swap(result.fields, no_fields);
+    result.To_Json(out, JsonLayout::NDJSON);
+    if (Take(out).compare(0, 8, "[0,\"Ab\\\"") != 0) Fatal("record as array");
+    std::swap(result.fields, no_fields);
+
+    // timing
+    double tostring_ns = 0, json_ns = 0;
+    size_t bytes = 0;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        std::string text;
+        auto t0 = Clock::now();
+        text += "[";
+        for (auto rec : result)
+        {
+            size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+            text += rec.ToString();
+            text += ",";
+            Release_Pool<BoltValue>(offset);
+        } // end for
+        text += "]";
+        auto t1 = Clock::now();
+
+        result.To_Json(out);
+        auto t2 = Clock::now();
+        bytes = out.Size();
+        out.Reset();
+
+        tostring_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        json_ns += std::chrono::duration<double, std::nano>(t2 - t1).count();
+    } // end for rounds
+
+    Utils::Print("%d records x %d rounds, %zu bytes of JSON per round", RECORDS, ROUNDS, bytes);
+    Utils::Print("  BoltValue ToString: %.1f ns/row", tostring_ns / (double(RECORDS) * ROUNDS));
+    Utils::Print("  To_Json:            %.1f ns/row, %.0f MB/s", json_ns / (double(RECORDS) * ROUNDS),
+        double(bytes) * ROUNDS / (json_ns / 1e3));
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
@@ -0,0 +1,191 @@
+/**
+ * @file load_gen_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the open loop load generator, against the local Bolt stand-in so no
+ *  server is needed. A steady load must get every query it scheduled done at
+ *  about the rate asked for, with the mix's shares and the stand-in's records.
+ *  Then the stand-in stalls mid measure with the sender capped to a few queries
+ *  in flight: the latency counted from the scheduled starts must carry the
+ *  stall over every query held up behind it, while the latency counted from
+ *  the sends, as a closed loop would, hides it all but for the few caught out.
+ *  Given "live" as the first argument the steady load also runs against
+ *  bolt://localhost:7687.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neoload.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+using namespace std::chrono_literals;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr u32 ROWS = 20;                // per query from the stand-in
+constexpr double RATE = 2'000;          // queries per second
+constexpr int CONNECTIONS = 2;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief prints a report's percentiles
+ */
+void Print_Report(const char* what, const LoadReport& r)
+{
+    Utils::Print("%s: %llu scheduled, %llu done, %llu failed, %llu timed out; %.0f/s, %llu records",
+        what, (unsigned long long)r.scheduled, (unsigned long long)r.completed, (unsigned long long)r.failed,
+        (unsigned long long)r.timed_out, r.Achieved_Rate(), (unsigned long long)r.records);
+    Utils::Print("%s: latency p50 %.1f us, p95 %.1f us, p99 %.1f us, max %.1f us", what,
+        r.latency.Percentile_Us(0.5), r.latency.Percentile_Us(0.95), r.latency.Percentile_Us(0.99),
+        r.latency.Percentile_Us(1.0));
+    Utils::Print("%s: service p50 %.1f us, p95 %.1f us, p99 %.1f us, max %.1f us", what,
+        r.service.Percentile_Us(0.5), r.service.Percentile_Us(0.95), r.service.Percentile_Us(0.99),
+        r.service.Percentile_Us(1.0));
+} // end Print_Report
+
+
+/**
+ * @brief a load of two queries, 3 to 1
+ */
+LoadSpec Make_Spec()
+{
+    LoadSpec spec;
+    spec.rate = RATE;
+    spec.warmup = 300ms;
+    spec.measure = 1s;
+    spec.drain = 2s;
+    spec.mix = {
+        { "point", "MATCH (n:Person {id: 1}) RETURN n", 3 },
+        { "scan", "UNWIND range(1, 20) AS n RETURN n, 'standin' AS name", 1 },
+    };
+    return spec;
+} // end Make_Spec
+
+
+/**
+ * @brief a steady load; all of it done, at the rate asked
+ */
+void Steady(BoltStandin& standin)
+{
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), CONNECTIONS);
+    LoadGenerator gen(driver);
+    LoadSpec spec = Make_Spec();
+
+    LoadReport r;
+    if (LB_OK(gen.Run(LoadSpec{}, r))) Fatal("steady: ran with no queries");
+    if (!LB_OK(gen.Run(spec, r))) Fatal("steady: run");
+    driver.Close();
+    Print_Report("steady", r);
+
+    const u64 expected = u64(RATE * 1.0);
+    if (r.scheduled < expected - 2 || r.scheduled > expected + 2)
+        Fatal("steady: scheduled %llu, not %llu", (unsigned long long)r.scheduled, (unsigned long long)expected);
+    if (r.completed != r.scheduled || r.failed || r.send_errors || r.timed_out)
+        Fatal("steady: %llu of %llu done", (unsigned long long)r.completed, (unsigned long long)r.scheduled);
+    if (r.records != r.completed * ROWS) Fatal("steady: %llu records", (unsigned long long)r.records);
+    if (r.Achieved_Rate() < RATE * 0.8 || r.Achieved_Rate() > RATE * 1.1)
+        Fatal("steady: achieved %.0f/s of %.0f/s", r.Achieved_Rate(), RATE);
+    if (r.latency.samples != r.completed || r.per_query[0].samples + r.per_query[1].samples != r.completed)
+        Fatal("steady: histograms hold %llu of %llu", (unsigned long long)r.latency.samples,
+            (unsigned long long)r.completed);
+
+    const double share = double(r.per_query[0].samples) / double(r.completed);
+    if (share < 0.68 || share > 0.82) Fatal("steady: point queries %.2f of the mix, not 0.75", share);
+} // end Steady
+
+
+/**
+ * @brief the stand-in stalls with the sender capped; only latency from the
+ *  schedule shows it
+ */
+void Stalled(BoltStandin& standin)
+{
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), CONNECTIONS);
+    LoadGenerator gen(driver);
+    LoadSpec spec = Make_Spec();
+    spec.max_inflight = 4;
+
+    std::thread staller([&] {
+        std::this_thread::sleep_for(spec.warmup + spec.measure / 2);
+        standin.Stall(150ms);
+    });
+
+    LoadReport r;
+    LBStatus rc = gen.Run(spec, r);
+    staller.join();
+    driver.Close();
+    if (!LB_OK(rc)) Fatal("stalled: run");
+    Print_Report("stalled", r);
+
+    // 150 ms at 2000/s holds up some 300 of 2000 queries; 15%, waits of 0 to 150 ms
+    if (r.completed != r.scheduled || r.timed_out) Fatal("stalled: %llu of %llu done",
+        (unsigned long long)r.completed, (unsigned long long)r.scheduled);
+    if (r.latency.Percentile(1.0) < 140ms || r.latency.Percentile(0.95) < 30ms)
+        Fatal("stalled: latency from the schedule missed the stall; p95 %.1f us",
+            r.latency.Percentile_Us(0.95));
+    if (r.service.Percentile(0.95) > 10ms)
+        Fatal("stalled: latency from the sends caught the stall; p95 %.1f us",
+            r.service.Percentile_Us(0.95));
+    if (r.send_lag.Percentile(1.0) < 100ms) Fatal("stalled: the sender wasn't held up");
+} // end Stalled
+
+
+/**
+ * @brief the steady load on a server
+ */
+void Live()
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(), CONNECTIONS);
+    LoadGenerator gen(driver);
+    LoadSpec spec = Make_Spec();
+    spec.rate = 500;
+
+    LoadReport r;
+    if (!LB_OK(gen.Run(spec, r))) Fatal("live: run");
+    driver.Close();
+    Print_Report("live", r);
+    if (r.completed != r.scheduled || r.timed_out) Fatal("live: %llu of %llu done",
+        (unsigned long long)r.completed, (unsigned long long)r.scheduled);
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+
+    BoltStandin standin;
+    StandinSpec sspec;
+    sspec.rows = ROWS;
+    if (!LB_OK(standin.Start(sspec))) Fatal("stand-in: listen");
+    Utils::Print("stand-in on %s", standin.Url().c_str());
+
+    Steady(standin);
+    Stalled(standin);
+    standin.Stop();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,252 @@
+/**
+ * @file memory_accounting_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief memory accounting and limits. A thread's BoltPool must keep its
+ *  high-water marks, grows and bytes moved, and once over its limit trim at
+ *  Release_Pool(); shrinking the arena under values still in use and resetting
+ *  when none are, without reallocating its log at every release. A BoltBuf
+ *  must count the bytes it moves and the most it held, and drop back to its
+ *  smallest size when parked over its slab's limit. Then a driver against the
+ *  local Bolt stand-in, its read buffers grown on large results, must give them
+ *  back on its own once over its limit; all but one a fetched result points
+ *  into, which only Release_Idle_Buffers() parks.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr size_t BIG = 20'000;          // values; well past scratch and the arena
+constexpr size_t KEPT = 3'000;          // values kept across a trim
+constexpr u32 ROWS = 20'000;            // per query; a few hundred KiB of records
+constexpr int QUERIES = 8;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a fresh thread's pool; counted as it grows, trimmed under its limit
+ *  with the values kept intact
+ */
+void Pool()
+{
+    BoltPool<BoltValue>* pool = GetBoltPool<BoltValue>();
+    PoolStats s = pool->Stats();
+    if (s.arena_capacity != ARENA_SIZE || s.grows || s.scratch_high || s.log_high)
+        Fatal("pool: fresh pool at %zu values, %llu grows", s.arena_capacity, (unsigned long long)s.grows);
+
+    const size_t base = pool->Get_Last_Offset();
+    const size_t kept = pool->Alloc(KEPT);         // scratch and some of the arena
+    for (size_t i = 0; i < KEPT; i++)
+        *pool->Get(kept + i) = BoltValue(s64(i));
+
+    const size_t mark = pool->Get_Last_Offset();
+    pool->Alloc(BIG);
+    s = pool->Stats();
+    if (s.scratch_high != SCRATCH_SIZE || s.arena_high != KEPT + BIG - SCRATCH_SIZE || s.log_high != 2)
+        Fatal("pool: high-water marks %zu, %zu, %zu", s.scratch_high, s.arena_high, s.log_high);
+    if (!s.grows || s.bytes_moved < sizeof(BoltValue) * ARENA_SIZE || s.arena_capacity < s.arena_high)
+        Fatal("pool: %llu grows moving %llu bytes", (unsigned long long)s.grows, (unsigned long long)s.bytes_moved);
+    Utils::Print("pool: %zu values took %llu grows, %llu bytes moved, %zu bytes held", KEPT + BIG,
+        (unsigned long long)s.grows, (unsigned long long)s.bytes_moved, s.bytes);
+
+    // no limit; the arena stays as big as it got
+    Release_Pool<BoltValue>(mark);
+    if (pool->Stats().arena_capacity != s.arena_capacity) Fatal("pool: shrank with no limit");
+
+    // over the limit with values still in use; the arena shrinks under them
+    pool->Alloc(BIG);
+    BoltPool<BoltValue>::Set_Limit(sizeof(BoltValue) * (SCRATCH_SIZE + 2 * ARENA_SIZE));
+    Release_Pool<BoltValue>(mark);
+    s = pool->Stats();
+    const size_t kept_in_arena = KEPT - SCRATCH_SIZE;
+    if (!s.shrinks || s.arena_capacity != std::max<size_t>(ARENA_SIZE, kept_in_arena << 1))
+        Fatal("pool: over its limit the arena stayed at %zu values", s.arena_capacity);
+    for (size_t i = 0; i < KEPT; i++)
+        if (pool->Get(kept + i)->int_val != s64(i)) Fatal("pool: value %zu lost in the shrink", i);
+    Utils::Print("pool: trimmed to %zu bytes, %llu values kept", s.bytes, (unsigned long long)KEPT);
+
+    // with nothing in use it resets as well
+    BoltPool<BoltValue>::Set_Limit(1);
+    Release_Pool<BoltValue>(base);
+    s = pool->Stats();
+    if (!s.resets || s.log_length || s.scratch_used || s.arena_used || s.arena_capacity != ARENA_SIZE)
+        Fatal("pool: emptied over its limit but not reset");
+
+    // still over it, queries come and go without the log reallocated each time
+    const auto* log = pool->allocation_log.data();
+    for (int i = 0; i < 100; i++)
+    {
+        pool->Alloc(16);
+        Release_Pool<BoltValue>(base);
+    } // end for
+    BoltPool<BoltValue>::Set_Limit(0);
+    if (pool->allocation_log.data() != log || pool->allocation_log.capacity() > LOG_KEEP)
+        Fatal("pool: log reallocated releasing over the limit");
+} // end Pool
+
+
+/**
+ * @brief a buffer's bytes moved and most held; parked over its slab's limit it
+ *  comes back at the smallest size
+ */
+void Buffers()
+{
+    BoltBuf buf(MIN_CAPACITY);
+    const size_t start = buf.Capacity();
+    buf.Advance(start);
+    if (buf.Grow()) Fatal("buffer: grow");
+    buf.Consume(100);
+    buf.Compact();
+
+    const BufferStats& s = buf.Stats();
+    if (s.capacity_high.Get() != start << 1) Fatal("buffer: high-water %llu", (unsigned long long)s.capacity_high.Get());
+    if (s.bytes_moved.Get() != start + (start - 100))
+        Fatal("buffer: %llu bytes moved", (unsigned long long)s.bytes_moved.Get());
+
+    BufferSlab slab;
+    BoltBuf big(MIN_CAPACITY << 2, &slab);
+    std::vector<u8> bytes(1024, 0x5A);
+    if (!big.Write(bytes.data(), bytes.size())) Fatal("buffer: write refused");
+    big.Consume(bytes.size());
+
+    slab.Set_Limit(1);
+    const size_t was = big.Capacity();
+    if (!big.Park() || big.Capacity() >= was || big.Stats().shrinks.Get() != 1)
+        Fatal("buffer: parked over the limit at %zu, not shrunk", big.Capacity());
+    if (big.Stats().capacity_high.Get() != was) Fatal("buffer: high-water lost parking");
+    if (!big.Unpark() || slab.Stats().in_use_bytes != big.Capacity()) Fatal("buffer: unpark");
+    Utils::Print("buffer: %zu bytes back at %zu parked over the limit", was, big.Capacity());
+} // end Buffers
+
+
+/**
+ * @brief large results grow the read buffers; over the limit the driver parks
+ *  and shrinks them without being asked
+ */
+void Driver(BoltStandin& standin)
+{
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 2);
+
+    std::atomic<int> done{ 0 }, bad{ 0 };
+    for (int i = 0; i < QUERIES; i++)
+    {
+        LBStatus rc = driver.Execute_Async([&](BoltResult& r) {
+            if (r.error || r.message_count != ROWS) bad.fetch_add(1, std::memory_order_relaxed);
+            done.fetch_add(1, std::memory_order_release);
+        }, "UNWIND range(1, 20000) AS n RETURN n, 'standin' AS name");
+        if (!LB_OK(rc)) Fatal("driver: query %d not sent", i);
+    } // end for
+    for (int waited = 0; done.load(std::memory_order_acquire) < QUERIES && waited < 5'000; waited++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (done.load() != QUERIES || bad.load()) Fatal("driver: %d of %d back, %d bad", done.load(), QUERIES, bad.load());
+
+    NeoMetrics m = driver.Metrics();
+    const size_t grown = driver.Buffer_Stats().in_use_bytes;
+    if (m.buffer_high <= BufferSlab::Block_Size(MIN_CAPACITY) || !m.buffer_grows || !m.buffer_bytes_moved)
+        Fatal("driver: buffers never grew; %llu bytes high", (unsigned long long)m.buffer_high);
+    Utils::Print("driver: %zu bytes lent, %llu grows moved %llu bytes, one buffer held %llu", grown,
+        (unsigned long long)m.buffer_grows, (unsigned long long)m.buffer_bytes_moved,
+        (unsigned long long)m.buffer_high);
+
+    // the poll thread notices within its next wake, a second at most
+    driver.Set_Memory_Limit(1);
+    size_t lent = grown;
+    for (int waited = 0; waited < 3'000 && (lent = driver.Buffer_Stats().in_use_bytes) > 0; waited++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    m = driver.Metrics();
+    if (lent) Fatal("driver: %zu bytes still lent over the limit", lent);
+    if (!m.buffer_shrinks) Fatal("driver: parked over the limit without shrinking");
+    Utils::Print("driver: all %zu bytes given back, %llu shrinks, %zu reserved", grown,
+        (unsigned long long)m.buffer_shrinks, driver.Buffer_Stats().reserved_bytes);
+
+    // and per cell, the most each read buffer held
+    std::string text = driver.OpenMetrics();
+    const std::string name = "lightningbolt_cell_read_buffer_high_water_bytes{";
+    int cells = 0;
+    for (size_t at = text.find(name); at != std::string::npos; at = text.find(name, at + 1), cells++)
+        Utils::Print("driver: %s", text.substr(at, text.find('\n', at) - at).c_str());
+    if (!cells) Fatal("driver: no read buffer high-water marks exported");
+
+    driver.Set_Memory_Limit(0);
+    driver.Close();
+} // end Driver
+
+
+/**
+ * @brief a result taken with Fetch() points into its cell's read buffer; over
+ *  the limit the driver must leave that buffer be, and park it only once asked
+ */
+void Fetched(BoltStandin& standin)
+{
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+    NeoCell* pcell = driver.Get_Pool()->Workers()[0].get();
+    if (!LB_OK(pcell->Run("UNWIND range(1, 20000) AS n RETURN n, 'standin' AS name")))
+        Fatal("fetched: %s", driver.Get_Last_Error().c_str());
+
+    BoltResult r;
+    if (!LB_OK(pcell->Fetch(r, std::chrono::seconds(5))) || r.error || r.message_count != ROWS)
+        Fatal("fetched: result never came whole");
+
+    // a couple of trims due; the poll thread wakes every second at the latest
+    driver.Set_Memory_Limit(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1'500));
+    const size_t kept = pcell->Gauges().read_capacity;
+    std::vector<std::string_view> keys;
+    if (!kept) Fatal("fetched: read buffer parked under a fetched result");
+    if (!LB_OK(r.Keys(keys)) || keys.size() != 2 || keys[1] != "name") Fatal("fetched: result spoilt");
+
+    driver.Release_Idle_Buffers();
+    for (int waited = 0; waited < 3'000 && pcell->Gauges().read_capacity; waited++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (pcell->Gauges().read_capacity) Fatal("fetched: read buffer kept once asked to release");
+
+    driver.Set_Memory_Limit(0);
+    driver.Close();
+    Utils::Print("fetched: %zu bytes kept over the limit, parked once asked", kept);
+} // end Fetched
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    std::thread pool_thread(Pool);     // a pool of its own, as fresh as it gets
+    pool_thread.join();
+    Buffers();
+
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("stand-in: listen");
+    Driver(standin);
+    Fetched(standin);
+    standin.Stop();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,231 @@
+/**
+ * @file metrics_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the counters behind NeoDriver::Metrics(). Counters written by a thread
+ *  each, as connections have them, must add up exactly when read while others
+ *  keep writing; a shared fetch_add counter is timed along side. A histogram
+ *  merged while its writer records must read back whole every time. Buffers must
+ *  count their grows, shrinks and compactions, and merged snapshots must sum
+ *  counters and keep the highest high-water marks. Given "live" as the first
+ *  argument it also runs queries over a pool against bolt://localhost:7687 and
+ *  checks the driver wide snapshot against them.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neodriver.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::steady_clock;
+
+constexpr int WRITERS = 4;
+constexpr u64 ADDS = 10'000'000;        // per writer
+constexpr int LIVE_QUERIES = 4'000;
+constexpr u64 RECORDS = 2'000'000;      // into a histogram merged meanwhile
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a writer recording latencies while this thread merges the histogram
+ *  off it, as Collect_Metrics() does; every merge must hold as many samples as
+ *  its counts add up to, and never fewer than the merge before
+ */
+void Histograms()
+{
+    LatencyHistogram live;
+    std::thread writer([&] {
+        for (u64 i = 0; i < RECORDS; i++)
+            live.Record_Latency(std::chrono::nanoseconds(1'000 + (i & 0xFFFF)));
+    });
+
+    u64 merges = 0, last = 0;
+    while (last < RECORDS)
+    {
+        LatencyHistogram snap;
+        snap.Merge(live);
+
+        u64 sum = 0;
+        for (u64 c : snap.latency_hist) sum += c;
+        if (sum != snap.samples || snap.samples > RECORDS || snap.samples < last)
+            Fatal("histograms: merged %llu samples of %llu counts, %llu before", (unsigned long long)snap.samples,
+                (unsigned long long)sum, (unsigned long long)last);
+        if (snap.samples && (snap.Percentile_Ns(0.5) < 1'000 || snap.Percentile_Ns(1.0) > 1'000 + 0xFFFF + 1'000))
+            Fatal("histograms: p50 %llu ns read while recording", (unsigned long long)snap.Percentile_Ns(0.5));
+        last = snap.samples;
+        merges++;
+    } // end while
+    writer.join();
+
+    LatencyHistogram all;
+    all.Merge(live);
+    if (all.samples != RECORDS) Fatal("histograms: %llu of %llu after", (unsigned long long)all.samples,
+        (unsigned long long)RECORDS);
+    Utils::Print("histograms: %llu merges while %llu were recorded", (unsigned long long)merges,
+        (unsigned long long)RECORDS);
+} // end Histograms
+
+
+/**
+ * @brief WRITERS threads adding to their own counters while this one reads
+ *  them, then to one shared counter
+ */
+void Counters()
+{
+    struct alignas(CACHE_LINE_SIZE) Own { MetricCounter c; };
+    Own own[WRITERS];
+    std::atomic<bool> go{ false };
+
+    auto t0 = Clock::now();
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; w++)
+        writers.emplace_back([&, w] {
+            while (!go.load(std::memory_order_acquire));
+            for (u64 i = 0; i < ADDS; i++) own[w].c.Add();
+        });
+    go.store(true, std::memory_order_release);
+
+    u64 reads = 0, last = 0;
+    while (last < WRITERS * ADDS)
+    {
+        u64 sum = 0;
+        for (auto& o : own) sum += o.c.Get();
+        if (sum < last) Fatal("merged count went back: %llu after %llu", (unsigned long long)sum,
+            (unsigned long long)last);
+        last = sum;
+        reads++;
+    } // end while
+    for (auto& t : writers) t.join();
+    double own_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    MetricCounter shared;
+    go.store(false);
+    writers.clear();
+    t0 = Clock::now();
+    for (int w = 0; w < WRITERS; w++)
+        writers.emplace_back([&] { for (u64 i = 0; i < ADDS; i++) shared.Add_Shared(); });
+    for (auto& t : writers) t.join();
+    double shared_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    if (shared.Get() != WRITERS * ADDS) Fatal("shared count %llu", (unsigned long long)shared.Get());
+    Utils::Print("%d writers x %llu adds: own counters %.1f ms (%llu merged reads), shared %.1f ms",
+        WRITERS, (unsigned long long)ADDS, own_ms, (unsigned long long)reads, shared_ms);
+
+    MetricCounter high;
+    for (u64 x : { 3, 9, 4, 9, 1 }) high.Max(x);
+    if (high.Get() != 9) Fatal("high-water mark %llu", (unsigned long long)high.Get());
+} // end Counters
+
+
+/**
+ * @brief a buffer grown, compacted and shrunk counts each
+ */
+void Buffers()
+{
+    BoltBuf buf(MIN_CAPACITY);
+    buf.Advance(buf.Capacity());
+    if (buf.Grow() || buf.Grow()) Fatal("grow");
+
+    buf.Consume(100);
+    if (!buf.Compact() || buf.Compact()) Fatal("compact");     // the second has nothing to do
+
+    buf.Consume(buf.Size() - 10);
+    if (buf.Shrink()) Fatal("shrink");
+
+    const BufferStats& s = buf.Stats();
+    if (s.grows.Get() != 2 || s.compactions.Get() != 1 || s.shrinks.Get() != 1)
+        Fatal("buffer counted %llu grows, %llu compactions, %llu shrinks", (unsigned long long)s.grows.Get(),
+            (unsigned long long)s.compactions.Get(), (unsigned long long)s.shrinks.Get());
+    Utils::Print("buffer: grows, compactions and shrinks counted");
+} // end Buffers
+
+
+/**
+ * @brief snapshots merged sum their counters and max their high-water marks
+ */
+void Merged()
+{
+    NeoMetrics a, b;
+    a.cells = 1; a.queries = 10; a.bytes_in = 500; a.tasks_high = 7; a.results_high = 2;
+    b.cells = 1; b.queries = 5; b.bytes_in = 100; b.tasks_high = 3; b.results_high = 9;
+    a.latency.Record_Latency(std::chrono::microseconds(100));
+    b.latency.Record_Latency(std::chrono::microseconds(300));
+    b.stages.stage[u8(QueryStage::First_Byte)].Record_Latency(std::chrono::microseconds(50));
+
+    a.Merge(b);
+    if (a.cells != 2 || a.queries != 15 || a.bytes_in != 600 || a.tasks_high != 7 || a.results_high != 9 ||
+        a.latency.samples != 2 || a.stages.stage[u8(QueryStage::First_Byte)].samples != 1)
+        Fatal("merged snapshot");
+    Utils::Print("merge: counters summed, high-water marks maxed");
+} // end Merged
+
+
+/**
+ * @brief LIVE_QUERIES async queries spread over a pool; the driver's snapshot
+ *  must count all of them
+ */
+void Live()
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 4);
+    NeoMetrics before = driver.Metrics();
+
+    std::atomic<int> done{ 0 };
+    for (int i = 0; i < LIVE_QUERIES; i++)
+        driver.Execute_Async([&done](BoltResult&) { done.fetch_add(1, std::memory_order_release); },
+            "UNWIND range(1, 100) AS r RETURN r");
+    while (done.load(std::memory_order_acquire) < LIVE_QUERIES)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    NeoMetrics m = driver.Metrics();
+    if (m.cells != u64(driver.Get_Pool_Size()) || m.queries - before.queries != LIVE_QUERIES ||
+        m.latency.samples - before.latency.samples != LIVE_QUERIES || !m.bytes_in || !m.bytes_out)
+        Fatal("live: %llu queries counted of %d", (unsigned long long)(m.queries - before.queries), LIVE_QUERIES);
+
+    Utils::Print("live: %llu cells, %llu queries, %llu failures, %llu retries", (unsigned long long)m.cells,
+        (unsigned long long)m.queries, (unsigned long long)m.failures, (unsigned long long)m.retries);
+    Utils::Print("live: %llu bytes in, %llu out; %llu grows, %llu shrinks, %llu compactions, %llu recv pauses",
+        (unsigned long long)m.bytes_in, (unsigned long long)m.bytes_out, (unsigned long long)m.buffer_grows,
+        (unsigned long long)m.buffer_shrinks, (unsigned long long)m.buffer_compactions,
+        (unsigned long long)m.recv_pauses);
+    Utils::Print("live: high-water tasks %llu, results %llu, requests %llu; p99 %.1f us",
+        (unsigned long long)m.tasks_high, (unsigned long long)m.results_high,
+        (unsigned long long)m.requests_high, m.latency.Percentile_Us(0.99));
+    driver.Close();
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    Counters();
+    Histograms();
+    Buffers();
+    Merged();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,180 @@
+/**
+ * @file multi_chunk_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief RECORD messages larger than a chunk; 1 MiB text properties that go out
+ *  as 17 chunks each. Checks the framing (whole and cut short), that decoding
+ *  them through BoltValues and Fetch_As gives back what went in, then times the
+ *  gathered path against records small enough to be decoded in place.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_result.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr size_t BIG_SIZE = 1024 * 1024;        // text property of the large records
+constexpr size_t SMALL_SIZE = 60 * 1024;        // still fits a chunk
+constexpr int RECORDS = 32;
+constexpr int ROUNDS = 20;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief text that differs per record so a misplaced chunk shows
+ */
+std::string Make_Text(const size_t size, const int seed)
+{
+    std::string s(size, ' ');
+    for (size_t i = 0; i < size; i++)
+        s[i] = 'a' + static_cast<char>((i + seed) % 26);
+    return s;
+} // end Make_Text
+
+
+/**
+ * @brief encodes RECORDS messages [id, text] into buf
+ */
+void Fill_Records(BoltBuf& buf, const std::vector<std::string>& texts)
+{
+    BoltEncoder encoder(buf);
+    for (int i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltMessage rec(BoltValue(BOLT_RECORD, {
+            BoltValue({ i, texts[i].c_str() })
+        }));
+
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+} // end Fill_Records
+
+
+/**
+ * @brief decodes every record in buf ROUNDS times through BoltMessages and
+ *  through Fetch_As, checking both against texts on the first round.
+ *
+ * @return MiB/s for the two paths
+ */
+std::pair<double, double> Decode_Run(BoltBuf& buf, const std::vector<std::string>& texts)
+{
+    BoltDecoder decoder(buf);
+    const size_t bytes = buf.Size();
+
+    BoltResult result;
+    result.pdec = &decoder;
+    result.total_bytes = bytes;
+    result.message_count = RECORDS;
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        u8* cursor = buf.Data();
+        for (int i = 0; i < RECORDS; i++)
+        {
+            size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+            BoltMessage msg;
+            LBStatus rc = decoder.Decode(cursor, msg);
+            if (!LB_OK(rc)) Fatal("decode failed at record %d", i);
+
+            if (r == 0)
+            {
+                BoltValue text = msg.msg(0)(1);
+                if (text.type != BoltType::String || text.str_val.length != texts[i].size() ||
+                    memcmp(text.buf->Data() + text.str_val.offset, texts[i].data(), texts[i].size()))
+                    Fatal("record %d text came back wrong", i);
+            } // end if check
+
+            cursor += LB_Aux(rc);
+            Release_Pool<BoltValue>(offset);
+        } // end for records
+
+        if (cursor != buf.Data() + bytes) Fatal("framing drifted");
+    } // end for rounds
+    auto t1 = Clock::now();
+
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        std::vector<std::tuple<int, std::string>> rows;
+        LBStatus rc = result.Fetch_As(rows);
+        if (!LB_OK(rc) || rows.size() != RECORDS) Fatal("Fetch_As got %zu rows", rows.size());
+
+        if (r == 0)
+            for (int i = 0; i < RECORDS; i++)
+                if (std::get<0>(rows[i]) != i || std::get<1>(rows[i]) != texts[i])
+                    Fatal("Fetch_As row %d came back wrong", i);
+    } // end for rounds
+    auto t2 = Clock::now();
+
+    const double mib = double(bytes) * ROUNDS / (1024.0 * 1024.0);
+    return { mib / std::chrono::duration<double>(t1 - t0).count(),
+        mib / std::chrono::duration<double>(t2 - t1).count() };
+} // end Decode_Run
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    std::vector<std::string> big, small;
+    for (int i = 0; i < RECORDS; i++)
+    {
+        big.push_back(Make_Text(BIG_SIZE, i));
+        small.push_back(Make_Text(SMALL_SIZE, i));
+    } // end for
+
+    BoltBuf big_buf(RECORDS * (BIG_SIZE + 64)), small_buf(RECORDS * (SMALL_SIZE + 64));
+    Fill_Records(big_buf, big);
+    Fill_Records(small_buf, small);
+
+    // the first message: whole, then cut short anywhere
+    BoltFrame frame;
+    LBStatus rc = BoltDecoder::Frame(big_buf.Data(), big_buf.Size(), frame);
+    const size_t chunks = (frame.payload_size + BOLT_MAX_CHUNK_SIZE - 1) / BOLT_MAX_CHUNK_SIZE;
+    if (!LB_OK(rc) || frame.chunks != chunks || frame.wire_size != frame.payload_size + 2 * chunks + 2)
+        Fatal("bad frame: %u chunks, %u payload, %u wire", frame.chunks, frame.payload_size, frame.wire_size);
+
+    for (size_t cut : { size_t(0), size_t(1), size_t(2), size_t(BOLT_MAX_CHUNK_SIZE + 3), size_t(frame.wire_size - 1) })
+    {
+        BoltFrame partial;
+        if (LBAction(LB_Action(BoltDecoder::Frame(big_buf.Data(), cut, partial))) != LBAction::LB_HASMORE)
+            Fatal("message cut at %zu bytes framed as complete", cut);
+    } // end for cuts
+
+    Utils::Print("1 MiB record: %u chunks, %u bytes on the wire", frame.chunks, frame.wire_size);
+
+    auto [small_msg, small_row] = Decode_Run(small_buf, small);
+    auto [big_msg, big_row] = Decode_Run(big_buf, big);
+
+    Utils::Print("%d records x %d rounds, MiB/s", RECORDS, ROUNDS);
+    Utils::Print("  60 KiB, in place: Decode %8.1f   Fetch_As %8.1f", small_msg, small_row);
+    Utils::Print("  1 MiB, gathered:  Decode %8.1f   Fetch_As %8.1f", big_msg, big_row);
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
@@ -0,0 +1,139 @@
+/**
+ * @file numa_decode_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief decode throughput of a batch of RECORD messages held in buffers obtained
+ *  under the different page policies (heap, first-touch mmap, huge pages). Meant
+ *  to be run pinned with numactl to compare local vs remote memory, i.e.
+ *
+ *      numactl --cpunodebind=0 --membind=0 ./bin/numa_decode_test
+ *      numactl --cpunodebind=0 --membind=1 ./bin/numa_decode_test
+ *      numactl --cpunodebind=0 ./bin/numa_decode_test 1     # bind blocks to node 1
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_decoder.h"
+#include "bolt/boltvalue_pool.h"
+
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr size_t RECORDS = 100'000;         // records per batch
+constexpr size_t ROUNDS = 20;               // decode passes over the batch
+constexpr size_t BATCH_SIZE = 32 * 1024 * 1024;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief fills buf with RECORD messages shaped like a typical row; an id, a name,
+ *  a score, a flag and a small map.
+ */
+size_t Fill_Records(BoltBuf& buf)
+{
+    BoltEncoder encoder(buf);
+    for (size_t i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltMessage rec(BoltValue(BOLT_RECORD, {
+            BoltValue({
+                static_cast<int>(i),
+                "Lightning Bolt Person",
+                i * 0.5,
+                (i & 1) == 0,
+                BoltValue({ mp("age", static_cast<int>(i % 90)), mp("city", "Addis Ababa") })
+            })
+        }));
+
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for records
+
+    return buf.Size();
+} // end Fill_Records
+
+
+/**
+ * @brief decodes every message in buf ROUNDS times and prints the throughput
+ */
+void Decode_Run(const char* name, const MemPolicy& policy)
+{
+    BufferSlab slab(SLAB_DEFAULT_CAP, policy);
+    BoltBuf buf(BATCH_SIZE, &slab);
+
+    // first touch happens here, on the thread (and node) doing the decode
+    size_t bytes = Fill_Records(buf);
+    BoltDecoder decoder(buf);
+
+    size_t decoded = 0;
+    auto start = Clock::now();
+    for (size_t r = 0; r < ROUNDS; r++)
+    {
+        u8* cursor = buf.Data();
+        u8* end = cursor + bytes;
+        while (cursor < end)
+        {
+            size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+            BoltMessage msg;
+            LBStatus rc = decoder.Decode(cursor, msg);
+            if (!LB_OK(rc)) Fatal("decode failed at %zu", size_t(cursor - buf.Data()));
+
+            cursor += LB_Aux(rc);
+            decoded++;
+            Release_Pool<BoltValue>(offset);
+        } // end while
+    } // end for rounds
+    auto end = Clock::now();
+
+    double secs = std::chrono::duration<double>(end - start).count();
+    std::cout << std::left << std::setw(14) << name
+        << std::right << std::setw(14) << std::fixed << std::setprecision(1)
+        << (bytes * ROUNDS) / secs / (1024.0 * 1024.0)
+        << std::setw(18) << decoded / secs
+        << std::setw(10) << policy.node << "\n";
+} // end Decode_Run
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+
+    int node = argc > 1 ? atoi(argv[1]) : -1;
+    std::cout << "Decode throughput, " << RECORDS << " records x " << ROUNDS
+        << " rounds, running on node " << PageAlloc::Current_Node() << "\n";
+    std::cout << "------------------------------------------------------------\n";
+    std::cout << std::left << std::setw(14) << "Policy"
+        << std::right << std::setw(14) << "MiB/s"
+        << std::setw(18) << "records/s"
+        << std::setw(10) << "node" << "\n";
+    std::cout << "------------------------------------------------------------\n";
+
+    Decode_Run("heap", { PagePolicy::Heap, -1 });
+    Decode_Run("first-touch", { PagePolicy::First_Touch, node });
+    Decode_Run("huge", { PagePolicy::Huge, node });
+
+    return 0;
+} // end main
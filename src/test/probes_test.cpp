@@ -0,0 +1,149 @@
+/**
+ * @file probes_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief USDT probes. Built without them (the default) a probe must leave its
+ *  arguments unevaluated; built with -DLB_USDT=ON, libdriver's .note.stapsdt
+ *  section must name every probe under the lightningbolt provider, as a tracer
+ *  reads them. Either way queries run against the local Bolt stand-in through
+ *  every probe site, inline and on an executor, and must come back whole.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <dlfcn.h>
+#include <elf.h>
+#include <fstream>
+#include <set>
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/probes.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr u32 ROWS = 64;
+constexpr int QUERIES = 200;
+
+const char* PROBES[] = { "query_submit", "flush_start", "flush_end", "recv", "frame",
+    "run_success", "record_success", "buf_grow", "buf_compact", "callback" };
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief the probe names under provider in the .note.stapsdt section of the
+ *  ELF file at path
+ */
+std::set<std::string> Read_Probes(const std::string& path, const char* provider)
+{
+    std::set<std::string> names;
+    std::ifstream in(path, std::ios::binary);
+    std::string elf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (elf.size() < sizeof(Elf64_Ehdr)) return names;
+
+    auto eh = (const Elf64_Ehdr*)elf.data();
+    auto sh = (const Elf64_Shdr*)(elf.data() + eh->e_shoff);
+    const char* strtab = elf.data() + sh[eh->e_shstrndx].sh_offset;
+
+    for (int i = 0; i < eh->e_shnum; i++)
+    {
+        if (strcmp(strtab + sh[i].sh_name, ".note.stapsdt")) continue;
+
+        // notes; header, "stapsdt" and a desc of pc, base, semaphore then
+        //  provider, name and args as C strings
+        const char* p = elf.data() + sh[i].sh_offset;
+        const char* end = p + sh[i].sh_size;
+        while (p + sizeof(Elf64_Nhdr) <= end)
+        {
+            auto nh = (const Elf64_Nhdr*)p;
+            const char* desc = p + sizeof(Elf64_Nhdr) + ((nh->n_namesz + 3) & ~3u);
+            const char* prov = desc + 3 * sizeof(u64);
+            if (!strcmp(prov, provider))
+                names.insert(prov + strlen(prov) + 1);
+            p = desc + ((nh->n_descsz + 3) & ~3u);
+        } // end while notes
+    } // end for sections
+
+    return names;
+} // end Read_Probes
+
+
+/**
+ * @brief queries against the stand-in, every one checked for its records
+ */
+void Run_Queries(const std::string& url, const ExecPolicy policy)
+{
+    NeoDriver driver(url, Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 2);
+    driver.Set_Executor(policy);
+
+    std::atomic<int> done{ 0 }, bad{ 0 };
+    for (int i = 0; i < QUERIES; i++)
+    {
+        LBStatus rc = driver.Execute_Async([&](BoltResult& r) {
+            if (r.error || r.message_count != ROWS) bad.fetch_add(1, std::memory_order_relaxed);
+            done.fetch_add(1, std::memory_order_release);
+        }, "UNWIND range(1, 64) AS n RETURN n, 'standin' AS name");
+        if (!LB_OK(rc)) Fatal("query %d not sent", i);
+    } // end for
+
+    for (int waited = 0; done.load(std::memory_order_acquire) < QUERIES && waited < 5'000; waited++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    driver.Close();
+
+    if (done.load() != QUERIES || bad.load())
+        Fatal("%d of %d queries back, %d bad", done.load(), QUERIES, bad.load());
+} // end Run_Queries
+
+
+int main()
+{
+    Utils::Print_Title();
+
+#if LB_PROBES_ON
+    Dl_info info;
+    if (!dladdr((void*)&LB_Handle_Status, &info) || !info.dli_fname) Fatal("libdriver not found");
+
+    std::set<std::string> names = Read_Probes(info.dli_fname, "lightningbolt");
+    for (const char* p : PROBES)
+        if (!names.count(p)) Fatal("probe %s missing from %s", p, info.dli_fname);
+    Utils::Print("%zu probes in %s", names.size(), info.dli_fname);
+#else
+    int evaluated = 0;
+    LB_PROBE1(probes_test, ++evaluated);
+    LB_PROBE3(probes_test, ++evaluated, ++evaluated, ++evaluated);
+    if (evaluated) Fatal("a compiled out probe evaluated its arguments");
+    Utils::Print("probes compiled out; configure with -DLB_USDT=ON for them");
+#endif
+
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("stand-in: listen");
+
+    Run_Queries(standin.Url(), ExecPolicy{});
+    Run_Queries(standin.Url(), ExecPolicy{ ExecMode::Pool, 2 });
+    Utils::Print("%llu queries through every probe site", (unsigned long long)standin.Queries());
+    standin.Stop();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
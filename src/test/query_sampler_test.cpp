@@ -0,0 +1,220 @@
+/**
+ * @file query_sampler_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the slow query sampler. On its own a QuerySampler must keep nothing
+ *  while off, refuse slots once SAMPLE_SLOTS are in flight, and drop and count
+ *  samples past a full ring. Then a driver against the local Bolt stand-in must
+ *  sample the queries a stall holds past the threshold, and one in n of the
+ *  rest, each with its text, parameter count, request and record sizes, the
+ *  server's t_first and t_last and its stage stamps in order.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neodriver.h"
+#include "connection/bolt_standin.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr u32 ROWS = 32;
+constexpr int STALLED = 6;              // queries held back by the stall
+constexpr int QUERIES = 200;            // one in n of them sampled
+constexpr u32 ONE_IN = 10;
+constexpr auto THRESHOLD = std::chrono::milliseconds(40);
+constexpr auto STALL = std::chrono::milliseconds(150);
+
+const char* SLOW_QUERY = "UNWIND range(1, 32) AS n RETURN n, 'slow' AS name";
+const char* TYPED_QUERY = "UNWIND range(1, $n) AS n RETURN n, $score AS score";
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a sampler on its own; off, its slots and its full ring
+ */
+void Sampler()
+{
+    QuerySampler sampler;
+    const char* q = "RETURN 1";
+    if (sampler.Note(q, strlen(q), 0, 0)) Fatal("sampler: noted while off");
+
+    sampler.Set_Policy(SamplePolicy{ std::chrono::nanoseconds(0), 1 });
+    if (sampler.Note(q, strlen(q), 0, SAMPLE_SLOTS)) Fatal("sampler: a slot past SAMPLE_SLOTS in flight");
+
+    // every one sampled; the ring holds one less than its size, the rest dropped
+    BoltResult result;
+    result.message_count = 1;
+    const size_t n = SAMPLE_RING_SIZE + 10;
+    for (size_t i = 0; i < n; i++)
+    {
+        StageStamps stamps(1'000);
+        stamps.Stamp(QueryStage::Final_Success, 1'000 + s64(i));
+        std::string text = "RETURN " + std::to_string(i);
+        u32 slot = sampler.Note(text.c_str(), text.size(), 1, 0);
+        if (!slot) Fatal("sampler: no slot for query %zu", i);
+        sampler.Offer(slot, 7, result, stamps);
+    } // end for
+
+    const size_t kept = SAMPLE_RING_SIZE - 1;
+    if (sampler.Sampled() != kept || sampler.Dropped() != n - kept)
+        Fatal("sampler: %llu sampled, %llu dropped", (unsigned long long)sampler.Sampled(),
+            (unsigned long long)sampler.Dropped());
+
+    std::vector<QuerySample> samples;
+    if (sampler.Take(samples) != kept) Fatal("sampler: took %zu", samples.size());
+    for (size_t i = 0; i < kept; i++)
+        if (samples[i].cypher != "RETURN " + std::to_string(i) || samples[i].Latency_Ns() != s64(i) ||
+            samples[i].client_id != 7 || samples[i].slow)
+            Fatal("sampler: sample %zu is %s", i, samples[i].cypher.c_str());
+    Utils::Print("sampler: %zu kept in order, %llu dropped on a full ring", kept,
+        (unsigned long long)sampler.Dropped());
+
+    sampler.Set_Policy(SamplePolicy{});
+    if (sampler.Note(q, strlen(q), 0, 0)) Fatal("sampler: noted once turned off");
+} // end Sampler
+
+
+/**
+ * @brief checks a sample against what the stand-in answers
+ */
+void Check(const QuerySample& s, const char* cypher, const u32 params)
+{
+    if (s.cypher != cypher || s.param_count != params)
+        Fatal("sample: '%s' with %u parameters", s.cypher.c_str(), s.param_count);
+    if (s.request_bytes <= s.cypher.size() || s.records != ROWS || !s.record_bytes)
+        Fatal("sample: %u bytes sent, %llu records of %llu bytes", s.request_bytes,
+            (unsigned long long)s.records, (unsigned long long)s.record_bytes);
+    if (s.t_first != 0 || s.t_last != 0)
+        Fatal("sample: t_first %lld, t_last %lld", (long long)s.t_first, (long long)s.t_last);
+
+    s64 prev = 0;
+    for (u8 i = 0; i <= u8(QueryStage::Final_Success); i++)
+    {
+        if (i == u8(QueryStage::Flushed) && !s.at[i]) continue;     // may be beaten to it
+        if (!s.at[i] || s.at[i] < prev) Fatal("sample: stage %u out of order", i);
+        prev = s.at[i];
+    } // end for
+} // end Check
+
+
+/**
+ * @brief waits for done to reach n
+ */
+void Wait(std::atomic<int>& done, const int n, const char* what)
+{
+    for (int waited = 0; done.load(std::memory_order_acquire) < n && waited < 5'000; waited++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (done.load() != n) Fatal("%s: %d of %d back", what, done.load(), n);
+} // end Wait
+
+
+/**
+ * @brief the stalled queries sampled as slow, then one in n of the rest
+ */
+void Driver(BoltStandin& standin)
+{
+    NeoDriver driver(standin.Url(), Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 2);
+    driver.Set_Sampler(SamplePolicy{ THRESHOLD, 0 });
+
+    std::atomic<int> done{ 0 }, bad{ 0 };
+    auto cb = [&](BoltResult& r) {
+        if (r.error || r.message_count != ROWS) bad.fetch_add(1, std::memory_order_relaxed);
+        done.fetch_add(1, std::memory_order_release);
+    };
+
+    // connected first, lest the stall hold back the handshake instead
+    for (int i = 0; i < STALLED; i++)
+        if (!LB_OK(driver.Execute_Async(cb, SLOW_QUERY))) Fatal("driver: query %d not sent", i);
+    Wait(done, STALLED, "warm up");
+
+    std::vector<QuerySample> samples;
+    driver.Take_Samples(samples);
+    samples.clear();
+    const u64 warm = driver.Metrics().samples;
+
+    done.store(0);
+    standin.Stall(STALL);
+    for (int i = 0; i < STALLED; i++)
+        if (!LB_OK(driver.Execute_Async(cb, SLOW_QUERY))) Fatal("driver: query %d not sent", i);
+    Wait(done, STALLED, "stalled");
+    driver.Take_Samples(samples);
+    if (samples.size() != STALLED) Fatal("driver: %zu of %d stalled queries sampled", samples.size(), STALLED);
+    for (const QuerySample& s : samples)
+    {
+        Check(s, SLOW_QUERY, 0);
+        if (!s.slow || s.Latency_Ns() <= std::chrono::nanoseconds(THRESHOLD).count())
+            Fatal("driver: sampled in %lld ns, not slow", (long long)s.Latency_Ns());
+    } // end for
+    Utils::Print("driver: %zu stalled, the last in %.1f ms, %u bytes sent, %.1f ms of it waiting on the server",
+        samples.size(), samples.back().Latency_Ns() / 1e6, samples.back().request_bytes,
+        samples.back().Stage_Ns(QueryStage::First_Byte) / 1e6);
+
+    // no threshold, one in n; sent from here, so no other thread notes them
+    driver.Set_Sampler(SamplePolicy{ std::chrono::nanoseconds(0), ONE_IN });
+    done.store(0);
+    for (int i = 0; i < QUERIES; i++)
+        if (!LB_OK(driver.Execute_Async(cb, TYPED_QUERY, P("n", s64(ROWS)), P("score", 99.5))))
+            Fatal("driver: query %d not sent", i);
+    Wait(done, QUERIES, "one in n");
+    if (bad.load()) Fatal("driver: %d bad results", bad.load());
+
+    samples.clear();
+    driver.Take_Samples(samples);
+    NeoMetrics m = driver.Metrics();
+
+    // each cell counts towards its own one in n
+    if (samples.size() < QUERIES / ONE_IN - 2 || samples.size() > QUERIES / ONE_IN)
+        Fatal("driver: %zu of %d sampled one in %u", samples.size(), QUERIES, ONE_IN);
+    for (const QuerySample& s : samples)
+    {
+        Check(s, TYPED_QUERY, 2);
+        if (s.slow) Fatal("driver: one in n sampled as slow");
+    } // end for
+    if (m.samples != warm + STALLED + samples.size() || m.samples_dropped)
+        Fatal("driver: metrics have %llu sampled", (unsigned long long)m.samples);
+    if (driver.OpenMetrics().find("lightningbolt_query_samples_total ") == std::string::npos)
+        Fatal("driver: samples not exported");
+    Utils::Print("driver: %zu of %d sampled one in %u, %u parameters", samples.size(), QUERIES,
+        ONE_IN, samples.front().param_count);
+
+    driver.Set_Sampler(SamplePolicy{});
+    driver.Close();
+} // end Driver
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    Sampler();
+
+    BoltStandin standin;
+    StandinSpec spec;
+    spec.rows = ROWS;
+    if (!LB_OK(standin.Start(spec))) Fatal("stand-in: listen");
+    Driver(standin);
+    standin.Stop();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,142 @@
+/**
+ * @file slab_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the buffer slab. Sizes must round up to their power of two class, and
+ *  those past the largest to whole huge pages. A returned block must be lent out
+ *  again before a fresh one is reserved; past the cap idle blocks must be given
+ *  back to make room and a borrow that still won't fit refused and counted. A
+ *  slab backed BoltBuf must start parked, borrow on its first write, refuse to
+ *  park while holding data, hand its block back once empty and reuse it on
+ *  unparking; and a write it can't get storage for must be refused, not made.
+ *
+ * @version 1.0
+ * @date 17th of October 2026, Saturday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "bolt/bolt_buf.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief the size classes
+ */
+void Classes()
+{
+    const size_t largest = SLAB_MIN_BLOCK << (SLAB_CLASSES - 1);
+    const struct { size_t n, want; } sizes[] = {
+        { 1, SLAB_MIN_BLOCK }, { SLAB_MIN_BLOCK, SLAB_MIN_BLOCK },
+        { SLAB_MIN_BLOCK + 1, SLAB_MIN_BLOCK << 1 }, { 100'000, 131'072 },
+        { largest, largest }, { largest + 1, largest + HUGE_PAGE_SIZE },
+    };
+
+    for (const auto& s : sizes)
+        if (BufferSlab::Block_Size(s.n) != s.want)
+            Fatal("classes: %zu bytes in a block of %zu", s.n, BufferSlab::Block_Size(s.n));
+    Utils::Print("classes: %zu sizes rounded as expected", std::size(sizes));
+} // end Classes
+
+
+/**
+ * @brief blocks reused, idle ones trimmed to make room and borrows past the cap
+ *  refused
+ */
+void Cap()
+{
+    BufferSlab slab(SLAB_MIN_BLOCK * 3);
+    PageBlock a = slab.Borrow(SLAB_MIN_BLOCK);
+    PageBlock b = slab.Borrow(SLAB_MIN_BLOCK);
+    if (!a.ptr || !b.ptr) Fatal("cap: borrow under the cap refused");
+    if (a.asked != SLAB_MIN_BLOCK || a.size < a.asked) Fatal("cap: %zu bytes mapped for %zu", a.size, a.asked);
+
+    // handed back and lent out again, not reserved anew
+    slab.Return(b);
+    PageBlock again = slab.Borrow(SLAB_MIN_BLOCK);
+    SlabStats s = slab.Stats();
+    if (again.ptr != b.ptr || s.reuses != 1 || s.reserved_bytes != SLAB_MIN_BLOCK * 2)
+        Fatal("cap: block not reused, %llu reuses", (unsigned long long)s.reuses);
+
+    // the idle block is given back to fit a bigger one under the cap
+    slab.Return(again);
+    PageBlock big = slab.Borrow(SLAB_MIN_BLOCK << 1);
+    s = slab.Stats();
+    if (!big.ptr || s.idle_bytes || s.reserved_bytes != SLAB_MIN_BLOCK * 3 || s.cap_rejects)
+        Fatal("cap: %zu bytes reserved, %zu idle", s.reserved_bytes, s.idle_bytes);
+
+    // nothing idle left to give back; refused
+    PageBlock over = slab.Borrow(SLAB_MIN_BLOCK);
+    s = slab.Stats();
+    if (over.ptr || s.cap_rejects != 1 || s.reserved_bytes > s.cap_bytes)
+        Fatal("cap: borrow past the cap let through");
+
+    slab.Return(a);
+    slab.Return(big);
+    s = slab.Stats();
+    if (s.in_use_bytes || s.idle_bytes != s.reserved_bytes || s.high_water_bytes != SLAB_MIN_BLOCK * 3)
+        Fatal("cap: %zu bytes still in use", s.in_use_bytes);
+    Utils::Print("cap: %llu borrows, %llu reused, %llu refused, %zu bytes at most",
+        (unsigned long long)s.borrows, (unsigned long long)s.reuses,
+        (unsigned long long)s.cap_rejects, s.high_water_bytes);
+} // end Cap
+
+
+/**
+ * @brief a slab backed buffer parked and unparked, then refused its storage
+ */
+void Park()
+{
+    BufferSlab slab(SLAB_MIN_BLOCK);
+    BoltBuf buf(SLAB_MIN_BLOCK, &slab);
+    if (!buf.Is_Parked() || slab.Stats().reserved_bytes) Fatal("park: slab backed buffer not born parked");
+
+    const u8 bytes[64] = { 0x5A };
+    if (!buf.Write(bytes, sizeof(bytes)) || buf.Is_Parked() || slab.Stats().in_use_bytes != SLAB_MIN_BLOCK)
+        Fatal("park: first write didn't borrow");
+    if (buf.Park()) Fatal("park: parked holding %zu bytes", buf.Size());
+
+    buf.Consume(sizeof(bytes));
+    if (!buf.Park() || !buf.Is_Parked() || slab.Stats().in_use_bytes)
+        Fatal("park: empty buffer kept its block");
+
+    if (!buf.Unpark() || slab.Stats().reuses != 1) Fatal("park: unpark didn't reuse the block");
+    buf.Park();
+
+    // the only block lent elsewhere; the buffer can't have it
+    PageBlock taken = slab.Borrow(SLAB_MIN_BLOCK);
+    if (!taken.ptr) Fatal("park: idle block not lent out");
+    if (buf.Unpark() || buf.Write(bytes, sizeof(bytes)) || buf.Size() || !buf.Is_Parked())
+        Fatal("park: write made without storage");
+
+    slab.Return(taken);
+    if (!buf.Write(bytes, sizeof(bytes))) Fatal("park: write refused with the block back");
+    Utils::Print("park: parked, unparked and refused under the cap, %llu rejects",
+        (unsigned long long)slab.Stats().cap_rejects);
+} // end Park
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    Classes();
+    Cap();
+    Park();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
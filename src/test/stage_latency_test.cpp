@@ -0,0 +1,197 @@
+/**
+ * @file stage_latency_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief the per stage breakdown of query latency. Offline, made up stamps must
+ *  land in their stages' histograms with the stage intervals adding up to the
+ *  total, stages not stamped skipped, and stamps must survive the task moving
+ *  through a queue and be reachable by the producer via Back(). Callbacks run
+ *  by a pool must record their wait and run time to the connection they came
+ *  from. Given "live" as the first argument it also runs queries against
+ *  bolt://localhost:7687, inline and with a pool, and prints the breakdown.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neodriver.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr int TASKS = 10'000;
+constexpr int CALLBACKS = 1'000;
+constexpr int LIVE_QUERIES = 2'000;
+
+// made up stage offsets from submit, in ns; encode, flush, first byte, ...
+constexpr s64 OFFSETS[] = { 0, 2'000, 9'000, 150'000, 180'000, 185'000, 400'000 };
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief prints p50/p99/p99.9 of every stage
+ */
+void Print_Stages(const char* title, const StageLatencies& s)
+{
+    Utils::Print("%s", title);
+    Utils::Print("  %-14s %10s %10s %10s %10s", "stage", "samples", "p50 us", "p99 us", "p99.9 us");
+    for (int i = 0; i < QUERY_STAGE_COUNT; i++)
+    {
+        const StageHistogram& h = s.stage[i];
+        Utils::Print("  %-14s %10llu %10.1f %10.1f %10.1f", StageLatencies::Name(QueryStage(i)),
+            (unsigned long long)h.samples, h.Percentile_Us(0.5), h.Percentile_Us(0.99),
+            h.Percentile_Us(0.999));
+    } // end for
+} // end Print_Stages
+
+
+/**
+ * @brief TASKS made up tasks through a queue the way a connection has them
+ */
+void Offline_Stages()
+{
+    LockFreeQueue<DecoderTask> tasks;
+    StageLatencies stages;
+
+    for (int i = 0; i < TASKS; i++)
+    {
+        if (!tasks.Enqueue(DecoderTask(TaskState::Run))) Fatal("enqueue");
+        s64 submit = tasks.Back()->get().stamps[QueryStage::Submit];
+        if (!submit) Fatal("task not stamped at submit");
+
+        // the producer fills in encode and flush, every other one misses its flush
+        auto back = tasks.Back();
+        back->get().stamps.Stamp(QueryStage::Encoded, submit + OFFSETS[1]);
+        if (i & 1) back->get().stamps.Stamp(QueryStage::Flushed, submit + OFFSETS[2]);
+
+        DecoderTask task = std::move(tasks.Dequeue().value());
+        for (int s = 3; s < 7; s++)
+            task.stamps.Stamp(QueryStage(s), submit + OFFSETS[s]);
+        stages.Record(task.stamps);
+    } // end for
+    if (tasks.Back().has_value()) Fatal("Back() of an empty queue");
+
+    auto at = [&](QueryStage s) -> const StageHistogram& { return stages.stage[u8(s)]; };
+    auto near = [](const StageHistogram& h, s64 ns) {      // within the stages' precision
+        return std::abs(double(h.Percentile_Ns(0.5)) - double(ns)) <= double(ns) / StageHistogram::HALF_COUNT;
+    };
+
+    if (at(QueryStage::Submit).samples != TASKS || !near(at(QueryStage::Submit), OFFSETS[6]))
+        Fatal("total: %llu samples", (unsigned long long)at(QueryStage::Submit).samples);
+    if (at(QueryStage::Flushed).samples != TASKS / 2 || at(QueryStage::First_Byte).samples != TASKS)
+        Fatal("missing flush not skipped");
+    if (!near(at(QueryStage::Run_Success), OFFSETS[4] - OFFSETS[3]) ||
+        !near(at(QueryStage::Final_Success), OFFSETS[6] - OFFSETS[5]))
+        Fatal("stage intervals");
+
+    // the intervals add up to the total
+    double sum = 0;
+    for (int s = 1; s < 7; s++)
+        sum += at(QueryStage(s)).Avg_Latency().count() * double(at(QueryStage(s)).samples);
+    if (std::abs(sum - at(QueryStage::Submit).total_latency.count()) > 0.01 * sum)
+        Fatal("stages add up to %.0f of %lld ns", sum, (long long)at(QueryStage::Submit).total_latency.count());
+
+    StageLatencies merged = stages;
+    merged.Merge(stages);
+    if (merged.stage[0].samples != 2 * TASKS) Fatal("merge");
+    Print_Stages("offline stages:", stages);
+
+    // what every connection carries for them, callbacks and all
+    const size_t held = sizeof(StageLatencies) + sizeof(CallbackStages);
+    if (held > 64 * 1024) Fatal("stage histograms take %zu bytes a connection", held);
+    Utils::Print("stage histograms: %zu bytes a connection", held);
+} // end Offline_Stages
+
+
+/**
+ * @brief CALLBACKS callbacks through a pool, recorded to their connection's
+ */
+void Offline_Callbacks()
+{
+    CompletionExecutor exec;
+    exec.Set_Policy({ ExecMode::Pool, 2 });
+
+    CallbackStages stages;
+    std::atomic<int> ran{ 0 };
+    for (int b = 0; b < CALLBACKS / 10; b++)
+    {
+        CompletionBatch batch;
+        for (int i = 0; i < 10; i++)
+        {
+            batch.push_back({ [&ran](BoltResult&) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    ran.fetch_add(1, std::memory_order_relaxed);
+                }, BoltResult(), LatencyHistogram::clock::now(), StageStamps::Now(), &stages });
+        } // end for
+        exec.Submit(std::move(batch));
+    } // end for
+    exec.Stop();
+
+    std::lock_guard<std::mutex> guard(stages.lock);
+    if (ran.load() != CALLBACKS || stages.run.samples != CALLBACKS || stages.wait.samples != CALLBACKS)
+        Fatal("callback stages: %llu of %d", (unsigned long long)stages.run.samples, CALLBACKS);
+    if (stages.run.Percentile_Us(0.5) < 50.0) Fatal("callback run shorter than it slept");
+    Utils::Print("callbacks: wait p50 %.1f us, run p50 %.1f us", stages.wait.Percentile_Us(0.5),
+        stages.run.Percentile_Us(0.5));
+} // end Offline_Callbacks
+
+
+/**
+ * @brief LIVE_QUERIES async queries on one cell, inline and then with a pool
+ */
+void Live()
+{
+    for (ExecMode mode : { ExecMode::Inline, ExecMode::Pool })
+    {
+        NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""));
+        if (mode == ExecMode::Pool) driver.Set_Executor({ ExecMode::Pool, 2 });
+        NeoCell* pcell = driver.Get_Session();
+        if (!pcell) Fatal("%s", driver.Get_Last_Error().c_str());
+        pcell->Clear_Histo();
+
+        std::atomic<int> done{ 0 };
+        for (int i = 0; i < LIVE_QUERIES; i++)
+            pcell->Run_Async([&done](BoltResult&) { done.fetch_add(1, std::memory_order_release); },
+                "UNWIND range(1, 10) AS r RETURN r");
+        while (done.load(std::memory_order_acquire) < LIVE_QUERIES)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        StageLatencies s = pcell->Stage_Latencies();
+        if (s.stage[0].samples != LIVE_QUERIES || s.stage[u8(QueryStage::First_Record)].samples != LIVE_QUERIES)
+            Fatal("live: %llu of %d queries recorded", (unsigned long long)s.stage[0].samples, LIVE_QUERIES);
+        Print_Stages(mode == ExecMode::Pool ? "live, pool:" : "live, inline:", s);
+        driver.Close();
+    } // end for
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    Offline_Stages();
+    Offline_Callbacks();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
@@ -0,0 +1,261 @@
+/**
+ * @file stream_decode_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief feeds RECORD messages, one of them holding a 4 MiB string, through the
+ *  resumable BoltStreamDecoder the way recv would; whole, a byte at a time and
+ *  cut at random, out of a fixed 8K receive buffer that is rewound rather than
+ *  grown. Every way must give the visitor the same events as the records that
+ *  went in and stop right in front of the trailing summary.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <random>
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_stream_decoder.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int RECORDS = 64;
+constexpr int BIG_ROW = 17;                     // this one carries the big string
+constexpr size_t BIG_SIZE = 4 * 1024 * 1024;
+constexpr size_t RECV_BUF = 8192;               // what the stream gets to work with
+
+
+
+
+//===============================================================================|
+//          CLASS
+//===============================================================================|
+/**
+ * @brief writes the events down as text; strings as length and hash so the big
+ *  one can be compared without keeping it.
+ */
+class Transcript : public BoltVisitor
+{
+public:
+
+    std::string text;
+
+    void On_Record_Begin() override { text += "<"; }
+    void On_Record_End() override { text += ">\n"; }
+    void On_Null() override { text += "n "; }
+    void On_Bool(bool b) override { text += b ? "T " : "F "; }
+    void On_Int(s64 v) override { text += "i" + std::to_string(v) + " "; }
+    void On_Float(double d) override { text += "f" + std::to_string(d) + " "; }
+    void On_String(std::string_view part, bool last) override
+    {
+        for (char c : part) hash = (hash ^ u8(c)) * 1099511628211ull;
+        len += part.size();
+        if (last)
+        {
+            text += "s" + std::to_string(len) + ":" + std::to_string(hash) + " ";
+            len = 0;
+            hash = 14695981039346656037ull;
+        } // end if whole
+    } // end On_String
+
+    void On_List_Begin(u32 n) override { text += "[" + std::to_string(n) + " "; }
+    void On_List_End() override { text += "] "; }
+    void On_Map_Begin(u32 n) override { text += "{" + std::to_string(n) + " "; }
+    void On_Map_End() override { text += "} "; }
+    void On_Struct_Begin(u8 tag, u32 n) override
+    {
+        text += "(" + std::to_string(tag) + "/" + std::to_string(n) + " ";
+    } // end On_Struct_Begin
+    void On_Struct_End() override { text += ") "; }
+
+private:
+
+    size_t len = 0;
+    u64 hash = 14695981039346656037ull;
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief what Transcript writes for string s
+ */
+std::string Expect_String(const std::string& s)
+{
+    Transcript t;
+    t.On_String(s, true);
+    return t.text;
+} // end Expect_String
+
+
+/**
+ * @brief encodes the records [id, name, text, ints, map, null, node] then a
+ *  SUCCESS summary into buf, writing down the events they should give.
+ *
+ * @return the wire size of the records alone
+ */
+size_t Fill_Records(BoltBuf& buf, std::string& expect)
+{
+    BoltEncoder encoder(buf);
+    const std::string big(BIG_SIZE, 'x');
+    const s64 ints[] = { 5, -5, -100, 1000, 100000, s64(1) << 40 };
+
+    for (int i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        const std::string name = "person " + std::to_string(i);
+        const std::string& text = i == BIG_ROW ? big : name;
+
+        // Insert_*() put things at the front; last first
+        BoltValue map = BoltValue::Make_Map();
+        map.Insert_Map("active", BoltValue::Make_Bool(i & 1));
+        map.Insert_Map("score", BoltValue::Make_Float(i * 0.25));
+
+        BoltValue node = BoltValue::Make_Struct(0x4E);
+        node.Insert_Struct(BoltValue({ "Person" }));
+        node.Insert_Struct(BoltValue::Make_Int(i));
+
+        BoltMessage rec(BoltValue(BOLT_RECORD, {
+            BoltValue({ i, name.c_str(), text.c_str(),
+                BoltValue({ ints[0], ints[1], ints[2], ints[3], ints[4], ints[5] }),
+                map, BoltValue::Make_Null(), node })
+        }));
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+
+        expect += "<[7 i" + std::to_string(i) + " " + Expect_String(name) + Expect_String(text) + "[6 ";
+        for (s64 v : ints) expect += "i" + std::to_string(v) + " ";
+        expect += "] {2 " + Expect_String("score") + "f" + std::to_string(i * 0.25) + " " +
+            Expect_String("active") + ((i & 1) ? "T " : "F ") + "} n " +
+            "(78/2 i" + std::to_string(i) + " [1 " + Expect_String("Person") + "] ) ] >\n";
+    } // end for
+
+    const size_t records = buf.Size();
+
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    BoltMessage summary(BoltValue(BOLT_SUCCESS, { BoltValue::Make_Map() }));
+    encoder.Encode(summary);
+    Release_Pool<BoltValue>(offset);
+
+    return records;
+} // end Fill_Records
+
+
+/**
+ * @brief plays recv over a fixed RECV_BUF buffer; each round brings in up to
+ *  next() bytes of wire, feeds whatever is unread, consumes what was taken and
+ *  rewinds to the start. The buffer is never grown.
+ *
+ * @return bytes of wire consumed when the decoder stopped at the summary
+ */
+template<typename Next>
+size_t Recv_Loop(const BoltBuf& wire_buf, BoltStreamDecoder& stream, Next next)
+{
+    const u8* wire = const_cast<BoltBuf&>(wire_buf).Data();
+    const size_t wire_size = const_cast<BoltBuf&>(wire_buf).Size();
+
+    BoltBuf rbuf(RECV_BUF);
+    const size_t capacity = rbuf.Capacity();
+    size_t sent = 0, consumed = 0;
+
+    while (sent < wire_size)
+    {
+        if (rbuf.Writable_Size() == 0) Fatal("receive buffer filled up");
+
+        size_t n = std::min({ next(), rbuf.Writable_Size(), wire_size - sent });
+        memcpy(rbuf.Write_Ptr(), wire + sent, n);
+        rbuf.Advance(n);
+        sent += n;
+
+        LBStatus rc = stream.Feed(rbuf.Read_Ptr(), rbuf.Size());
+        if (LBAction(LB_Action(rc)) == LBAction::LB_FAIL) Fatal("stream failed at %zu", consumed);
+
+        rbuf.Consume(LB_Aux(rc));
+        consumed += LB_Aux(rc);
+        if (LB_OK(rc)) return consumed;
+
+        rbuf.Rewind(0);
+        if (rbuf.Capacity() != capacity) Fatal("receive buffer grew");
+    } // end while
+
+    return consumed;
+} // end Recv_Loop
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    BoltBuf wire(BIG_SIZE + 1024 * 1024);
+    std::string expect;
+    const size_t records = Fill_Records(wire, expect);
+
+    // all at once
+    Transcript whole;
+    BoltStreamDecoder stream;
+    stream.Reset(&whole);
+
+    auto t0 = Clock::now();
+    LBStatus rc = stream.Feed(wire.Data(), wire.Size());
+    auto t1 = Clock::now();
+
+    if (!LB_OK(rc) || LB_Aux(rc) != records)
+        Fatal("expected a stop at %zu, got %u", records, LB_Aux(rc));
+    if (stream.Records() != RECORDS || stream.In_Message())
+        Fatal("decoded %llu records", (unsigned long long)stream.Records());
+    if (whole.text != expect)
+        Fatal("events differ from the records encoded");
+
+    // out of an 8K buffer; a byte, a few bytes or a random amount per recv
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> any(1, RECV_BUF);
+    std::pair<const char*, std::function<size_t()>> recvs[] = {
+        { "1 byte", [] { return size_t(1); } },
+        { "7 bytes", [] { return size_t(7); } },
+        { "random", [&] { return any(rng); } },
+        { "8K", [] { return RECV_BUF; } },
+    };
+
+    for (auto& [label, next] : recvs)
+    {
+        Transcript t;
+        stream.Reset(&t);
+        size_t consumed = Recv_Loop(wire, stream, next);
+        if (consumed != records || stream.Records() != RECORDS || t.text != expect)
+            Fatal("%s per recv: %zu of %zu bytes, %llu records", label, consumed, records,
+                (unsigned long long)stream.Records());
+        Utils::Print("  %-8s per recv: %d records match", label, RECORDS);
+    } // end for recvs
+
+    // a broken one must fail, not hang or read past
+    wire.Data()[4] = 0xC7;     // first field marker of the first record
+    stream.Reset(&whole);
+    if (LBAction(LB_Action(stream.Feed(wire.Data(), wire.Size()))) != LBAction::LB_FAIL)
+        Fatal("bad marker went through");
+
+    const double mib = double(records) / (1024.0 * 1024.0);
+    Utils::Print("%.1f MiB of records through a %zu byte buffer; whole feed %.1f MiB/s",
+        mib, RECV_BUF, mib / std::chrono::duration<double>(t1 - t0).count());
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
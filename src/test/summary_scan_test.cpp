@@ -0,0 +1,183 @@
+/**
+ * @file summary_scan_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief SUCCESS summaries as a server sends them at the end of PULL batches;
+ *  checks Scan_Summary() reads has_more, t_first, t_last, qid, bookmark and db
+ *  past stats, notifications and plans it doesn't know, rejects broken ones,
+ *  then times it against decoding the map and looking "has_more" up by key.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_result.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int ROUNDS = 200'000;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief the end of a batch; {has_more: true, qid: 3, t_first: 2}
+ */
+void Encode_Batch_End(BoltBuf& buf)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    BoltValue meta = BoltValue::Make_Map();
+    meta.Insert_Map("t_first", BoltValue::Make_Int(2));
+    meta.Insert_Map("qid", BoltValue::Make_Int(3));
+    meta.Insert_Map("has_more", BoltValue::Make_Bool(true));
+
+    BoltMessage msg(BoltValue(BOLT_SUCCESS, { meta }));
+    BoltEncoder(buf).Encode(msg);
+    Release_Pool<BoltValue>(offset);
+} // end Encode_Batch_End
+
+
+/**
+ * @brief the final summary of a write; what the driver acts on sits between and
+ *  after keys it has no use for. t_first is null to check a wrong type is skipped.
+ */
+void Encode_Final(BoltBuf& buf)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+
+    BoltValue stats = BoltValue::Make_Map();
+    stats.Insert_Map("properties-set", BoltValue::Make_Int(12));
+    stats.Insert_Map("nodes-created", BoltValue::Make_Int(4));
+
+    BoltValue position = BoltValue::Make_Map();
+    position.Insert_Map("column", BoltValue::Make_Int(17));
+    position.Insert_Map("line", BoltValue::Make_Int(1));
+    position.Insert_Map("offset", BoltValue::Make_Int(16));
+
+    BoltValue note = BoltValue::Make_Map();
+    note.Insert_Map("position", position);
+    note.Insert_Map("severity", BoltValue("WARNING"));
+    note.Insert_Map("code", BoltValue("Neo.ClientNotification.Statement.CartesianProduct"));
+
+    BoltValue plan = BoltValue::Make_Struct(0x50);
+    plan.Insert_Struct(BoltValue({ 1.5, "ProduceResults", BoltValue::Make_Null() }));
+
+    BoltValue meta = BoltValue::Make_Map();
+    meta.Insert_Map("db", BoltValue("neo4j"));
+    meta.Insert_Map("plan", plan);
+    meta.Insert_Map("notifications", BoltValue({ note }));
+    meta.Insert_Map("t_last", BoltValue::Make_Int(1234));
+    meta.Insert_Map("stats", stats);
+    meta.Insert_Map("type", BoltValue("w"));
+    meta.Insert_Map("t_first", BoltValue::Make_Null());
+    meta.Insert_Map("bookmark", BoltValue("FB:kcwQzcmZ+Y3PTl2S4J13hV3LjQOQ"));
+
+    BoltMessage msg(BoltValue(BOLT_SUCCESS, { meta }));
+    BoltEncoder(buf).Encode(msg);
+    Release_Pool<BoltValue>(offset);
+} // end Encode_Final
+
+
+/**
+ * @brief payload of the single chunk message at buf offset
+ */
+std::pair<const u8*, const u8*> Payload(BoltBuf& buf, const size_t offset)
+{
+    const u8* p = buf.Data() + offset;
+    return { p + 2, p + 2 + Unpack::Get_BE<u16>(p) };
+} // end Payload
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    BoltBuf buf;
+    Encode_Batch_End(buf);
+    const size_t final_at = buf.Size();
+    Encode_Final(buf);
+
+    // batch end
+    BoltSummary s;
+    auto [p, end] = Payload(buf, 0);
+    LBStatus rc = Scan_Summary(p, end, s);
+    if (!LB_OK(rc) || LB_Aux(rc) != 3 || !s.has_more || s.qid != 3 || s.t_first != 2 ||
+        s.t_last != -1 || !s.bookmark.empty() || !s.db.empty())
+        Fatal("batch end scanned wrong");
+
+    // final
+    auto [fp, fend] = Payload(buf, final_at);
+    rc = Scan_Summary(fp, fend, s);
+    if (!LB_OK(rc) || LB_Aux(rc) != 3 || s.has_more || s.t_first != -1 || s.t_last != 1234 ||
+        s.bookmark != "FB:kcwQzcmZ+Y3PTl2S4J13hV3LjQOQ" || s.db != "neo4j")
+        Fatal("final summary scanned wrong");
+    Utils::Print("final: t_last %lld, db %.*s, bookmark %.*s", (long long)s.t_last,
+        int(s.db.size()), s.db.data(), int(s.bookmark.size()), s.bookmark.data());
+
+    // cut anywhere short of the end, or not a SUCCESS at all
+    for (const u8* cut = fp; cut < fend; cut++)
+        if (LB_OK(Scan_Summary(fp, cut, s)))
+            Fatal("summary cut at %td bytes went through", cut - fp);
+
+    u8 record[] = { 0xB1, BOLT_RECORD, 0xA0 };
+    if (LB_OK(Scan_Summary(record, record + sizeof(record), s)))
+        Fatal("a RECORD scanned as a summary");
+
+    // timing; the final summary either way
+    BoltDecoder decoder(buf);
+    double decode_ns = 0, scan_ns = 0;
+    size_t more = 0;
+
+    auto t0 = Clock::now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltMessage summary;
+        decoder.Decode(buf.Data() + final_at, summary);
+        if (summary.msg(0).type == BoltType::Map &&
+            summary.msg(0)["has_more"].type != BoltType::Unk &&
+            summary.msg(0)["has_more"].bool_val == true)
+            more++;
+        Release_Pool<BoltValue>(offset);
+    } // end for decode
+    auto t1 = Clock::now();
+
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        Scan_Summary(fp, fend, s);
+        more += s.has_more;
+    } // end for scan
+    auto t2 = Clock::now();
+
+    if (more) Fatal("has_more turned up in the final summary");
+
+    decode_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / ROUNDS;
+    scan_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / ROUNDS;
+    Utils::Print("%zu byte summary x %d", size_t(fend - fp), ROUNDS);
+    Utils::Print("  Decode + lookup: %.1f ns", decode_ns);
+    Utils::Print("  Scan_Summary:    %.1f ns", scan_ns);
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
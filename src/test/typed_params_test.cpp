@@ -0,0 +1,166 @@
+/**
+ * @file typed_params_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief checks that RUN messages packed from typed parameters, P("key", v), are
+ *  byte for byte what the BoltValue encoder produces for the same map, bodies
+ *  over a chunk split alike, and times both ways of encoding.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "bolt/bolt_encoder.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int ROUNDS = 1'000'000;
+constexpr size_t BLOB = 200'000;        // a parameter spanning four chunks
+const char* QUERY = "MATCH (p:Person {id: $id}) WHERE p.score > $score AND p.name IN $names RETURN p";
+const std::vector<std::string> NAMES = { "Abebe", "Almaz", "Kebede", "a name longer than fifteen" };
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief encodes the RUN message through a BoltValue tree
+ */
+void Encode_BoltValue(BoltEncoder& encoder, const int id)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    BoltMessage run(BoltValue(BOLT_RUN, {
+        QUERY,
+        BoltValue({
+            mp("id", id),
+            mp("score", 99.5),
+            mp("names", BoltValue({ NAMES[0].c_str(), NAMES[1].c_str(), NAMES[2].c_str(), NAMES[3].c_str() })),
+            mp("active", true)
+        }),
+        BoltValue::Make_Map()
+    }));
+
+    encoder.Encode(run);
+    Release_Pool<BoltValue>(offset);
+} // end Encode_BoltValue
+
+
+/**
+ * @brief encodes the same RUN message from typed parameters
+ */
+void Encode_Typed(BoltEncoder& encoder, const int id)
+{
+    static const size_t len = strlen(QUERY);
+    encoder.Encode_Run(QUERY, len, nullptr,
+        P("id", id),
+        P("score", 99.5),
+        P("names", std::span<const std::string>{ NAMES }),
+        P("active", true));
+} // end Encode_Typed
+
+
+/**
+ * @brief a RUN whose body won't fit a chunk, typed and through a BoltValue tree;
+ *  the same chunks either way
+ */
+void Large()
+{
+    const std::string blob(BLOB, 'x');
+    BoltBuf a, b;
+    BoltEncoder ea(a), eb(b);
+
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    BoltMessage run(BoltValue(BOLT_RUN, {
+        QUERY,
+        BoltValue({ mp("blob", blob.c_str()) }),
+        BoltValue::Make_Map()
+    }));
+    LBStatus rc = ea.Encode(run);
+    Release_Pool<BoltValue>(offset);
+    if (!LB_OK(rc)) Fatal("large: BoltValue encode failed");
+
+    if (!LB_OK(eb.Encode_Run(QUERY, strlen(QUERY), nullptr, P("blob", std::string_view(blob)))))
+        Fatal("large: typed encode of a %zu byte parameter failed", BLOB);
+    if (a.Size() != b.Size() || memcmp(a.Data(), b.Data(), a.Size()) != 0)
+        Fatal("large: typed encoding differs, %zu vs %zu bytes", b.Size(), a.Size());
+    Utils::Print("Large RUN: %zu bytes in %zu chunks", b.Size(), (BLOB - 1) / BOLT_MAX_CHUNK_SIZE + 1);
+} // end Large
+
+
+/**
+ * @brief times ROUNDS encodes, resetting the buffer in between
+ */
+template<typename Fn>
+double Time_It(Fn&& fn)
+{
+    BoltBuf buf;
+    BoltEncoder encoder(buf);
+
+    auto start = Clock::now();
+    for (int i = 0; i < ROUNDS; i++)
+    {
+        fn(encoder, i);
+        buf.Reset();
+    } // end for
+    auto end = Clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / ROUNDS;
+} // end Time_It
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    // same bytes for a few ids covering every integer width
+    for (int id : { 7, -100, 1000, 100000, INT32_MIN })
+    {
+        BoltBuf a, b;
+        BoltEncoder ea(a), eb(b);
+        Encode_BoltValue(ea, id);
+        Encode_Typed(eb, id);
+
+        if (a.Size() != b.Size() || memcmp(a.Data(), b.Data(), a.Size()) != 0)
+        {
+            Utils::Dump_Hex((const char*)a.Data(), a.Size());
+            Utils::Dump_Hex((const char*)b.Data(), b.Size());
+            Fatal("typed encoding differs for id %d", id);
+        } // end if differs
+    } // end for ids
+
+    static constexpr ParamKey id_key("id");
+    BoltBuf c;
+    BoltEncoder ec(c);
+    ec.Encode_Run("RETURN $id", 10, nullptr, P(id_key, 42));
+    Utils::Print("Pre-packed key: %zu bytes", c.Size());
+    Large();
+
+    double boltvalue_ns = Time_It(Encode_BoltValue);
+    double typed_ns = Time_It(Encode_Typed);
+
+    Utils::Print("RUN encode, %d rounds", ROUNDS);
+    Utils::Print("  BoltValue map: %.1f ns/msg", boltvalue_ns);
+    Utils::Print("  typed P():     %.1f ns/msg", typed_ns);
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
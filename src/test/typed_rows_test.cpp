@@ -0,0 +1,178 @@
+/**
+ * @file typed_rows_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief decodes a batch of RECORD messages into plain structs with Fetch_As<T>
+ *  and checks them against what went in, including a record whose column types
+ *  don't fit, which must be reported for that row only. Then times it against
+ *  the usual way; iterating BoltValues and copying them out into the same struct.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "bolt/bolt_encoder.h"
+#include "bolt/bolt_result.h"
+#include "utils/utils.h"
+#include "utils/errors.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+using Clock = std::chrono::high_resolution_clock;
+
+constexpr int RECORDS = 100'000;
+constexpr int BAD_ROW = 777;        // this one carries a string for the id
+constexpr int ROUNDS = 10;
+
+
+struct Person
+{
+    s64 id;
+    std::string name;
+    double score;
+    bool active;
+    std::optional<s32> age;
+};
+
+template<>
+struct BoltRow<Person>
+{
+    static constexpr auto fields = std::make_tuple(&Person::id, &Person::name,
+        &Person::score, &Person::active, &Person::age);
+};
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief fills buf with RECORD messages [id, name, score, active, age]; every
+ *  tenth age is null.
+ */
+void Fill_Records(BoltBuf& buf)
+{
+    BoltEncoder encoder(buf);
+    for (int i = 0; i < RECORDS; i++)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltValue age = i % 10 ? BoltValue(i % 90) : BoltValue::Make_Null();
+        BoltValue id = i == BAD_ROW ? BoltValue("seven seven seven") : BoltValue(s64(i) * 1000);
+
+        BoltMessage rec(BoltValue(BOLT_RECORD, {
+            BoltValue({ id, "Lightning Bolt Person", i * 0.5, (i & 1) == 0, age })
+        }));
+
+        encoder.Encode(rec);
+        Release_Pool<BoltValue>(offset);
+    } // end for
+} // end Fill_Records
+
+
+/**
+ * @brief the pre Fetch_As way; decode each record into BoltValues then copy out
+ */
+size_t Copy_Out(BoltResult& result, std::vector<Person>& rows)
+{
+    for (auto rec : result)
+    {
+        size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+        BoltValue list = rec(0);
+        BoltValue id = list(0), name = list(1), score = list(2), active = list(3), age = list(4);
+
+        if (id.type == BoltType::Int)
+        {
+            Person& p = rows.emplace_back();
+            p.id = id.int_val;
+            p.name.assign(reinterpret_cast<const char*>(name.buf->Data() + name.str_val.offset),
+                name.str_val.length);
+            p.score = score.float_val;
+            p.active = active.bool_val;
+            if (age.type == BoltType::Int) p.age = static_cast<s32>(age.int_val);
+        } // end if fits
+
+        Release_Pool<BoltValue>(offset);
+    } // end for
+
+    return rows.size();
+} // end Copy_Out
+
+
+int main()
+{
+    Utils::Print_Title();
+
+    BoltBuf buf;
+    Fill_Records(buf);
+
+    BoltDecoder decoder(buf);
+    BoltResult result;
+    result.pdec = &decoder;
+    result.start_offset = 0;
+    result.total_bytes = buf.Size();
+    result.message_count = RECORDS;
+
+    // structs
+    std::vector<Person> people;
+    std::vector<RowError> errors;
+    LBStatus rc = result.Fetch_As(people, &errors);
+
+    if (LB_Code(rc) != u8(LBCode::LB_CODE_TYPE) || LB_Aux(rc) != 1)
+        Fatal("expected a single rejected row, got status %llx", (unsigned long long)rc);
+    if (errors.size() != 1 || errors[0].row != BAD_ROW || LB_Aux(errors[0].status) != 0)
+        Fatal("bad row not reported at row %d, column 0", BAD_ROW);
+    if (people.size() != RECORDS - 1)
+        Fatal("expected %d rows, got %zu", RECORDS - 1, people.size());
+
+    for (size_t r = 0; r < people.size(); r++)
+    {
+        const int i = r < BAD_ROW ? int(r) : int(r) + 1;
+        const Person& p = people[r];
+        if (p.id != s64(i) * 1000 || p.name != "Lightning Bolt Person" || p.score != i * 0.5 ||
+            p.active != ((i & 1) == 0) || p.age != (i % 10 ? std::optional<s32>(i % 90) : std::nullopt))
+            Fatal("row %zu decoded wrong", r);
+    } // end for check
+
+    // tuples, with a narrower column that must be range checked
+    std::vector<std::tuple<s16, std::string_view>> narrow;
+    rc = result.Fetch_As(narrow);
+    Utils::Print("tuple<s16, string_view>: %zu rows fit, %u rejected", narrow.size(), LB_Aux(rc));
+    if (narrow.size() != size_t(s16(INT16_MAX) / 1000 + 1))
+        Fatal("range check let through %zu rows", narrow.size());
+
+    // timing
+    double copy_ns = 0, typed_ns = 0;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        std::vector<Person> a, b;
+        auto t0 = Clock::now();
+        Copy_Out(result, a);
+        auto t1 = Clock::now();
+        result.Fetch_As(b);
+        auto t2 = Clock::now();
+
+        copy_ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        typed_ns += std::chrono::duration<double, std::nano>(t2 - t1).count();
+    } // end for rounds
+
+    Utils::Print("%d records x %d rounds", RECORDS, ROUNDS);
+    Utils::Print("  BoltValue + copy: %.1f ns/row", copy_ns / (double(RECORDS) * ROUNDS));
+    Utils::Print("  Fetch_As<Person>: %.1f ns/row", typed_ns / (double(RECORDS) * ROUNDS));
+    Utils::Print("Passed.");
+
+    return 0;
+} // end main
@@ -0,0 +1,279 @@
+/**
+ * @file wire_capture_test.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief wire capture and replay. Offline, a capture is made up of the bytes a
+ *  session would move; HELLO, queries and their records cut at odd places over
+ *  many recvs, a failed query the connection answers with a RESET of its own,
+ *  and a response captured ahead of its request. Replaying it must take every
+ *  result with all its records and leave no byte unmatched, and the replay is
+ *  timed against the records it decoded. Given "live" as the first argument it
+ *  also captures a driver running queries against bolt://localhost:7687 and
+ *  replays that.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include <random>
+#include "neodriver.h"
+#include "connection/wire_replay.h"
+#include "utils/errors.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr const char* CAPTURE_PATH = "/tmp/lightningbolt_wire_test.lbwire";
+constexpr const char* LIVE_PREFIX = "/tmp/lightningbolt_wire_live";
+constexpr int QUERIES = 200;
+constexpr int ROWS = 50;                // per query
+constexpr int LIVE_QUERIES = 100;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief encodes msg onto buf
+ */
+void Put(BoltBuf& buf, BoltMessage msg)
+{
+    BoltEncoder(buf).Encode(msg);
+} // end Put
+
+
+/**
+ * @brief a query sent; RUN then PULL all
+ */
+void Put_Query(BoltBuf& buf, const int i)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Put(buf, BoltMessage(BoltValue(BOLT_RUN, { "UNWIND range(1, $n) AS r RETURN r, 'row' AS name",
+        BoltValue({ mp("n", BoltValue::Make_Int(ROWS + i)) }), BoltValue::Make_Map() })));
+    Put(buf, BoltMessage(BoltValue(BOLT_PULL, { BoltValue({ mp("n", BoltValue::Make_Int(-1)) }) })));
+    Release_Pool<BoltValue>(offset);
+} // end Put_Query
+
+
+/**
+ * @brief and its response; RUN's SUCCESS, the records, the final SUCCESS
+ */
+void Put_Result(BoltBuf& buf, const int i)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Put(buf, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("t_first", BoltValue::Make_Int(1)), mp("fields", BoltValue({ "r", "name" })) }) })));
+    for (int r = 1; r <= ROWS + i; r++)
+        Put(buf, BoltMessage(BoltValue(BOLT_RECORD, { BoltValue({ r, "row" }) })));
+    Put(buf, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue({
+        mp("t_last", BoltValue::Make_Int(2)), mp("db", BoltValue("neo4j")) }) })));
+    Release_Pool<BoltValue>(offset);
+} // end Put_Result
+
+
+/**
+ * @brief a bare SUCCESS, i.e. for HELLO or RESET
+ */
+void Put_Success(BoltBuf& buf)
+{
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Put(buf, BoltMessage(BoltValue(BOLT_SUCCESS, { BoltValue::Make_Map() })));
+    Release_Pool<BoltValue>(offset);
+} // end Put_Success
+
+
+/**
+ * @brief appends buf's bytes to the capture going dir, cut into pieces of
+ *  random sizes as recvs would bring them; then empties buf
+ */
+void Capture(WireCapture& cap, BoltBuf& buf, const WireDir dir, std::mt19937& rng)
+{
+    std::uniform_int_distribution<size_t> piece(1, 3'000);
+    const u8* p = buf.Data();
+    size_t left = buf.Size();
+    while (left)
+    {
+        size_t n = dir == WireDir::Out ? left : std::min(left, piece(rng));
+        cap.Append(dir, p, n);
+        p += n;
+        left -= n;
+    } // end while
+
+    buf.Reset();
+} // end Capture
+
+
+/**
+ * @brief the capture of a session made up
+ *
+ * @return the records in it
+ */
+u64 Make_Capture()
+{
+    std::mt19937 rng(7);
+    WireCapture cap;
+    if (LB_OK(cap.Open("/nonexistent/dir/capture.lbwire"))) Fatal("capture into a missing directory");
+    if (!LB_OK(cap.Open(CAPTURE_PATH)) || !cap.Is_Open()) Fatal("capture open");
+
+    BoltBuf out(1 << 16), in(1 << 20);
+    size_t offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Put(out, BoltMessage(BoltValue(BOLT_HELLO, { BoltValue({ mp("user_agent", BoltValue("LB/1.0")) }) })));
+    Put(out, BoltMessage(BoltValue(BOLT_LOGON, { BoltValue({ mp("scheme", BoltValue("none")) }) })));
+    Release_Pool<BoltValue>(offset);
+    Capture(cap, out, WireDir::Out, rng);
+    Put_Success(in);
+    Capture(cap, in, WireDir::In, rng);
+    Put_Success(in);
+    Capture(cap, in, WireDir::In, rng);
+
+    u64 records = 0;
+    for (int i = 0; i < QUERIES; i++)
+    {
+        Put_Query(out, i);
+        Put_Result(in, i);
+        records += ROWS + i;
+
+        if (i == QUERIES / 2)
+        {
+            // the response captured a hair before the request it answers
+            Capture(cap, in, WireDir::In, rng);
+            Capture(cap, out, WireDir::Out, rng);
+            continue;
+        } // end if
+
+        Capture(cap, out, WireDir::Out, rng);
+        Capture(cap, in, WireDir::In, rng);
+    } // end for
+
+    // a failed query; its PULL is IGNORED and the connection RESETs by itself
+    Put_Query(out, 0);
+    Capture(cap, out, WireDir::Out, rng);
+    offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Put(in, BoltMessage(BoltValue(BOLT_FAILURE, { BoltValue({
+        mp("neo4j_code", BoltValue("Neo.ClientError.Statement.SyntaxError")),
+        mp("message", BoltValue("Invalid input")) }) })));
+    Put(in, BoltMessage(BoltValue(BOLT_IGNORED, {})));
+    Release_Pool<BoltValue>(offset);
+    Capture(cap, in, WireDir::In, rng);
+
+    offset = GetBoltPool<BoltValue>()->Get_Last_Offset();
+    Put(out, BoltMessage(BoltValue(BOLT_RESET, {})));
+    Release_Pool<BoltValue>(offset);
+    Capture(cap, out, WireDir::Out, rng);
+    Put_Success(in);
+    Capture(cap, in, WireDir::In, rng);
+
+    // and one more after it
+    Put_Query(out, 1);
+    Capture(cap, out, WireDir::Out, rng);
+    Put_Result(in, 1);
+    Capture(cap, in, WireDir::In, rng);
+    records += ROWS + 1;
+
+    const u64 written = cap.Bytes();
+    cap.Close();
+    if (cap.Is_Open() || written < records * 6) Fatal("capture wrote %llu bytes", (unsigned long long)written);
+    return records;
+} // end Make_Capture
+
+
+/**
+ * @brief replays path once and prints what it went through
+ */
+ReplayStats Replay(const std::string& path)
+{
+    CaptureReader reader;
+    if (!LB_OK(reader.Open(path))) Fatal("can't read %s", path.c_str());
+
+    ReplayStats stats;
+    WireReplay replay;
+    LBStatus rc = replay.Run(reader, stats);
+    if (!LB_OK(rc)) Fatal("replay failed: action %u code %u", LB_Action(rc), LB_Code(rc));
+
+    Utils::Print("replay: %llu recvs, %llu sends; %llu requests, %llu results, %llu records, %llu failures",
+        (unsigned long long)stats.frames_in, (unsigned long long)stats.frames_out,
+        (unsigned long long)stats.requests, (unsigned long long)stats.results,
+        (unsigned long long)stats.records, (unsigned long long)stats.failures);
+    Utils::Print("replay: %.2f ms for %.2f MB in, %.0f ns/record; recv decode p50 %.1f us, p99 %.1f us",
+        stats.replay_ns / 1e6, stats.bytes_in / 1e6, double(stats.replay_ns) / double(stats.records ? stats.records : 1),
+        stats.frame_decode.Percentile_Us(0.5), stats.frame_decode.Percentile_Us(0.99));
+    return stats;
+} // end Replay
+
+
+/**
+ * @brief the made up session replayed
+ */
+void Offline()
+{
+    const u64 records = Make_Capture();
+    ReplayStats stats = Replay(CAPTURE_PATH);
+
+    // HELLO, LOGON, the queries, the failed one, its RESET and the last one
+    if (stats.requests != QUERIES + 4 || stats.results != QUERIES + 4 || stats.records != records ||
+        stats.failures != 1 || stats.unmatched)
+        Fatal("replay took %llu results, %llu records of %llu, %llu unmatched bytes",
+            (unsigned long long)stats.results, (unsigned long long)stats.records,
+            (unsigned long long)records, (unsigned long long)stats.unmatched);
+
+    CaptureReader bad;
+    if (LB_OK(bad.Open("/proc/self/status"))) Fatal("not a capture, read as one");
+    unlink(CAPTURE_PATH);
+} // end Offline
+
+
+/**
+ * @brief a live session captured and replayed
+ */
+void Live()
+{
+    NeoDriver driver("bolt://localhost:7687", Auth::Basic("neo4j", ""), BoltValue::Make_Map(), 1);
+    if (!LB_OK(driver.Set_Capture(LIVE_PREFIX))) Fatal("live: capture");
+
+    std::atomic<int> done{ 0 };
+    std::atomic<u64> rows{ 0 };
+    for (int i = 0; i < LIVE_QUERIES; i++)
+        driver.Execute_Async([&](BoltResult& r) {
+            rows.fetch_add(r.message_count, std::memory_order_relaxed);
+            done.fetch_add(1, std::memory_order_release);
+        }, "UNWIND range(1, 1000) AS r RETURN r, 'a string' AS s");
+    while (done.load(std::memory_order_acquire) < LIVE_QUERIES)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    driver.Set_Capture("");
+    driver.Close();
+
+    const std::string path = std::string(LIVE_PREFIX) + ".0.lbwire";
+    ReplayStats stats = Replay(path);
+    if (stats.records != rows.load() || stats.unmatched)
+        Fatal("live: replay decoded %llu records of %llu", (unsigned long long)stats.records,
+            (unsigned long long)rows.load());
+    unlink(path.c_str());
+} // end Live
+
+
+int main(int argc, char** argv)
+{
+    Utils::Print_Title();
+    Offline();
+
+    if (argc > 1 && !strcmp(argv[1], "live"))
+        Live();
+
+    Utils::Print("Passed.");
+    return 0;
+} // end main
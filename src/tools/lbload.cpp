@@ -0,0 +1,174 @@
+/**
+ * @file lbload.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief an open loop load generator over the driver; queries go out at a
+ *  target rate whatever the server does, and their latency is counted from
+ *  when they were scheduled to go, correcting for coordinated omission. Runs
+ *  against a server or a local Bolt stand-in. Usage:
+ *
+ *      lbload [--url bolt://host:port | --standin] [--user u] [--password p]
+ *          [--rate n] [--connections n] [--workers n] [--warmup s] [--duration s]
+ *          [--max-inflight n] [--poisson] [--seed n]
+ *          [--query name:weight:cypher]... [--rows n] [--service-us n]
+ *
+ *  --query may be given as often as needed to make up a mix; the default is a
+ *  lone RETURN 1. --rows and --service-us shape the stand-in's answers.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "neoload.h"
+#include "connection/bolt_standin.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          GLOBALS
+//===============================================================================|
+constexpr double PERCENTILES[] = { 0.5, 0.9, 0.99, 0.999, 0.9999, 1.0 };
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+/**
+ * @brief a row of percentiles in microseconds
+ */
+void Print_Row(const char* name, const LatencyHistogram& h)
+{
+    printf("%-16s %10llu", name, (unsigned long long)h.samples);
+    for (double p : PERCENTILES)
+        printf(" %10.1f", h.Percentile_Us(p));
+    printf("\n");
+} // end Print_Row
+
+
+/**
+ * @brief parses name:weight:cypher; the cypher may have colons of its own
+ */
+bool Parse_Query(const std::string& arg, LoadQuery& q)
+{
+    size_t a = arg.find(':');
+    size_t b = a == std::string::npos ? a : arg.find(':', a + 1);
+    if (b == std::string::npos) return false;
+
+    q.name = arg.substr(0, a);
+    q.weight = u32(atoi(arg.substr(a + 1, b - a - 1).c_str()));
+    q.cypher = arg.substr(b + 1);
+    return q.weight && !q.cypher.empty();
+} // end Parse_Query
+
+
+void Usage(const char* self)
+{
+    fprintf(stderr, "usage: %s [--url bolt://host:port | --standin] [--user u] [--password p]\n"
+        "    [--rate n] [--connections n] [--workers n] [--warmup s] [--duration s]\n"
+        "    [--max-inflight n] [--poisson] [--seed n]\n"
+        "    [--query name:weight:cypher]... [--rows n] [--service-us n]\n", self);
+    exit(2);
+} // end Usage
+
+
+int main(int argc, char** argv)
+{
+    std::string url = "bolt://localhost:7687", user = "neo4j", password;
+    bool standin_on = false;
+    int connections = 4, workers = 0;
+    LoadSpec spec;
+    StandinSpec sspec;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--standin") { standin_on = true; continue; }
+        if (arg == "--poisson") { spec.arrival = Arrival::Poisson; continue; }
+        if (i + 1 >= argc) Usage(argv[0]);
+
+        const char* v = argv[++i];
+        if (arg == "--url") url = v;
+        else if (arg == "--user") user = v;
+        else if (arg == "--password") password = v;
+        else if (arg == "--rate") spec.rate = atof(v);
+        else if (arg == "--connections") connections = std::max(1, atoi(v));
+        else if (arg == "--workers") workers = std::max(0, atoi(v));
+        else if (arg == "--warmup") spec.warmup = std::chrono::nanoseconds(s64(atof(v) * 1e9));
+        else if (arg == "--duration") spec.measure = std::chrono::nanoseconds(s64(atof(v) * 1e9));
+        else if (arg == "--max-inflight") spec.max_inflight = u32(atoi(v));
+        else if (arg == "--seed") spec.seed = u64(atoll(v));
+        else if (arg == "--rows") sspec.rows = u32(atoi(v));
+        else if (arg == "--service-us") sspec.service = std::chrono::microseconds(atoi(v));
+        else if (arg == "--query")
+        {
+            LoadQuery q;
+            if (!Parse_Query(v, q)) Usage(argv[0]);
+            spec.mix.push_back(std::move(q));
+        } // end else if query
+        else Usage(argv[0]);
+    } // end for
+
+    if (spec.mix.empty()) spec.mix.push_back({ "return_1", "RETURN 1 AS n", 1 });
+
+    BoltStandin standin;
+    if (standin_on)
+    {
+        if (!LB_OK(standin.Start(sspec)))
+        {
+            fprintf(stderr, "stand-in: can't listen; %s\n", strerror(errno));
+            return 1;
+        } // end if no stand-in
+        url = standin.Url();
+    } // end if stand-in
+
+    NeoDriver driver(url, Auth::Basic(user.c_str(), password.c_str()), BoltValue::Make_Map(),
+        connections, workers);
+    LoadGenerator gen(driver);
+
+    printf("%s, %d connection%s; %.0f/s %s for %.1f s after %.1f s warmup", url.c_str(), connections,
+        connections > 1 ? "s" : "", spec.rate, spec.arrival == Arrival::Poisson ? "poisson" : "uniform",
+        spec.measure.count() / 1e9, spec.warmup.count() / 1e9);
+    if (spec.max_inflight) printf(", at most %u in flight", spec.max_inflight);
+    printf("\n");
+
+    LoadReport r;
+    if (!LB_OK(gen.Run(spec, r)))
+    {
+        fprintf(stderr, "nothing to run\n");
+        return 1;
+    } // end if bad spec
+    driver.Close();
+    standin.Stop();
+
+    printf("\nscheduled %llu, done %llu, failed %llu, not sent %llu, timed out %llu\n",
+        (unsigned long long)r.scheduled, (unsigned long long)r.completed, (unsigned long long)r.failed,
+        (unsigned long long)r.send_errors, (unsigned long long)r.timed_out);
+    printf("achieved %.1f/s of %.1f/s, %llu records\n\n", r.Achieved_Rate(), spec.rate,
+        (unsigned long long)r.records);
+
+    printf("%-16s %10s %10s %10s %10s %10s %10s %10s\n", "us", "count", "p50", "p90", "p99",
+        "p99.9", "p99.99", "max");
+    Print_Row("latency", r.latency);
+    Print_Row("service", r.service);
+    Print_Row("send lag", r.send_lag);
+    if (spec.mix.size() > 1)
+        for (size_t q = 0; q < spec.mix.size(); q++)
+            Print_Row(spec.mix[q].name.c_str(), r.per_query[q]);
+
+    printf("\nlatency is from each query's scheduled start; service from when it was sent, as a\n"
+        "closed loop would count it. A gap between the two is time the schedule fell behind.\n");
+    return r.timed_out || r.failed ? 1 : 0;
+} // end main
@@ -0,0 +1,93 @@
+/**
+ * @file lbreplay.cpp
+ * @author Rediet Worku aka Aethiopis II ben Zahab (PanaceaSolutionsEth@Gmail.com)
+ *
+ * @brief replays a wire capture, i.e. one NeoDriver::Set_Capture() wrote,
+ *  through the decoder with no server or socket and prints how fast it went.
+ *  Usage:
+ *
+ *      lbreplay <capture> [--loops n]
+ *
+ *  --loops replays the capture n times over, each on a fresh connection; the
+ *  numbers printed are over all of them.
+ *
+ * @version 1.0
+ * @date 16th of October 2026, Friday
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+//===============================================================================|
+//          INCLUDES
+//===============================================================================|
+#include "connection/wire_replay.h"
+#include "utils/utils.h"
+using namespace std;
+
+
+
+
+//===============================================================================|
+//          FUNCTIONS
+//===============================================================================|
+int main(int argc, char** argv)
+{
+    const char* path = nullptr;
+    int loops = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--loops") && i + 1 < argc) loops = std::max(1, atoi(argv[++i]));
+        else path = argv[i];
+    } // end for
+
+    if (!path)
+    {
+        fprintf(stderr, "usage: %s <capture> [--loops n]\n", argv[0]);
+        return 2;
+    } // end if no capture
+
+    CaptureReader reader;
+    LBStatus rc = reader.Open(path);
+    if (!LB_OK(rc))
+    {
+        fprintf(stderr, "%s: %s\n", path, LB_Code(rc) == u8(LBCode::LB_CODE_PROTO) ?
+            "not a capture" : strerror(LB_Aux(rc)));
+        return 1;
+    } // end if can't open
+
+    ReplayStats stats;
+    for (int i = 0; i < loops; i++)
+    {
+        WireReplay replay;
+        reader.Rewind();
+        rc = replay.Run(reader, stats);
+        if (!LB_OK(rc))
+        {
+            fprintf(stderr, "%s: decode failed at recv %llu\n", path, (unsigned long long)stats.frames_in);
+            return 1;
+        } // end if failed
+    } // end for
+
+    const double secs = stats.replay_ns / 1e9;
+    printf("capture     %s, %d loop%s\n", path, loops, loops > 1 ? "s" : "");
+    printf("frames      %llu recv, %llu send\n", (unsigned long long)stats.frames_in,
+        (unsigned long long)stats.frames_out);
+    printf("bytes       %.2f MB in, %.2f MB out\n", stats.bytes_in / 1e6, stats.bytes_out / 1e6);
+    printf("results     %llu of %llu requests, %llu failed, %llu records\n",
+        (unsigned long long)stats.results, (unsigned long long)stats.requests,
+        (unsigned long long)stats.failures, (unsigned long long)stats.records);
+    printf("throughput  %.1f MB/s, %.0f records/s\n", secs > 0 ? stats.bytes_in / 1e6 / secs : 0.0,
+        secs > 0 ? stats.records / secs : 0.0);
+    printf("recv decode p50 %.2f us, p99 %.2f us, max %.2f us\n", stats.frame_decode.Percentile_Us(0.5),
+        stats.frame_decode.Percentile_Us(0.99), stats.frame_decode.Percentile_Us(1.0));
+    printf("duration    %.3f ms captured, %.3f ms replayed per loop\n", stats.captured_ns / 1e6,
+        stats.replay_ns / 1e6 / loops);
+    if (stats.unmatched)
+        printf("unmatched   %llu bytes received with no request left to answer\n",
+            (unsigned long long)stats.unmatched);
+
+    return 0;
+} // end main